@@ -5,8 +5,8 @@ using namespace std;
 
 //****************************************************************************80
 
-void E0000 ( int IENTRY, int *status, double *x, double *fx,
-  unsigned long *qleft, unsigned long *qhi, double *zabsst,
+void E0000 ( dinvr_state *state, int IENTRY, int *status, double *x,
+  double *fx, unsigned long *qleft, unsigned long *qhi, double *zabsst,
   double *zabsto, double *zbig, double *zrelst,
   double *zrelto, double *zsmall, double *zstpmu )
 
@@ -16,15 +16,46 @@ void E0000 ( int IENTRY, int *status, double *x, double *fx,
 //
 //    E0000 is a reverse-communication zero bounder.
 //
+//  Discussion:
+//
+//    Everything that must survive between the reverse-communication calls
+//    lives in *STATE, so independent searches can be interleaved on one
+//    thread or run concurrently on several.  If STATE is NULL, a
+//    per-thread default state is used, as the original interface expects.
+//
+//  Parameters:
+//
+//    Input/output, dinvr_state *STATE, the search state, or NULL.
+//
 {
 # define qxmon(zx,zy,zz) (int)((zx) <= (zy) && (zy) <= (zz))
 
-  static double absstp;
-  static double abstol;
-  static double big,fbig,fsmall,relstp,reltol,small,step,stpmul,xhi,
-    xlb,xlo,xsave,xub,yy;
-  static int i99999;
-  static unsigned long qbdd,qcond,qdum1,qdum2,qincr,qlim,qok,qup;
+  thread_local dinvr_state thread_state;
+  if ( state == NULL ) state = &thread_state;
+
+  double &absstp = state->absstp;
+  double &abstol = state->abstol;
+  double &big = state->big;
+  double &fbig = state->fbig;
+  double &fsmall = state->fsmall;
+  double &relstp = state->relstp;
+  double &reltol = state->reltol;
+  double &small = state->small;
+  double &step = state->step;
+  double &stpmul = state->stpmul;
+  double &xhi = state->xhi;
+  double &xlb = state->xlb;
+  double &xlo = state->xlo;
+  double &xsave = state->xsave;
+  double &xub = state->xub;
+  double &yy = state->yy;
+  int &i99999 = state->i99999;
+  unsigned long &qbdd = state->qbdd;
+  unsigned long &qcond = state->qcond;
+  unsigned long &qincr = state->qincr;
+  unsigned long &qlim = state->qlim;
+  unsigned long &qup = state->qup;
+  unsigned long qdum1,qdum2;
     switch(IENTRY){case 0: goto DINVR; case 1: goto DSTINV;}
 DINVR:
     if(*status > 0) goto S310;
@@ -92,7 +123,6 @@ S90:
     yy = *fx;
     if(!(yy == 0.0e0)) goto S100;
     *status = 0;
-    qok = 1;
     return;
 S100:
     qup = (qincr && yy < 0.0e0) || (!qincr && yy > 0.0e0);
@@ -174,7 +204,8 @@ S220:
     return;
 S240:
 S230:
-    dstzr(&xlb,&xub,&abstol,&reltol);
+    E0001(&state->zror,1,NULL,NULL,NULL,NULL,NULL,NULL,NULL,&abstol,&reltol,
+      &xub,&xlb);
 //
 //  IF WE REACH HERE, XLB AND XUB BOUND THE ZERO OF F.
 //
@@ -183,7 +214,8 @@ S230:
 S250:
     if(!(*status == 1)) goto S290;
 S260:
-    dzror ( status, x, fx, &xlo, &xhi, &qdum1, &qdum2 );
+    E0001(&state->zror,0,status,x,fx,&xlo,&xhi,&qdum1,&qdum2,NULL,NULL,NULL,
+      NULL);
     if(!(*status == 1)) goto S280;
 //
 //     GET-FUNCTION-VALUE
@@ -5,8 +5,8 @@ using namespace std;
 
 //****************************************************************************80
 
-void E0001 ( int IENTRY, int *status, double *x, double *fx,
-  double *xlo, double *xhi, unsigned long *qleft,
+void E0001 ( dzror_state *state, int IENTRY, int *status, double *x,
+  double *fx, double *xlo, double *xhi, unsigned long *qleft,
   unsigned long *qhi, double *zabstl, double *zreltl,
   double *zxhi, double *zxlo )
 
@@ -16,13 +16,45 @@ void E0001 ( int IENTRY, int *status, double *x, double *fx,
 //
 //    E00001 is a reverse-communication zero finder.
 //
+//  Discussion:
+//
+//    The search state lives in *STATE; if STATE is NULL, a per-thread
+//    default state is used.
+//
+//  Parameters:
+//
+//    Input/output, dzror_state *STATE, the search state, or NULL.
+//
 {
 # define ftol(zx) (0.5e0*fifdmax1(abstol,reltol*fabs((zx))))
 
-  static double a,abstol,b,c,d,fa,fb,fc,fd,fda;
-  static double fdb,m,mb,p,q,reltol,tol,w,xxhi,xxlo;
-  static int ext,i99999;
-  static unsigned long first,qrzero;
+  thread_local dzror_state thread_state;
+  if ( state == NULL ) state = &thread_state;
+
+  double &a = state->a;
+  double &abstol = state->abstol;
+  double &b = state->b;
+  double &c = state->c;
+  double &d = state->d;
+  double &fa = state->fa;
+  double &fb = state->fb;
+  double &fc = state->fc;
+  double &fd = state->fd;
+  double &fda = state->fda;
+  double &fdb = state->fdb;
+  double &m = state->m;
+  double &mb = state->mb;
+  double &p = state->p;
+  double &q = state->q;
+  double &reltol = state->reltol;
+  double &tol = state->tol;
+  double &w = state->w;
+  double &xxhi = state->xxhi;
+  double &xxlo = state->xxlo;
+  int &ext = state->ext;
+  int &i99999 = state->i99999;
+  unsigned long &first = state->first;
+  unsigned long &qrzero = state->qrzero;
     switch(IENTRY){case 0: goto DZROR; case 1: goto DSTZR;}
 DZROR:
     if(*status > 0) goto S280;
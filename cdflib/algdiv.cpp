@@ -27,28 +27,28 @@ double algdiv ( double *a, double *b )
 //    Output, double ALGDIV, the value of ln(Gamma(B)/Gamma(A+B)).
 //
 {
-  static double algdiv;
-  static double c;
-  static double c0 =  0.833333333333333e-01;
-  static double c1 = -0.277777777760991e-02;
-  static double c2 =  0.793650666825390e-03;
-  static double c3 = -0.595202931351870e-03;
-  static double c4 =  0.837308034031215e-03;
-  static double c5 = -0.165322962780713e-02;
-  static double d;
-  static double h;
-  static double s11;
-  static double s3;
-  static double s5;
-  static double s7;
-  static double s9;
-  static double t;
-  static double T1;
-  static double u;
-  static double v;
-  static double w;
-  static double x;
-  static double x2;
+  double algdiv;
+  double c;
+  double c0 =  0.833333333333333e-01;
+  double c1 = -0.277777777760991e-02;
+  double c2 =  0.793650666825390e-03;
+  double c3 = -0.595202931351870e-03;
+  double c4 =  0.837308034031215e-03;
+  double c5 = -0.165322962780713e-02;
+  double d;
+  double h;
+  double s11;
+  double s3;
+  double s5;
+  double s7;
+  double s9;
+  double t;
+  double T1;
+  double u;
+  double v;
+  double w;
+  double x;
+  double x2;
 
   if ( *b <= *a )
   {
@@ -32,8 +32,8 @@ double apser ( double *a, double *b, double *x, double *eps )
 //    incomplete beta ratio.
 //
 {
-  static double g = 0.577215664901533e0;
-  static double apser,aj,bx,c,j,s,t,tol;
+  double g = 0.577215664901533e0;
+  double apser,aj,bx,c,j,s,t,tol;
 
     bx = *b**x;
     t = *x-bx;
@@ -33,13 +33,13 @@ double bcorr ( double *a0, double *b0 )
 //    Output, double *BCORR, the value of the function.
 //
 {
-  static double c0 =  0.833333333333333e-01;
-  static double c1 = -0.277777777760991e-02;
-  static double c2 =  0.793650666825390e-03;
-  static double c3 = -0.595202931351870e-03;
-  static double c4 =  0.837308034031215e-03;
-  static double c5 = -0.165322962780713e-02;
-  static double bcorr,a,b,c,h,s11,s3,s5,s7,s9,t,w,x,x2;
+  double c0 =  0.833333333333333e-01;
+  double c1 = -0.277777777760991e-02;
+  double c2 =  0.793650666825390e-03;
+  double c3 = -0.595202931351870e-03;
+  double c4 =  0.837308034031215e-03;
+  double c5 = -0.165322962780713e-02;
+  double bcorr,a,b,c,h,s11,s3,s5,s7,s9,t,w,x,x2;
 
   a = fifdmin1 ( *a0, *b0 );
   b = fifdmax1 ( *a0, *b0 );
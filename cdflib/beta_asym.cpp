@@ -5,7 +5,8 @@ using namespace std;
 
 //****************************************************************************80
 
-double beta_asym ( double *a, double *b, double *lambda, double *eps )
+double beta_asym ( double *a, double *b, double *lambda, double *eps,
+  const beta_norm *nrm )
 
 //****************************************************************************80
 //
@@ -24,10 +25,13 @@ double beta_asym ( double *a, double *b, double *lambda, double *eps )
 //
 //    Input, double *EPS, the tolerance.
 //
+//    Input, const beta_norm *NRM, the parts that depend on A and B
+//    only, as set by BETA_NORM_INIT, or NULL.
+//
 {
-  static double e0 = 1.12837916709551e0;
-  static double e1 = .353553390593274e0;
-  static int num = 20;
+  double e0 = 1.12837916709551e0;
+  double e1 = .353553390593274e0;
+  int num = 20;
 //
 //  NUM IS THE MAXIMUM VALUE THAT N CAN TAKE IN THE DO LOOP
 //            ENDING AT STATEMENT 50. IT IS REQUIRED THAT NUM BE EVEN.
@@ -35,14 +39,18 @@ double beta_asym ( double *a, double *b, double *lambda, double *eps )
 //     E0 = 2/SQRT(PI)
 //     E1 = 2**(-3/2)
 //
-  static int K3 = 1;
-  static double value;
-  static double bsum,dsum,f,h,h2,hn,j0,j1,r,r0,r1,s,sum,t,t0,t1,u,w,w0,z,z0,
+  int K3 = 1;
+  double value;
+  double bsum,dsum,f,h,h2,hn,j0,j1,r,r0,r1,s,sum,t,t0,t1,u,w,w0,z,z0,
     z2,zn,znm1;
-  static int i,im1,imj,j,m,mm1,mmj,n,np1;
-  static double a0[21],b0[21],c[21],d[21],T1,T2;
+  int i,im1,imj,j,m,mm1,mmj,n,np1;
+  double a0[21],b0[21],c[21],d[21],T1,T2;
+  const double *dd;
+  int pre;
 
     value = 0.0e0;
+    pre = ( nrm != NULL && nrm->a == *a && nrm->b == *b );
+    dd = pre ? nrm->ad : d;
     if(*a >= *b) goto S10;
     h = *a/ *b;
     r0 = 1.0e0/(1.0e0+h);
@@ -68,7 +76,7 @@ S20:
     d[0] = -c[0];
     j0 = 0.5e0/e0 * error_fc ( &K3, &z0 );
     j1 = e1;
-    sum = j0+d[0]*w0*j1;
+    sum = j0+dd[0]*w0*j1;
     s = 1.0e0;
     h2 = h*h;
     hn = 1.0e0;
@@ -77,9 +85,10 @@ S20:
     zn = z2;
     for ( n = 2; n <= num; n += 2 )
     {
+        np1 = n+1;
+        if(pre) goto S70;
         hn = h2*hn;
         a0[n-1] = 2.0e0*r0*(1.0e0+h*hn)/((double)n+2.0e0);
-        np1 = n+1;
         s += hn;
         a0[np1-1] = 2.0e0*r1*s/((double)n+3.0e0);
         for ( i = n; i <= np1; i++ )
@@ -107,19 +116,20 @@ S20:
             }
             d[i-1] = -(dsum+c[i-1]);
         }
+S70:
         j0 = e1*znm1+((double)n-1.0e0)*j0;
         j1 = e1*zn+(double)n*j1;
         znm1 = z2*znm1;
         zn = z2*zn;
         w = w0*w;
-        t0 = d[n-1]*w*j0;
+        t0 = dd[n-1]*w*j0;
         w = w0*w;
-        t1 = d[np1-1]*w*j1;
+        t1 = dd[np1-1]*w*j1;
         sum += (t0+t1);
         if(fabs(t0)+fabs(t1) <= *eps*sum) goto S80;
     }
 S80:
-    u = exp(-bcorr(a,b));
+    u = pre ? nrm->ebcorr : exp(-bcorr(a,b));
     value = e0*t*u*sum;
     return value;
 }
@@ -6,7 +6,7 @@ using namespace std;
 //****************************************************************************80
 
 double beta_frac ( double *a, double *b, double *x, double *y, double *lambda,
-  double *eps )
+  double *eps, const beta_norm *nrm )
 
 //****************************************************************************80
 //
@@ -27,13 +27,16 @@ double beta_frac ( double *a, double *b, double *x, double *y, double *lambda,
 //
 //    Input, double *EPS, a tolerance.
 //
+//    Input, const beta_norm *NRM, the parts that depend on A and B
+//    only, as set by BETA_NORM_INIT, or NULL.
+//
 //    Output, double BETA_FRAC, the value of the continued
 //    fraction approximation for IX(A,B).
 //
 {
-  static double bfrac,alpha,an,anp1,beta,bn,bnp1,c,c0,c1,e,n,p,r,r0,s,t,w,yp1;
+  double bfrac,alpha,an,anp1,beta,bn,bnp1,c,c0,c1,e,n,p,r,r0,s,t,w,yp1;
 
-  bfrac = beta_rcomp ( a, b, x, y );
+  bfrac = beta_rcomp ( a, b, x, y, nrm );
 
   if ( bfrac == 0.0e0 )
   {
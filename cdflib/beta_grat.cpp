@@ -6,7 +6,7 @@ using namespace std;
 //****************************************************************************80
 
 void beta_grat ( double *a, double *b, double *x, double *y, double *w,
-  double *eps,int *ierr )
+  double *eps,int *ierr, const beta_norm *nrm )
 
 //****************************************************************************80
 //
@@ -31,11 +31,15 @@ void beta_grat ( double *a, double *b, double *x, double *y, double *w,
 //    Output, int *IERR, an error flag, which is 0 if no error
 //    was detected.
 //
+//    Input, const beta_norm *NRM, the parts that depend on A and B
+//    only, as set by BETA_NORM_INIT, or NULL.
+//
 {
-  static double bm1,bp2n,cn,coef,dj,j,l,lnx,n2,nu,p,q,r,s,sum,t,t2,u,v,z;
-  static int i,n,nm1;
-  static double c[30],d[30],T1;
+  double bm1,bp2n,cn,coef,dj,j,l,lnx,n2,nu,p,q,r,s,sum,t,t2,u,v,z;
+  int i,n,nm1,pre;
+  double c[30],d[30],T1;
 
+    pre = ( nrm != NULL && nrm->a == *a && nrm->b == *b );
     bm1 = *b-0.5e0-0.5e0;
     nu = *a+0.5e0*bm1;
     if(*y > 0.375e0) goto S10;
@@ -51,13 +55,13 @@ S20:
 //  COMPUTATION OF THE EXPANSION
 //  SET R = EXP(-Z)*Z**B/GAMMA(B)
 //
-    r = *b*(1.0e0+gam1(b))*exp(*b*log(z));
+    r = (pre ? nrm->gr : *b*(1.0e0+gam1(b)))*exp(*b*log(z));
     r *= (exp(*a*lnx)*exp(0.5e0*bm1*lnx));
-    u = algdiv(b,a)+*b*log(nu);
+    u = pre ? nrm->gu : algdiv(b,a)+*b*log(nu);
     u = r*exp(-u);
     if(u == 0.0e0) goto S70;
     gamma_rat1 ( b, &z, &r, &p, &q, eps );
-    v = 0.25e0*pow(1.0e0/nu,2.0);
+    v = pre ? nrm->gv : 0.25e0*pow(1.0e0/nu,2.0);
     t2 = 0.25e0*lnx*lnx;
     l = *w/u;
     j = q/r;
@@ -70,6 +74,10 @@ S20:
         j = (bp2n*(bp2n+1.0e0)*j+(z+bp2n+1.0e0)*t)*v;
         n2 = n2 + 2.0e0;
         t *= t2;
+        if(pre) {
+            d[n-1] = nrm->gd[n-1];
+            goto S50;
+        }
         cn /= (n2*(n2+1.0e0));
         c[n-1] = cn;
         s = 0.0e0;
@@ -83,6 +91,7 @@ S20:
         }
 S40:
         d[n-1] = bm1*cn+s/(double)n;
+S50:
         dj = d[n-1]*j;
         sum = sum + dj;
         if(sum <= 0.0e0) goto S70;
@@ -3,10 +3,13 @@
 using namespace std;
 # include "cdflib.hpp"
 
+static const beta_norm *beta_norm_find ( double a, double b,
+  const beta_norm *nrm, int nnrm );
+
 //****************************************************************************80
 
 void beta_inc ( double *a, double *b, double *x, double *y, double *w,
-  double *w1, int *ierr )
+  double *w1, int *ierr, const beta_norm *nrm, int nnrm )
 
 //****************************************************************************80
 //
@@ -41,16 +44,22 @@ void beta_inc ( double *a, double *b, double *x, double *y, double *w,
 //    6, X = A = 0;
 //    7, Y = B = 0.
 //
+//    Input, const beta_norm *NRM, an array of NNRM sets of parts that
+//    depend on the parameters only, as set by BETA_NORM_INIT, or NULL.
+//    Each of the routines called below is passed the set for its own
+//    parameters, if there is one; the results do not depend on it.
+//
+//    Input, int NNRM, the number of entries of NRM.
+//
 {
-  static int K1 = 1;
-  static double a0,b0,eps,lambda,t,x0,y0,z;
-  static int ierr1,ind,n;
-  static double T2,T3,T4,T5;
+  double a0,b0,eps,lambda,t,x0,y0,z;
+  int ierr1,ind,n;
+  double T2,T3,T4,T5;
 //
 //  EPS IS A MACHINE DEPENDENT CONSTANT. EPS IS THE SMALLEST
 //  NUMBER FOR WHICH 1.0 + EPS .GT. 1.0
 //
-    eps = dpmpar ( &K1 );
+    eps = dpmpar_eps;
     *w = *w1 = 0.0e0;
     if(*a < 0.0e0 || *b < 0.0e0) goto S270;
     if(*a == 0.0e0 && *b == 0.0e0) goto S280;
@@ -138,24 +147,26 @@ S100:
     *w = 0.5e0+(0.5e0-*w1);
     goto S250;
 S110:
-    *w = beta_pser(&a0,&b0,&x0,&eps);
+    *w = beta_pser(&a0,&b0,&x0,&eps,beta_norm_find(a0,b0,nrm,nnrm));
     *w1 = 0.5e0+(0.5e0-*w);
     goto S250;
 S120:
-    *w1 = beta_pser(&b0,&a0,&y0,&eps);
+    *w1 = beta_pser(&b0,&a0,&y0,&eps,beta_norm_find(b0,a0,nrm,nnrm));
     *w = 0.5e0+(0.5e0-*w1);
     goto S250;
 S130:
     T2 = 15.0e0*eps;
-    *w = beta_frac ( &a0,&b0,&x0,&y0,&lambda,&T2 );
+    *w = beta_frac ( &a0,&b0,&x0,&y0,&lambda,&T2,
+      beta_norm_find(a0,b0,nrm,nnrm) );
     *w1 = 0.5e0+(0.5e0-*w);
     goto S250;
 S140:
-    *w1 = beta_up ( &b0, &a0, &y0, &x0, &n, &eps );
+    *w1 = beta_up ( &b0, &a0, &y0, &x0, &n, &eps,
+      beta_norm_find(b0,a0,nrm,nnrm) );
     b0 = b0 + (double)n;
 S150:
     T3 = 15.0e0*eps;
-    beta_grat (&b0,&a0,&y0,&x0,w1,&T3,&ierr1);
+    beta_grat (&b0,&a0,&y0,&x0,w1,&T3,&ierr1,beta_norm_find(b0,a0,nrm,nnrm));
     *w = 0.5e0+(0.5e0-*w1);
     goto S250;
 S160:
@@ -165,24 +176,27 @@ S160:
     n -= 1;
     b0 = 1.0e0;
 S170:
-    *w = beta_up ( &b0, &a0, &y0, &x0, &n, &eps );
+    *w = beta_up ( &b0, &a0, &y0, &x0, &n, &eps,
+      beta_norm_find(b0,a0,nrm,nnrm) );
     if(x0 > 0.7e0) goto S180;
-    *w = *w + beta_pser(&a0,&b0,&x0,&eps);
+    *w = *w + beta_pser(&a0,&b0,&x0,&eps,beta_norm_find(a0,b0,nrm,nnrm));
     *w1 = 0.5e0+(0.5e0-*w);
     goto S250;
 S180:
     if(a0 > 15.0e0) goto S190;
     n = 20;
-    *w = *w + beta_up ( &a0, &b0, &x0, &y0, &n, &eps );
+    *w = *w + beta_up ( &a0, &b0, &x0, &y0, &n, &eps,
+      beta_norm_find(a0,b0,nrm,nnrm) );
     a0 = a0 + (double)n;
 S190:
     T4 = 15.0e0*eps;
-    beta_grat ( &a0, &b0, &x0, &y0, w, &T4, &ierr1 );
+    beta_grat ( &a0, &b0, &x0, &y0, w, &T4, &ierr1,
+      beta_norm_find(a0,b0,nrm,nnrm) );
     *w1 = 0.5e0+(0.5e0-*w);
     goto S250;
 S200:
     T5 = 100.0e0*eps;
-    *w = beta_asym ( &a0, &b0, &lambda, &T5 );
+    *w = beta_asym ( &a0, &b0, &lambda, &T5, beta_norm_find(a0,b0,nrm,nnrm) );
     *w1 = 0.5e0+(0.5e0-*w);
     goto S250;
 S210:
@@ -238,3 +252,37 @@ S330:
     *ierr = 7;
     return;
 }
+//****************************************************************************80
+
+static const beta_norm *beta_norm_find ( double a, double b,
+  const beta_norm *nrm, int nnrm )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    BETA_NORM_FIND returns the entry of NRM that was set for (A,B).
+//
+//  Parameters:
+//
+//    Input, double A, B, the parameters.
+//
+//    Input, const beta_norm *NRM, an array of NNRM entries, or NULL.
+//
+//    Input, int NNRM, the number of entries.
+//
+//    Output, const beta_norm *BETA_NORM_FIND, the entry, or NULL if
+//    there is none.
+//
+{
+  int i;
+
+  for ( i = 0; i < nnrm; i++ )
+  {
+    if ( nrm[i].a == a && nrm[i].b == b )
+    {
+      return nrm + i;
+    }
+  }
+  return NULL;
+}
@@ -0,0 +1,156 @@
+# include <iomanip>
+# include <cmath>
+using namespace std;
+# include "cdflib.hpp"
+
+//****************************************************************************80
+
+void beta_inc_log ( double *a, double *b, double *x, double *y, double *lw,
+  double *lw1, int *ierr )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    BETA_INC_LOG evaluates the logs of IX(A,B) and 1-IX(A,B).
+//
+//  Discussion:
+//
+//    If both results of BETA_INC are above 1.0E-250, their logs are
+//    returned.  Otherwise the small one is IX(A,B), or IY(B,A) by
+//    symmetry, with X below the mean of the distribution, and
+//
+//      IX(A,B) = X**A * Y**B / ( A * BETA(A,B) ) * F,
+//
+//    where F is the continued fraction for the incomplete beta function,
+//    evaluated by Lentz's method; it converges quickly for X below the
+//    mean.  The log of the prefactor comes from BETA_LPDF, which uses the
+//    asymptotic form of BETA_RCOMP when A and B are large.  The log of
+//    the other tail is then minus the small one.
+//
+//  Parameters:
+//
+//    Input, double *A, *B, the parameters of the function.
+//
+//    Input, double *X, *Y, the argument and its complement, as for
+//    BETA_INC.
+//
+//    Output, double *LW, *LW1, the logs of IX(A,B) and 1-IX(A,B).
+//
+//    Output, int *IERR, the error flag of BETA_INC.
+//
+{
+# define cut (1.0e-250)
+# define maxit 10000000
+
+  double aa;
+  double ap;
+  double bp;
+  double c;
+  double d;
+  double del;
+  double h;
+  double lf;
+  double lr;
+  int m;
+  beta_pdf_norm nrm;
+  double pp;
+  double qq;
+  double w;
+  double w1;
+  double xp;
+  double yp;
+
+  beta_inc ( a, b, x, y, &w, &w1, ierr );
+  if ( *ierr != 0 )
+  {
+    return;
+  }
+  if ( ( cut <= w && cut <= w1 ) || *x <= 0.0e0 || *y <= 0.0e0 ||
+    *a <= 0.0e0 || *b <= 0.0e0 )
+  {
+    *lw = log ( w );
+    *lw1 = log ( w1 );
+    return;
+  }
+//
+//  Evaluate the small tail as a lower tail with parameters AP, BP.
+//
+  if ( w <= w1 )
+  {
+    ap = *a;
+    bp = *b;
+    xp = *x;
+    yp = *y;
+  }
+  else
+  {
+    ap = *b;
+    bp = *a;
+    xp = *y;
+    yp = *x;
+  }
+  beta_pdf_init ( &ap, &bp, &nrm );
+  lr = beta_lpdf ( &xp, &yp, &nrm ) + log ( xp ) + log ( yp );
+
+  pp = ap + bp;
+  qq = ap + 1.0e0;
+  c = 1.0e0;
+  d = 1.0e0 - pp * xp / qq;
+  if ( fabs ( d ) < dpmpar_tiny )
+  {
+    d = dpmpar_tiny;
+  }
+  d = 1.0e0 / d;
+  h = d;
+  for ( m = 1; m <= maxit; m++ )
+  {
+    aa = ( double ) m * ( bp - ( double ) m ) * xp
+      / ( ( ap - 1.0e0 + 2.0e0 * m ) * ( ap + 2.0e0 * m ) );
+    d = 1.0e0 + aa * d;
+    if ( fabs ( d ) < dpmpar_tiny )
+    {
+      d = dpmpar_tiny;
+    }
+    c = 1.0e0 + aa / c;
+    if ( fabs ( c ) < dpmpar_tiny )
+    {
+      c = dpmpar_tiny;
+    }
+    d = 1.0e0 / d;
+    h = h * d * c;
+    aa = - ( ap + ( double ) m ) * ( pp + ( double ) m ) * xp
+      / ( ( ap + 2.0e0 * m ) * ( qq + 2.0e0 * m ) );
+    d = 1.0e0 + aa * d;
+    if ( fabs ( d ) < dpmpar_tiny )
+    {
+      d = dpmpar_tiny;
+    }
+    c = 1.0e0 + aa / c;
+    if ( fabs ( c ) < dpmpar_tiny )
+    {
+      c = dpmpar_tiny;
+    }
+    d = 1.0e0 / d;
+    del = d * c;
+    h = h * del;
+    if ( fabs ( del - 1.0e0 ) <= dpmpar_eps )
+    {
+      break;
+    }
+  }
+  lf = lr + log ( h / ap );
+  if ( w <= w1 )
+  {
+    *lw = lf;
+    *lw1 = - exp ( lf );
+  }
+  else
+  {
+    *lw = - exp ( lf );
+    *lw1 = lf;
+  }
+  return;
+# undef cut
+# undef maxit
+}
@@ -30,10 +30,10 @@ double beta_log ( double *a0, double *b0 )
 //    of the Beta function.
 //
 {
-  static double e = .918938533204673e0;
-  static double value,a,b,c,h,u,v,w,z;
-  static int i,n;
-  static double T1;
+  double e = .918938533204673e0;
+  double value,a,b,c,h,u,v,w,z;
+  int i,n;
+  double T1;
 
     a = fifdmin1(*a0,*b0);
     b = fifdmax1(*a0,*b0);
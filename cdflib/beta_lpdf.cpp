@@ -0,0 +1,115 @@
+# include <iomanip>
+# include <cmath>
+using namespace std;
+# include "cdflib.hpp"
+
+//****************************************************************************80
+
+double beta_lpdf ( double *x, double *y, const beta_pdf_norm *nrm )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    BETA_LPDF evaluates the log of the beta density.
+//
+//  Discussion:
+//
+//    The density is X**(A-1) * Y**(B-1) / BETA(A,B), with Y = 1 - X.
+//    Outside [0,1] the log density is -infinity.  At an endpoint it is
+//    +infinity if the exponent there is negative.
+//
+//    As in BETA_RCOMP, whichever of LN(X) and LN(Y) belongs to the
+//    smaller of X and Y is computed directly, and the other through
+//    ALNREL.
+//
+//  Parameters:
+//
+//    Input, double *X, *Y, the argument and 1 - X.
+//
+//    Input, const beta_pdf_norm *NRM, the normalizer for the parameters
+//    A and B, set by BETA_PDF_INIT.
+//
+//    Output, double BETA_LPDF, the log of the density at X.
+//
+{
+  double a;
+  double b;
+  double e;
+  double lambda;
+  double lnx;
+  double lny;
+  double u;
+  double v;
+  double z;
+  double T1;
+
+  a = nrm->a;
+  b = nrm->b;
+  if ( *x < 0.0e0 || *y < 0.0e0 )
+  {
+    return - numeric_limits<double>::infinity ( );
+  }
+  if ( nrm->big )
+  {
+    if ( *x == 0.0e0 || *y == 0.0e0 )
+    {
+      return - numeric_limits<double>::infinity ( );
+    }
+    if ( a <= b )
+    {
+      lambda = a - ( a + b ) * *x;
+    }
+    else
+    {
+      lambda = ( a + b ) * *y - b;
+    }
+    e = - ( lambda / a );
+    if ( fabs ( e ) <= 0.6e0 )
+    {
+      u = rlog1 ( &e );
+    }
+    else
+    {
+      u = e - log ( *x / nrm->x0 );
+    }
+    e = lambda / b;
+    if ( fabs ( e ) <= 0.6e0 )
+    {
+      v = rlog1 ( &e );
+    }
+    else
+    {
+      v = e - log ( *y / nrm->y0 );
+    }
+    return nrm->lnc - ( a * u + b * v ) - log ( *x ) - log ( *y );
+  }
+
+  if ( *x <= 0.375e0 )
+  {
+    lnx = log ( *x );
+    T1 = - *x;
+    lny = alnrel ( &T1 );
+  }
+  else if ( *y <= 0.375e0 )
+  {
+    T1 = - *y;
+    lnx = alnrel ( &T1 );
+    lny = log ( *y );
+  }
+  else
+  {
+    lnx = log ( *x );
+    lny = log ( *y );
+  }
+  z = nrm->lnc;
+  if ( a != 1.0e0 )
+  {
+    z = z + ( a - 1.0e0 ) * lnx;
+  }
+  if ( b != 1.0e0 )
+  {
+    z = z + ( b - 1.0e0 ) * lny;
+  }
+  return z;
+}
@@ -0,0 +1,221 @@
+# include <iomanip>
+# include <cmath>
+using namespace std;
+# include "cdflib.hpp"
+
+//****************************************************************************80
+
+void beta_norm_init ( double *a, double *b, beta_norm *nrm )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    BETA_NORM_INIT computes the parts of the incomplete beta routines
+//    that depend on A and B only.
+//
+//  Discussion:
+//
+//    These are the logarithm of Beta(A,B) or the factors that replace it
+//    when min(A,B) < 1, as used by BETA_PSER, BETA_RCOMP and BETA_RCOMP1;
+//    exp(-BCORR(A,B)) when min(A,B) >= 8; the normalization and the
+//    expansion coefficients of BETA_GRAT when B <= 1 and A >= 8; and the
+//    expansion coefficients of BETA_ASYM when min(A,B) > 100.
+//
+//    Each part is evaluated exactly as the routine that uses it would,
+//    so that passing NRM to that routine for these A and B does not
+//    change its result.  The entries for BETA_GRAT and BETA_ASYM depend
+//    on the order of A and B.
+//
+//  Parameters:
+//
+//    Input, double *A, *B, the parameters of the Beta function.
+//
+//    Output, beta_norm *NRM, the precomputed parts.
+//
+{
+  double a0;
+  double apb;
+  double b0;
+  double bm1;
+  double bsum;
+  double c;
+  double ca[21];
+  double cn;
+  double coef;
+  double cg[30];
+  double dsum;
+  double h;
+  double h2;
+  double hn;
+  int i;
+  int j;
+  int m;
+  int n;
+  double n2;
+  double nu;
+  double r;
+  double r0;
+  double r1;
+  double s;
+  double u;
+  double z;
+  double za[21];
+  double zb[21];
+
+  nrm->a = *a;
+  nrm->b = *b;
+  nrm->lnbeta = nrm->c = nrm->u = nrm->g1 = nrm->t = nrm->ebcorr = 0.0e0;
+  nrm->gr = nrm->gu = nrm->gv = 0.0e0;
+  for ( i = 0; i < 30; i++ )
+  {
+    nrm->gd[i] = 0.0e0;
+  }
+  for ( i = 0; i < 21; i++ )
+  {
+    nrm->ad[i] = 0.0e0;
+  }
+  if ( *a <= 0.0e0 || *b <= 0.0e0 )
+  {
+    return;
+  }
+//
+//  FACTOR X**A*Y**B/BETA(A,B) OF BETA_PSER, BETA_RCOMP, BETA_RCOMP1
+//
+  a0 = fifdmin1 ( *a, *b );
+  b0 = fifdmax1 ( *a, *b );
+  if ( 1.0e0 <= a0 )
+  {
+    nrm->lnbeta = beta_log ( a, b );
+  }
+  else if ( 8.0e0 <= b0 )
+  {
+    nrm->u = gamma_ln1 ( &a0 ) + algdiv ( &a0, &b0 );
+  }
+  else if ( 1.0e0 < b0 )
+  {
+    u = gamma_ln1 ( &a0 );
+    n = ( int ) ( b0 - 1.0e0 );
+    if ( 1 <= n )
+    {
+      c = 1.0e0;
+      for ( i = 1; i <= n; i++ )
+      {
+        b0 -= 1.0e0;
+        c *= ( b0 / ( a0 + b0 ) );
+      }
+      u = log ( c ) + u;
+    }
+    nrm->u = u;
+    b0 -= 1.0e0;
+    apb = a0 + b0;
+    if ( apb <= 1.0e0 )
+    {
+      nrm->t = 1.0e0 + gam1 ( &apb );
+    }
+    else
+    {
+      u = a0 + b0 - 1.e0;
+      nrm->t = ( 1.0e0 + gam1 ( &u ) ) / apb;
+    }
+    nrm->g1 = 1.0e0 + gam1 ( &b0 );
+  }
+  else
+  {
+    apb = *a + *b;
+    if ( apb <= 1.0e0 )
+    {
+      z = 1.0e0 + gam1 ( &apb );
+    }
+    else
+    {
+      u = *a + *b - 1.e0;
+      z = ( 1.0e0 + gam1 ( &u ) ) / apb;
+    }
+    nrm->c = ( 1.0e0 + gam1 ( a ) ) * ( 1.0e0 + gam1 ( b ) ) / z;
+  }
+  if ( 8.0e0 <= a0 )
+  {
+    nrm->ebcorr = exp ( - bcorr ( a, b ) );
+  }
+//
+//  BETA_GRAT: R = B*GAMMA(B+1), ALGDIV AND THE COEFFICIENTS D
+//
+  if ( *b <= 1.0e0 && 8.0e0 <= *a )
+  {
+    bm1 = *b - 0.5e0 - 0.5e0;
+    nu = *a + 0.5e0 * bm1;
+    nrm->gr = *b * ( 1.0e0 + gam1 ( b ) );
+    nrm->gu = algdiv ( b, a ) + *b * log ( nu );
+    nrm->gv = 0.25e0 * pow ( 1.0e0 / nu, 2.0 );
+    cn = 1.0e0;
+    n2 = 0.0e0;
+    for ( n = 1; n <= 30; n++ )
+    {
+      n2 = n2 + 2.0e0;
+      cn /= ( n2 * ( n2 + 1.0e0 ) );
+      cg[n-1] = cn;
+      s = 0.0e0;
+      coef = *b - ( double ) n;
+      for ( i = 1; i <= n - 1; i++ )
+      {
+        s = s + ( coef * cg[i-1] * nrm->gd[n-i-1] );
+        coef = coef + *b;
+      }
+      nrm->gd[n-1] = bm1 * cn + s / ( double ) n;
+    }
+  }
+//
+//  BETA_ASYM: THE COEFFICIENTS D
+//
+  if ( 100.0e0 < a0 )
+  {
+    if ( *a < *b )
+    {
+      h = *a / *b;
+      r1 = ( *b - *a ) / *b;
+    }
+    else
+    {
+      h = *b / *a;
+      r1 = ( *b - *a ) / *a;
+    }
+    r0 = 1.0e0 / ( 1.0e0 + h );
+    za[0] = 2.0e0 / 3.0e0 * r1;
+    ca[0] = - ( 0.5e0 * za[0] );
+    nrm->ad[0] = - ca[0];
+    s = 1.0e0;
+    h2 = h * h;
+    hn = 1.0e0;
+    for ( n = 2; n <= 20; n += 2 )
+    {
+      hn = h2 * hn;
+      za[n-1] = 2.0e0 * r0 * ( 1.0e0 + h * hn ) / ( ( double ) n + 2.0e0 );
+      s += hn;
+      za[n] = 2.0e0 * r1 * s / ( ( double ) n + 3.0e0 );
+      for ( i = n; i <= n + 1; i++ )
+      {
+        r = - ( 0.5e0 * ( ( double ) i + 1.0e0 ) );
+        zb[0] = r * za[0];
+        for ( m = 2; m <= i; m++ )
+        {
+          bsum = 0.0e0;
+          for ( j = 1; j <= m - 1; j++ )
+          {
+            bsum += ( ( ( double ) j * r - ( double ) ( m - j ) ) * za[j-1]
+              * zb[m-j-1] );
+          }
+          zb[m-1] = r * za[m-1] + bsum / ( double ) m;
+        }
+        ca[i-1] = zb[i-1] / ( ( double ) i + 1.0e0 );
+        dsum = 0.0e0;
+        for ( j = 1; j <= i - 1; j++ )
+        {
+          dsum += ( nrm->ad[i-j-1] * ca[j-1] );
+        }
+        nrm->ad[i-1] = - ( dsum + ca[i-1] );
+      }
+    }
+  }
+  return;
+}
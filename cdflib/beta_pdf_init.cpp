@@ -0,0 +1,57 @@
+# include <iomanip>
+# include <cmath>
+using namespace std;
+# include "cdflib.hpp"
+
+//****************************************************************************80
+
+void beta_pdf_init ( double *a, double *b, beta_pdf_norm *nrm )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    BETA_PDF_INIT sets up the log-normalizer of the beta density.
+//
+//  Discussion:
+//
+//    If min(A,B) < 8, the normalizer is -BETA_LOG(A,B).  Otherwise
+//    BETA_LPDF follows the asymptotic form of BETA_RCOMP, and the
+//    normalizer is the log of SQRT(B*X0/(2*PI))*exp(-BCORR(A,B)), where
+//    X0 = A/(A+B) is the mean.
+//
+//  Parameters:
+//
+//    Input, double *A, *B, the parameters, positive.
+//
+//    Output, beta_pdf_norm *NRM, the normalizer, for BETA_LPDF.
+//
+{
+  double Const = .398942280401433e0;
+  double h;
+
+  nrm->a = *a;
+  nrm->b = *b;
+  nrm->x0 = nrm->y0 = 0.0e0;
+  if ( fifdmin1 ( *a, *b ) < 8.0e0 )
+  {
+    nrm->big = 0;
+    nrm->lnc = - beta_log ( a, b );
+    return;
+  }
+  nrm->big = 1;
+  if ( *a <= *b )
+  {
+    h = *a / *b;
+    nrm->x0 = h / ( 1.0e0 + h );
+    nrm->y0 = 1.0e0 / ( 1.0e0 + h );
+  }
+  else
+  {
+    h = *b / *a;
+    nrm->x0 = 1.0e0 / ( 1.0e0 + h );
+    nrm->y0 = h / ( 1.0e0 + h );
+  }
+  nrm->lnc = log ( Const ) + 0.5e0 * log ( *b * nrm->x0 ) - bcorr ( a, b );
+  return;
+}
@@ -5,7 +5,8 @@ using namespace std;
 
 //****************************************************************************80
 
-double beta_pser ( double *a, double *b, double *x, double *eps )
+double beta_pser ( double *a, double *b, double *x, double *eps,
+  const beta_norm *nrm )
 
 //****************************************************************************80
 //
@@ -26,20 +27,24 @@ double beta_pser ( double *a, double *b, double *x, double *eps )
 //
 //    Input, double *EPS, the tolerance.
 //
+//    Input, const beta_norm *NRM, the parts that depend on A and B
+//    only, as set by BETA_NORM_INIT, or NULL.
+//
 //    Output, double BETA_PSER, the approximate value of IX(A,B)(X).
 //
 {
-  static double bpser,a0,apb,b0,c,n,sum,t,tol,u,w,z;
-  static int i,m;
+  double bpser,a0,apb,b0,c,n,sum,t,tol,u,w,z;
+  int i,m,pre;
 
     bpser = 0.0e0;
     if(*x == 0.0e0) return bpser;
+    pre = ( nrm != NULL && nrm->a == *a && nrm->b == *b );
 //
 //  COMPUTE THE FACTOR X**A/(A*BETA(A,B))
 //
     a0 = fifdmin1(*a,*b);
     if(a0 < 1.0e0) goto S10;
-    z = *a*log(*x)-beta_log(a,b);
+    z = *a*log(*x)-(pre ? nrm->lnbeta : beta_log(a,b));
     bpser = exp(z)/ *a;
     goto S100;
 S10:
@@ -52,6 +57,10 @@ S10:
     bpser = pow(*x,*a);
     if(bpser == 0.0e0) return bpser;
     apb = *a+*b;
+    if(pre) {
+        c = nrm->c;
+        goto S35;
+    }
     if(apb > 1.0e0) goto S20;
     z = 1.0e0+gam1(&apb);
     goto S30;
@@ -60,12 +69,18 @@ S20:
     z = (1.0e0+gam1(&u))/apb;
 S30:
     c = (1.0e0+gam1(a))*(1.0e0+gam1(b))/z;
+S35:
     bpser *= (c*(*b/apb));
     goto S100;
 S40:
 //
 //  PROCEDURE FOR A0 .LT. 1 AND 1 .LT. B0 .LT. 8
 //
+    if(pre) {
+        z = *a*log(*x)-nrm->u;
+        bpser = exp(z)*(a0/ *a)*nrm->g1/nrm->t;
+        goto S100;
+    }
     u = gamma_ln1 ( &a0 );
     m = ( int ) ( b0 - 1.0e0 );
     if(m < 1) goto S60;
@@ -93,7 +108,7 @@ S90:
 //
 //  PROCEDURE FOR A0 .LT. 1 AND B0 .GE. 8
 //
-    u = gamma_ln1 ( &a0 ) + algdiv ( &a0, &b0 );
+    u = pre ? nrm->u : gamma_ln1 ( &a0 ) + algdiv ( &a0, &b0 );
     z = *a*log(*x)-u;
     bpser = a0/ *a*exp(z);
 S100:
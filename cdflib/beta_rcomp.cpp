@@ -5,7 +5,8 @@ using namespace std;
 
 //****************************************************************************80
 
-double beta_rcomp ( double *a, double *b, double *x, double *y )
+double beta_rcomp ( double *a, double *b, double *x, double *y,
+  const beta_norm *nrm )
 
 //****************************************************************************80
 //
@@ -20,19 +21,23 @@ double beta_rcomp ( double *a, double *b, double *x, double *y )
 //
 //    Input, double *X, *Y, define the numerator of the fraction.
 //
+//    Input, const beta_norm *NRM, the parts that depend on A and B
+//    only, as set by BETA_NORM_INIT, or NULL.
+//
 //    Output, double BETA_RCOMP, the value of X**A * Y**B / Beta(A,B).
 //
 {
-  static double Const = .398942280401433e0;
-  static double brcomp,a0,apb,b0,c,e,h,lambda,lnx,lny,t,u,v,x0,y0,z;
-  static int i,n;
+  double Const = .398942280401433e0;
+  double brcomp,a0,apb,b0,c,e,h,lambda,lnx,lny,t,u,v,x0,y0,z;
+  int i,n,pre;
 //
 //  CONST = 1/SQRT(2*PI)
 //
-  static double T1,T2;
+  double T1,T2;
 
     brcomp = 0.0e0;
     if(*x == 0.0e0 || *y == 0.0e0) return brcomp;
+    pre = ( nrm != NULL && nrm->a == *a && nrm->b == *b );
     a0 = fifdmin1(*a,*b);
     if(a0 >= 8.0e0) goto S130;
     if(*x > 0.375e0) goto S10;
@@ -52,7 +57,7 @@ S20:
 S30:
     z = *a*lnx+*b*lny;
     if(a0 < 1.0e0) goto S40;
-    z -= beta_log(a,b);
+    z -= pre ? nrm->lnbeta : beta_log(a,b);
     brcomp = exp(z);
     return brcomp;
 S40:
@@ -67,6 +72,10 @@ S40:
 //
     brcomp = exp(z);
     if(brcomp == 0.0e0) return brcomp;
+    if(pre) {
+        c = nrm->c;
+        goto S65;
+    }
     apb = *a+*b;
     if(apb > 1.0e0) goto S50;
     z = 1.0e0+gam1(&apb);
@@ -76,12 +85,18 @@ S50:
     z = (1.0e0+gam1(&u))/apb;
 S60:
     c = (1.0e0+gam1(a))*(1.0e0+gam1(b))/z;
+S65:
     brcomp = brcomp*(a0*c)/(1.0e0+a0/b0);
     return brcomp;
 S70:
 //
 //  ALGORITHM FOR 1 .LT. B0 .LT. 8
 //
+    if(pre) {
+        z -= nrm->u;
+        brcomp = a0*exp(z)*nrm->g1/nrm->t;
+        return brcomp;
+    }
     u = gamma_ln1 ( &a0 );
     n = ( int ) ( b0 - 1.0e0 );
     if(n < 1) goto S90;
@@ -109,7 +124,7 @@ S120:
 //
 //  ALGORITHM FOR B0 .GE. 8
 //
-    u = gamma_ln1 ( &a0 ) + algdiv ( &a0, &b0 );
+    u = pre ? nrm->u : gamma_ln1 ( &a0 ) + algdiv ( &a0, &b0 );
     brcomp = a0*exp(z-u);
     return brcomp;
 S130:
@@ -143,6 +158,6 @@ S180:
     v = e-log(*y/y0);
 S190:
     z = exp(-(*a*u+*b*v));
-    brcomp = Const*sqrt(*b*x0)*z*exp(-bcorr(a,b));
+    brcomp = Const*sqrt(*b*x0)*z*(pre ? nrm->ebcorr : exp(-bcorr(a,b)));
     return brcomp;
 }
@@ -5,7 +5,8 @@ using namespace std;
 
 //****************************************************************************80
 
-double beta_rcomp1 ( int *mu, double *a, double *b, double *x, double *y )
+double beta_rcomp1 ( int *mu, double *a, double *b, double *x, double *y,
+  const beta_norm *nrm )
 
 //****************************************************************************80
 //
@@ -22,18 +23,22 @@ double beta_rcomp1 ( int *mu, double *a, double *b, double *x, double *y )
 //
 //    Input, double X, Y, ?
 //
+//    Input, const beta_norm *NRM, the parts that depend on A and B
+//    only, as set by BETA_NORM_INIT, or NULL.
+//
 //    Output, double BETA_RCOMP1, the value of
 //    exp(MU) * X**A * Y**B / Beta(A,B).
 //
 {
-  static double Const = .398942280401433e0;
-  static double brcmp1,a0,apb,b0,c,e,h,lambda,lnx,lny,t,u,v,x0,y0,z;
-  static int i,n;
+  double Const = .398942280401433e0;
+  double brcmp1,a0,apb,b0,c,e,h,lambda,lnx,lny,t,u,v,x0,y0,z;
+  int i,n,pre;
 //
 //     CONST = 1/SQRT(2*PI)
 //
-  static double T1,T2,T3,T4;
+  double T1,T2,T3,T4;
 
+    pre = ( nrm != NULL && nrm->a == *a && nrm->b == *b );
     a0 = fifdmin1(*a,*b);
     if(a0 >= 8.0e0) goto S130;
     if(*x > 0.375e0) goto S10;
@@ -53,7 +58,7 @@ S20:
 S30:
     z = *a*lnx+*b*lny;
     if(a0 < 1.0e0) goto S40;
-    z -= beta_log(a,b);
+    z -= pre ? nrm->lnbeta : beta_log(a,b);
     brcmp1 = esum(mu,&z);
     return brcmp1;
 S40:
@@ -68,6 +73,10 @@ S40:
 //
     brcmp1 = esum(mu,&z);
     if(brcmp1 == 0.0e0) return brcmp1;
+    if(pre) {
+        c = nrm->c;
+        goto S65;
+    }
     apb = *a+*b;
     if(apb > 1.0e0) goto S50;
     z = 1.0e0+gam1(&apb);
@@ -77,12 +86,18 @@ S50:
     z = (1.0e0+gam1(&u))/apb;
 S60:
     c = (1.0e0+gam1(a))*(1.0e0+gam1(b))/z;
+S65:
     brcmp1 = brcmp1*(a0*c)/(1.0e0+a0/b0);
     return brcmp1;
 S70:
 //
 //  ALGORITHM FOR 1 .LT. B0 .LT. 8
 //
+    if(pre) {
+        z -= nrm->u;
+        brcmp1 = a0*esum(mu,&z)*nrm->g1/nrm->t;
+        return brcmp1;
+    }
     u = gamma_ln1 ( &a0 );
     n = ( int ) ( b0 - 1.0e0 );
     if(n < 1) goto S90;
@@ -110,7 +125,7 @@ S120:
 //
 //  ALGORITHM FOR B0 .GE. 8
 //
-    u = gamma_ln1 ( &a0 ) + algdiv ( &a0, &b0 );
+    u = pre ? nrm->u : gamma_ln1 ( &a0 ) + algdiv ( &a0, &b0 );
     T3 = z-u;
     brcmp1 = a0*esum(mu,&T3);
     return brcmp1;
@@ -146,6 +161,6 @@ S180:
 S190:
     T4 = -(*a*u+*b*v);
     z = esum(mu,&T4);
-    brcmp1 = Const*sqrt(*b*x0)*z*exp(-bcorr(a,b));
+    brcmp1 = Const*sqrt(*b*x0)*z*(pre ? nrm->ebcorr : exp(-bcorr(a,b)));
     return brcmp1;
 }
@@ -6,7 +6,7 @@ using namespace std;
 //****************************************************************************80
 
 double beta_up ( double *a, double *b, double *x, double *y, int *n,
-  double *eps )
+  double *eps, const beta_norm *nrm )
 
 //****************************************************************************80
 //
@@ -25,13 +25,14 @@ double beta_up ( double *a, double *b, double *x, double *y, int *n,
 //
 //    Input, double *EPS, the tolerance.
 //
+//    Input, const beta_norm *NRM, the parts that depend on A and B
+//    only, as set by BETA_NORM_INIT, or NULL.
+//
 //    Output, double BETA_UP, the value of IX(A,B) - IX(A+N,B).
 //
 {
-  static int K1 = 1;
-  static int K2 = 0;
-  static double bup,ap1,apb,d,l,r,t,w;
-  static int i,k,kp1,mu,nm1;
+  double bup,ap1,apb,d,l,r,t,w;
+  int i,k,kp1,mu,nm1;
 //
 //  OBTAIN THE SCALING FACTOR EXP(-MU) AND
 //  EXP(MU)*(X**A*Y**B/BETA(A,B))/A
@@ -42,13 +43,13 @@ double beta_up ( double *a, double *b, double *x, double *y, int *n,
     d = 1.0e0;
     if(*n == 1 || *a < 1.0e0) goto S10;
     if(apb < 1.1e0*ap1) goto S10;
-    mu = ( int ) fabs ( exparg(&K1) );
-    k = ( int ) exparg ( &K2 );
+    mu = ( int ) fabs ( exparg_min );
+    k = ( int ) exparg_max;
     if(k < mu) mu = k;
     t = mu;
     d = exp(-t);
 S10:
-    bup = beta_rcomp1 ( &mu, a, b, x, y ) / *a;
+    bup = beta_rcomp1 ( &mu, a, b, x, y, nrm ) / *a;
     if(*n == 1 || bup == 0.0e0) return bup;
     nm1 = *n-1;
     w = d;
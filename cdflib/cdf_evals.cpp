@@ -0,0 +1,32 @@
+# include <iomanip>
+# include <cmath>
+using namespace std;
+# include "cdflib.hpp"
+
+thread_local int cdf_eval_count = 0;
+
+//****************************************************************************80
+
+int cdf_evals ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    CDF_EVALS reports the cost of the last inversion on this thread.
+//
+//  Discussion:
+//
+//    DSTINV, DSTZR and DSTINH reset the count, and every return of DINVR,
+//    DZROR or DINVH with STATUS = 1 adds one to it.  After a call of one
+//    of the CDF* routines that solves for a value, this is the number of
+//    evaluations of the cumulative distribution that the solve took.
+//
+//  Parameters:
+//
+//    Output, int CDF_EVALS, the number of function evaluations requested
+//    since the last search was started.
+//
+{
+  return cdf_eval_count;
+}
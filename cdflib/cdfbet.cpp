@@ -92,14 +92,15 @@ void cdfbet ( int *which, double *p, double *q, double *x, double *y,
 # define inf 1.0e300
 # define one 1.0e0
 
-  static int K1 = 1;
-  static double K2 = 0.0e0;
-  static double K3 = 1.0e0;
-  static double K8 = 0.5e0;
-  static double K9 = 5.0e0;
-  static double fx,xhi,xlo,cum,ccum,xy,pq;
-  static unsigned long qhi,qleft,qporq;
-  static double T4,T5,T6,T7,T10,T11,T12,T13,T14,T15;
+  double K2 = 0.0e0;
+  double K3 = 1.0e0;
+  double K8 = 0.5e0;
+  double K9 = 5.0e0;
+  double fx,xhi,xlo,cum,ccum,xy,pq;
+  unsigned long qhi,qleft,qporq;
+  dinvr_state istate;
+  dzror_state zstate;
+  double T4,T5,T6,T7,T10,T11,T12,T13,T14,T15;
 
   *status = 0;
   *bound = 0.0;
@@ -201,7 +202,7 @@ S220:
 //     P + Q
 //
     pq = *p+*q;
-    if(!(fabs(pq-0.5e0-0.5e0) > 3.0e0 * dpmpar ( &K1 ) ) ) goto S260;
+    if(!(fabs(pq-0.5e0-0.5e0) > 3.0e0 * dpmpar_eps ) ) goto S260;
     if(!(pq < 0.0e0)) goto S240;
     *bound = 0.0e0;
     goto S250;
@@ -217,7 +218,7 @@ S260:
 //     X + Y
 //
     xy = *x+*y;
-    if(!(fabs(xy-0.5e0-0.5e0) > 3.0e0 * dpmpar ( &K1 ) ) ) goto S300;
+    if(!(fabs(xy-0.5e0-0.5e0) > 3.0e0 * dpmpar_eps ) ) goto S300;
     if(!(xy < 0.0e0)) goto S280;
     *bound = 0.0e0;
     goto S290;
@@ -246,29 +247,29 @@ S300:
 //
         T4 = atol;
         T5 = tol;
-        dstzr(&K2,&K3,&T4,&T5);
+        dstzr(&zstate,&K2,&K3,&T4,&T5);
         if(!qporq) goto S340;
         *status = 0;
-        dzror(status,x,&fx,&xlo,&xhi,&qleft,&qhi);
+        dzror(&zstate,status,x,&fx,&xlo,&xhi,&qleft,&qhi);
         *y = one-*x;
 S320:
         if(!(*status == 1)) goto S330;
         cumbet(x,y,a,b,&cum,&ccum);
         fx = cum-*p;
-        dzror(status,x,&fx,&xlo,&xhi,&qleft,&qhi);
+        dzror(&zstate,status,x,&fx,&xlo,&xhi,&qleft,&qhi);
         *y = one-*x;
         goto S320;
 S330:
         goto S370;
 S340:
         *status = 0;
-        dzror(status,y,&fx,&xlo,&xhi,&qleft,&qhi);
+        dzror(&zstate,status,y,&fx,&xlo,&xhi,&qleft,&qhi);
         *x = one-*y;
 S350:
         if(!(*status == 1)) goto S360;
         cumbet(x,y,a,b,&cum,&ccum);
         fx = ccum-*q;
-        dzror(status,y,&fx,&xlo,&xhi,&qleft,&qhi);
+        dzror(&zstate,status,y,&fx,&xlo,&xhi,&qleft,&qhi);
         *x = one-*y;
         goto S350;
 S370:
@@ -294,9 +295,9 @@ S390:
         T7 = inf;
         T10 = atol;
         T11 = tol;
-        dstinv(&T6,&T7,&K8,&K8,&K9,&T10,&T11);
+        dstinv(&istate,&T6,&T7,&K8,&K8,&K9,&T10,&T11);
         *status = 0;
-        dinvr(status,a,&fx,&qleft,&qhi);
+        dinvr(&istate,status,a,&fx,&qleft,&qhi);
 S410:
         if(!(*status == 1)) goto S440;
         cumbet(x,y,a,b,&cum,&ccum);
@@ -306,7 +307,7 @@ S410:
 S420:
         fx = ccum-*q;
 S430:
-        dinvr(status,a,&fx,&qleft,&qhi);
+        dinvr(&istate,status,a,&fx,&qleft,&qhi);
         goto S410;
 S440:
         if(!(*status == -1)) goto S470;
@@ -330,9 +331,9 @@ S460:
         T13 = inf;
         T14 = atol;
         T15 = tol;
-        dstinv(&T12,&T13,&K8,&K8,&K9,&T14,&T15);
+        dstinv(&istate,&T12,&T13,&K8,&K8,&K9,&T14,&T15);
         *status = 0;
-        dinvr(status,b,&fx,&qleft,&qhi);
+        dinvr(&istate,status,b,&fx,&qleft,&qhi);
 S480:
         if(!(*status == 1)) goto S510;
         cumbet(x,y,a,b,&cum,&ccum);
@@ -342,7 +343,7 @@ S480:
 S490:
         fx = ccum-*q;
 S500:
-        dinvr(status,b,&fx,&qleft,&qhi);
+        dinvr(&istate,status,b,&fx,&qleft,&qhi);
         goto S480;
 S510:
         if(!(*status == -1)) goto S540;
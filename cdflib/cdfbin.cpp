@@ -92,14 +92,16 @@ void cdfbin ( int *which, double *p, double *q, double *s, double *xn,
 # define inf 1.0e300
 # define one 1.0e0
 
-  static int K1 = 1;
-  static double K2 = 0.0e0;
-  static double K3 = 0.5e0;
-  static double K4 = 5.0e0;
-  static double K11 = 1.0e0;
-  static double fx,xhi,xlo,cum,ccum,pq,prompr;
-  static unsigned long qhi,qleft,qporq;
-  static double T5,T6,T7,T8,T9,T10,T12,T13;
+  double K2 = 0.0e0;
+  double K3 = 0.5e0;
+  double K4 = 5.0e0;
+  double K11 = 1.0e0;
+  double fx,cum,ccum,pq,prompr;
+  unsigned long qhi,qleft,qporq;
+  dinvr_state istate;
+  dinvh_state hstate;
+  double alpha,beta,dfx,d2fx,lnc,omx0,x0,T14,T15,T16;
+  double T5,T6,T7,T8,T9,T10,T12,T13;
 
   *status = 0;
   *bound = 0.0;
@@ -206,7 +208,7 @@ S240:
 //     P + Q
 //
     pq = *p+*q;
-    if(!(fabs(pq-0.5e0-0.5e0) > 3.0e0 * dpmpar ( &K1 ) ) ) goto S280;
+    if(!(fabs(pq-0.5e0-0.5e0) > 3.0e0 * dpmpar_eps ) ) goto S280;
     if(!(pq < 0.0e0)) goto S260;
     *bound = 0.0e0;
     goto S270;
@@ -222,7 +224,7 @@ S280:
 //     PR + OMPR
 //
     prompr = *pr+*ompr;
-    if(!(fabs(prompr-0.5e0-0.5e0) > 3.0e0 * dpmpar ( &K1 ) ) ) goto S320;
+    if(!(fabs(prompr-0.5e0-0.5e0) > 3.0e0 * dpmpar_eps ) ) goto S320;
     if(!(prompr < 0.0e0)) goto S300;
     *bound = 0.0e0;
     goto S310;
@@ -249,12 +251,15 @@ S320:
 //
 //     Calculating S
 //
-        *s = 5.0e0;
+//     The search starts at 5, or at XN when that is smaller, so that the
+//     start lies within [0,XN].
+//
+        *s = fifdmin1 ( 5.0e0, *xn );
         T5 = atol;
         T6 = tol;
-        dstinv(&K2,xn,&K3,&K3,&K4,&T5,&T6);
+        dstinv(&istate,&K2,xn,&K3,&K3,&K4,&T5,&T6);
         *status = 0;
-        dinvr(status,s,&fx,&qleft,&qhi);
+        dinvr(&istate,status,s,&fx,&qleft,&qhi);
 S340:
         if(!(*status == 1)) goto S370;
         cumbin(s,xn,pr,ompr,&cum,&ccum);
@@ -264,7 +269,7 @@ S340:
 S350:
         fx = ccum-*q;
 S360:
-        dinvr(status,s,&fx,&qleft,&qhi);
+        dinvr(&istate,status,s,&fx,&qleft,&qhi);
         goto S340;
 S370:
         if(!(*status == -1)) goto S400;
@@ -288,9 +293,9 @@ S390:
         T8 = inf;
         T9 = atol;
         T10 = tol;
-        dstinv(&T7,&T8,&K3,&K3,&K4,&T9,&T10);
+        dstinv(&istate,&T7,&T8,&K3,&K3,&K4,&T9,&T10);
         *status = 0;
-        dinvr(status,xn,&fx,&qleft,&qhi);
+        dinvr(&istate,status,xn,&fx,&qleft,&qhi);
 S410:
         if(!(*status == 1)) goto S440;
         cumbin(s,xn,pr,ompr,&cum,&ccum);
@@ -300,7 +305,7 @@ S410:
 S420:
         fx = ccum-*q;
 S430:
-        dinvr(status,xn,&fx,&qleft,&qhi);
+        dinvr(&istate,status,xn,&fx,&qleft,&qhi);
         goto S410;
 S440:
         if(!(*status == -1)) goto S470;
@@ -318,32 +323,56 @@ S460:
     else if(4 == *which) {
 //
 //     Calculating PR and OMPR
-//
+//     .. CCUM is the Beta(S+1,XN-S) CDF in PR, so start from the
+//        beta approximation and use the beta density
+//
+        alpha = *s+1.0e0;
+        beta = *xn-*s;
+        if(beta > 0.0e0) {
+            lnc = -beta_log(&alpha,&beta);
+            T14 = 2.0e0*alpha;
+            T15 = 2.0e0*beta;
+            T16 = alpha*stvalf(&T14,&T15,q,p);
+            x0 = T16/(beta+T16);
+            omx0 = beta/(beta+T16);
+        }
+        else {
+            lnc = 0.0e0;
+            x0 = omx0 = 0.5e0;
+        }
         T12 = atol;
         T13 = tol;
-        dstzr(&K2,&K11,&T12,&T13);
-        if(!qporq) goto S500;
+        dstinh(&hstate,&K2,&K11,&T12,&T13);
+        if(!(x0 <= omx0)) goto S500;
+        *pr = x0;
         *status = 0;
-        dzror(status,pr,&fx,&xlo,&xhi,&qleft,&qhi);
+        dinvh(&hstate,status,pr,&fx,&dfx,&d2fx,&qleft,&qhi);
         *ompr = one-*pr;
 S480:
         if(!(*status == 1)) goto S490;
         cumbin(s,xn,pr,ompr,&cum,&ccum);
-        fx = cum-*p;
-        dzror(status,pr,&fx,&xlo,&xhi,&qleft,&qhi);
+        dfx = exp(lnc+(alpha-1.0e0)*log(*pr)+(beta-1.0e0)*log(*ompr));
+        d2fx = dfx*((alpha-1.0e0)/ *pr-(beta-1.0e0)/ *ompr);
+        if(qporq) dlnres(&cum,p,0,&fx,&dfx,&d2fx);
+        else dlnres(&ccum,q,1,&fx,&dfx,&d2fx);
+        dinvh(&hstate,status,pr,&fx,&dfx,&d2fx,&qleft,&qhi);
         *ompr = one-*pr;
         goto S480;
 S490:
         goto S530;
 S500:
+        *ompr = omx0;
         *status = 0;
-        dzror(status,ompr,&fx,&xlo,&xhi,&qleft,&qhi);
+        dinvh(&hstate,status,ompr,&fx,&dfx,&d2fx,&qleft,&qhi);
         *pr = one-*ompr;
 S510:
         if(!(*status == 1)) goto S520;
         cumbin(s,xn,pr,ompr,&cum,&ccum);
-        fx = ccum-*q;
-        dzror(status,ompr,&fx,&xlo,&xhi,&qleft,&qhi);
+        dfx = exp(lnc+(alpha-1.0e0)*log(*pr)+(beta-1.0e0)*log(*ompr));
+        d2fx = -(dfx*((alpha-1.0e0)/ *pr-(beta-1.0e0)/ *ompr));
+        if(qporq) dlnres(&cum,p,1,&fx,&dfx,&d2fx);
+        else dlnres(&ccum,q,0,&fx,&dfx,&d2fx);
+        dinvh(&hstate,status,ompr,&fx,&dfx,&d2fx,&qleft,&qhi);
         *pr = one-*ompr;
         goto S510;
 S530:
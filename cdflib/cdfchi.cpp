@@ -24,7 +24,9 @@ void cdfchi ( int *which, double *p, double *q, double *x, double *df,
 //
 //    Computation of the other parameters involves a seach for a value that
 //    produces the desired value of P.  The search relies on the
-//    monotonicity of P with respect to the other parameters.
+//    monotonicity of P with respect to the other parameters.  X is the
+//    exception: it is twice the inverse incomplete gamma ratio, which
+//    GAMMA_INC_INV usually computes without a search.
 //
 //    The CDF of the chi square distribution can be evaluated
 //    within Mathematica by commands such as:
@@ -87,13 +89,15 @@ void cdfchi ( int *which, double *p, double *q, double *x, double *df,
 # define zero (1.0e-300)
 # define inf 1.0e300
 
-  static int K1 = 1;
-  static double K2 = 0.0e0;
-  static double K4 = 0.5e0;
-  static double K5 = 5.0e0;
-  static double fx,cum,ccum,pq,porq;
-  static unsigned long qhi,qleft,qporq;
-  static double T3,T6,T7,T8,T9,T10,T11;
+  double K2 = 0.0e0;
+  double K4 = 0.5e0;
+  double K5 = 5.0e0;
+  double fx,dfx,d2fx,cum,ccum,hdf,lnc,pq,porq = 0.0e0,xx;
+  int ierr;
+  unsigned long qhi,qleft,qporq;
+  dinvr_state istate;
+  dinvh_state hstate;
+  double T2,T3,T6,T7,T8,T9,T10,T11;
 
   *status = 0;
   *bound = 0.0;
@@ -165,7 +169,7 @@ S140:
 //     P + Q
 //
     pq = *p+*q;
-    if(!(fabs(pq-0.5e0-0.5e0) > 3.0e0 * dpmpar ( &K1 ) ) ) goto S180;
+    if(!(fabs(pq-0.5e0-0.5e0) > 3.0e0 * dpmpar_eps ) ) goto S180;
     if(!(pq < 0.0e0)) goto S160;
     *bound = 0.0e0;
     goto S170;
@@ -205,28 +209,49 @@ S210:
     else if(2 == *which) {
 //
 //     Calculating X
-//
-        *x = 5.0e0;
+//     .. X/2 is the inverse incomplete gamma ratio at P, which
+//        GAMMA_INC_INV finds directly unless P or Q is too small for
+//        its Schroder iteration.  Then start a search from its estimate,
+//        or from the Wilson-Hilferty approximation, and get the log of
+//        the normalization of the density
+//
+        hdf = 0.5e0**df;
+        T2 = -1.0e0;
+        gamma_inc_inv(&hdf,&xx,&T2,p,q,&ierr);
+        *x = 2.0e0*xx;
+        if(!(ierr >= 0 && *x <= inf)) goto S225;
+        cdf_eval_count = ierr;
+        *status = 0;
+        return;
+S225:
+        if(!(*x > 0.0e0 && *x <= inf)) *x = 2.0e0*stvalg(&hdf,p,q);
+        lnc = -(gamma_log(&hdf)+hdf*log(2.0e0));
         T3 = inf;
         T6 = atol;
         T7 = tol;
-        dstinv(&K2,&T3,&K4,&K4,&K5,&T6,&T7);
+        dstinh(&hstate,&K2,&T3,&T6,&T7);
         *status = 0;
-        dinvr(status,x,&fx,&qleft,&qhi);
+        dinvh(&hstate,status,x,&fx,&dfx,&d2fx,&qleft,&qhi);
 S230:
         if(!(*status == 1)) goto S270;
         cumchi(x,df,&cum,&ccum);
+        dfx = exp(lnc+(hdf-1.0e0)*log(*x)-0.5e0**x);
+        d2fx = dfx*((hdf-1.0e0)/ *x-0.5e0);
         if(!qporq) goto S240;
-        fx = cum-*p;
+        if(!(cum > 1.5e0)) goto S235;
+        *status = 10;
+        return;
+S235:
+        dlnres(&cum,p,1,&fx,&dfx,&d2fx);
         goto S250;
 S240:
-        fx = ccum-*q;
-S250:
-        if(!(fx+porq > 1.5e0)) goto S260;
+        if(!(ccum > 1.5e0)) goto S245;
         *status = 10;
         return;
-S260:
-        dinvr(status,x,&fx,&qleft,&qhi);
+S245:
+        dlnres(&ccum,q,0,&fx,&dfx,&d2fx);
+S250:
+        dinvh(&hstate,status,x,&fx,&dfx,&d2fx,&qleft,&qhi);
         goto S230;
 S270:
         if(!(*status == -1)) goto S300;
@@ -250,9 +275,9 @@ S290:
         T9 = inf;
         T10 = atol;
         T11 = tol;
-        dstinv(&T8,&T9,&K4,&K4,&K5,&T10,&T11);
+        dstinv(&istate,&T8,&T9,&K4,&K4,&K5,&T10,&T11);
         *status = 0;
-        dinvr(status,df,&fx,&qleft,&qhi);
+        dinvr(&istate,status,df,&fx,&qleft,&qhi);
 S310:
         if(!(*status == 1)) goto S350;
         cumchi(x,df,&cum,&ccum);
@@ -266,7 +291,7 @@ S330:
         *status = 10;
         return;
 S340:
-        dinvr(status,df,&fx,&qleft,&qhi);
+        dinvr(&istate,status,df,&fx,&qleft,&qhi);
         goto S310;
 S350:
         if(!(*status == -1)) goto S380;
@@ -0,0 +1,50 @@
+# include <iomanip>
+# include <cmath>
+using namespace std;
+# include "cdflib.hpp"
+
+//****************************************************************************80
+
+void cdfchi_batch ( int *which, double *p, double *q, double *x, double *df,
+  size_t n, int *status, double *bound )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    CDFCHI_BATCH applies CDFCHI to arrays of chi square parameters.
+//
+//  Discussion:
+//
+//    Element I of every array is one call of CDFCHI, so the arrays hold
+//    inputs or outputs according to WHICH, as for CDFCHI.  With WHICH = 2,
+//    each element is one inverse incomplete gamma ratio, which is the
+//    fast way to compute many quantiles at once.
+//
+//  Parameters:
+//
+//    Input, int *WHICH, indicates which argument is to be calculated
+//    from the others, as for CDFCHI.
+//
+//    Input/output, double *P, *Q, the lower and upper tail probabilities.
+//
+//    Input/output, double *X, the arguments.
+//
+//    Input/output, double *DF, the degrees of freedom.
+//
+//    Input, size_t N, the number of elements in each array.
+//
+//    Output, int *STATUS, the status of each element, as for CDFCHI.
+//
+//    Output, double *BOUND, the bound for each element whose STATUS
+//    is nonzero, as for CDFCHI.
+//
+{
+  size_t i;
+
+  for ( i = 0; i < n; i++ )
+  {
+    cdfchi ( which, p+i, q+i, x+i, df+i, status+i, bound+i );
+  }
+  return;
+}
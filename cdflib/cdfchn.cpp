@@ -99,12 +99,13 @@ void cdfchn ( int *which, double *p, double *q, double *x, double *df,
 # define one (1.0e0-1.0e-16)
 # define inf 1.0e300
 
-  static double K1 = 0.0e0;
-  static double K3 = 0.5e0;
-  static double K4 = 5.0e0;
-  static double fx,cum,ccum;
-  static unsigned long qhi,qleft;
-  static double T2,T5,T6,T7,T8,T9,T10,T11,T12,T13;
+  double K1 = 0.0e0;
+  double K3 = 0.5e0;
+  double K4 = 5.0e0;
+  double fx,cum,ccum;
+  unsigned long qhi,qleft;
+  dinvr_state istate;
+  double T2,T5,T6,T7,T8,T9,T10,T11,T12,T13;
 
   *status = 0;
   *bound = 0.0;
@@ -184,14 +185,14 @@ S120:
         T2 = inf;
         T5 = atol;
         T6 = tol;
-        dstinv(&K1,&T2,&K3,&K3,&K4,&T5,&T6);
+        dstinv(&istate,&K1,&T2,&K3,&K3,&K4,&T5,&T6);
         *status = 0;
-        dinvr(status,x,&fx,&qleft,&qhi);
+        dinvr(&istate,status,x,&fx,&qleft,&qhi);
 S140:
         if(!(*status == 1)) goto S150;
         cumchn(x,df,pnonc,&cum,&ccum);
         fx = cum-*p;
-        dinvr(status,x,&fx,&qleft,&qhi);
+        dinvr(&istate,status,x,&fx,&qleft,&qhi);
         goto S140;
 S150:
         if(!(*status == -1)) goto S180;
@@ -215,14 +216,14 @@ S170:
         T8 = inf;
         T9 = atol;
         T10 = tol;
-        dstinv(&T7,&T8,&K3,&K3,&K4,&T9,&T10);
+        dstinv(&istate,&T7,&T8,&K3,&K3,&K4,&T9,&T10);
         *status = 0;
-        dinvr(status,df,&fx,&qleft,&qhi);
+        dinvr(&istate,status,df,&fx,&qleft,&qhi);
 S190:
         if(!(*status == 1)) goto S200;
         cumchn(x,df,pnonc,&cum,&ccum);
         fx = cum-*p;
-        dinvr(status,df,&fx,&qleft,&qhi);
+        dinvr(&istate,status,df,&fx,&qleft,&qhi);
         goto S190;
 S200:
         if(!(*status == -1)) goto S230;
@@ -245,14 +246,14 @@ S220:
         T11 = tent4;
         T12 = atol;
         T13 = tol;
-        dstinv(&K1,&T11,&K3,&K3,&K4,&T12,&T13);
+        dstinv(&istate,&K1,&T11,&K3,&K3,&K4,&T12,&T13);
         *status = 0;
-        dinvr(status,pnonc,&fx,&qleft,&qhi);
+        dinvr(&istate,status,pnonc,&fx,&qleft,&qhi);
 S240:
         if(!(*status == 1)) goto S250;
         cumchn(x,df,pnonc,&cum,&ccum);
         fx = cum-*p;
-        dinvr(status,pnonc,&fx,&qleft,&qhi);
+        dinvr(&istate,status,pnonc,&fx,&qleft,&qhi);
         goto S240;
 S250:
         if(!(*status == -1)) goto S280;
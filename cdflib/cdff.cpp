@@ -90,13 +90,14 @@ void cdff ( int *which, double *p, double *q, double *f, double *dfn,
 # define zero (1.0e-300)
 # define inf 1.0e300
 
-  static int K1 = 1;
-  static double K2 = 0.0e0;
-  static double K4 = 0.5e0;
-  static double K5 = 5.0e0;
-  static double pq,fx,cum,ccum;
-  static unsigned long qhi,qleft,qporq;
-  static double T3,T6,T7,T8,T9,T10,T11,T12,T13,T14,T15;
+  double K2 = 0.0e0;
+  double K4 = 0.5e0;
+  double K5 = 5.0e0;
+  double pq,fx,dfx,d2fx,cum,ccum,hd,hn,lnc;
+  unsigned long qhi,qleft,qporq;
+  dinvr_state istate;
+  dinvh_state hstate;
+  double T3,T6,T7,T8,T9,T10,T11,T12,T13,T14,T15;
 
   *status = 0;
   *bound = 0.0;
@@ -178,7 +179,7 @@ S160:
 //     P + Q
 //
     pq = *p+*q;
-    if(!(fabs(pq-0.5e0-0.5e0) > 3.0e0 * dpmpar ( &K1 ) ) ) goto S200;
+    if(!(fabs(pq-0.5e0-0.5e0) > 3.0e0 * dpmpar_eps ) ) goto S200;
     if(!(pq < 0.0e0)) goto S180;
     *bound = 0.0e0;
     goto S190;
@@ -204,24 +205,32 @@ S200:
     else if(2 == *which) {
 //
 //     Calculating F
+//     .. Start from Paulson's approximation, and get the log of the
+//        normalization of the density
 //
-        *f = 5.0e0;
+        *f = stvalf(dfn,dfd,p,q);
+        hn = 0.5e0**dfn;
+        hd = 0.5e0**dfd;
+        lnc = hn*log(*dfn/ *dfd)-beta_log(&hn,&hd);
         T3 = inf;
         T6 = atol;
         T7 = tol;
-        dstinv(&K2,&T3,&K4,&K4,&K5,&T6,&T7);
+        dstinh(&hstate,&K2,&T3,&T6,&T7);
         *status = 0;
-        dinvr(status,f,&fx,&qleft,&qhi);
+        dinvh(&hstate,status,f,&fx,&dfx,&d2fx,&qleft,&qhi);
 S220:
         if(!(*status == 1)) goto S250;
         cumf(f,dfn,dfd,&cum,&ccum);
+        T8 = *dfn**f/ *dfd;
+        dfx = exp(lnc+(hn-1.0e0)*log(*f)-(hn+hd)*alnrel(&T8));
+        d2fx = dfx*((hn-1.0e0)/ *f-(hn+hd)**dfn/(*dfd+*dfn**f));
         if(!qporq) goto S230;
-        fx = cum-*p;
+        dlnres(&cum,p,1,&fx,&dfx,&d2fx);
         goto S240;
 S230:
-        fx = ccum-*q;
+        dlnres(&ccum,q,0,&fx,&dfx,&d2fx);
 S240:
-        dinvr(status,f,&fx,&qleft,&qhi);
+        dinvh(&hstate,status,f,&fx,&dfx,&d2fx,&qleft,&qhi);
         goto S220;
 S250:
         if(!(*status == -1)) goto S280;
@@ -251,13 +260,13 @@ S270:
     T9 = inf;
     T10 = atol;
     T11 = tol;
-    dstinv ( &T8, &T9, &K4, &K4, &K5, &T10, &T11 );
+    dstinv ( &istate, &T8, &T9, &K4, &K4, &K5, &T10, &T11 );
 
     *status = 0;
     *dfn = 5.0;
     fx = 0.0;
 
-    dinvr ( status, dfn, &fx, &qleft, &qhi );
+    dinvr ( &istate, status, dfn, &fx, &qleft, &qhi );
 
     while ( *status == 1 )
     {
@@ -271,7 +280,7 @@ S270:
       {
         fx = ccum - *q;
       }
-      dinvr ( status, dfn, &fx, &qleft, &qhi );
+      dinvr ( &istate, status, dfn, &fx, &qleft, &qhi );
     }
 
     if ( *status == -1 )
@@ -304,12 +313,12 @@ S270:
     T13 = inf;
     T14 = atol;
     T15 = tol;
-    dstinv ( &T12, &T13, &K4, &K4, &K5, &T14, &T15 );
+    dstinv ( &istate, &T12, &T13, &K4, &K4, &K5, &T14, &T15 );
 
     *status = 0;
     *dfd = 5.0;
     fx = 0.0;
-    dinvr ( status, dfd, &fx, &qleft, &qhi );
+    dinvr ( &istate, status, dfd, &fx, &qleft, &qhi );
 
     while ( *status == 1 )
     {
@@ -323,7 +332,7 @@ S270:
       {
         fx = ccum - *q;
       }
-      dinvr ( status, dfd, &fx, &qleft, &qhi );
+      dinvr ( &istate, status, dfd, &fx, &qleft, &qhi );
     }
 
     if ( *status == -1 )
@@ -123,12 +123,13 @@ void cdffnc ( int *which, double *p, double *q, double *f, double *dfn,
 # define one (1.0e0-1.0e-16)
 # define inf 1.0e300
 
-  static double K1 = 0.0e0;
-  static double K3 = 0.5e0;
-  static double K4 = 5.0e0;
-  static double fx,cum,ccum;
-  static unsigned long qhi,qleft;
-  static double T2,T5,T6,T7,T8,T9,T10,T11,T12,T13,T14,T15,T16,T17;
+  double K1 = 0.0e0;
+  double K3 = 0.5e0;
+  double K4 = 5.0e0;
+  double fx,cum,ccum;
+  unsigned long qhi,qleft;
+  dinvr_state istate;
+  double T2,T5,T6,T7,T8,T9,T10,T11,T12,T13,T14,T15,T16,T17;
 
   *status = 0;
   *bound = 0.0;
@@ -218,14 +219,14 @@ S140:
         T2 = inf;
         T5 = atol;
         T6 = tol;
-        dstinv(&K1,&T2,&K3,&K3,&K4,&T5,&T6);
+        dstinv(&istate,&K1,&T2,&K3,&K3,&K4,&T5,&T6);
         *status = 0;
-        dinvr(status,f,&fx,&qleft,&qhi);
+        dinvr(&istate,status,f,&fx,&qleft,&qhi);
 S160:
         if(!(*status == 1)) goto S170;
         cumfnc(f,dfn,dfd,phonc,&cum,&ccum);
         fx = cum-*p;
-        dinvr(status,f,&fx,&qleft,&qhi);
+        dinvr(&istate,status,f,&fx,&qleft,&qhi);
         goto S160;
 S170:
         if(!(*status == -1)) goto S200;
@@ -249,14 +250,14 @@ S190:
         T8 = inf;
         T9 = atol;
         T10 = tol;
-        dstinv(&T7,&T8,&K3,&K3,&K4,&T9,&T10);
+        dstinv(&istate,&T7,&T8,&K3,&K3,&K4,&T9,&T10);
         *status = 0;
-        dinvr(status,dfn,&fx,&qleft,&qhi);
+        dinvr(&istate,status,dfn,&fx,&qleft,&qhi);
 S210:
         if(!(*status == 1)) goto S220;
         cumfnc(f,dfn,dfd,phonc,&cum,&ccum);
         fx = cum-*p;
-        dinvr(status,dfn,&fx,&qleft,&qhi);
+        dinvr(&istate,status,dfn,&fx,&qleft,&qhi);
         goto S210;
 S220:
         if(!(*status == -1)) goto S250;
@@ -280,14 +281,14 @@ S240:
         T12 = inf;
         T13 = atol;
         T14 = tol;
-        dstinv(&T11,&T12,&K3,&K3,&K4,&T13,&T14);
+        dstinv(&istate,&T11,&T12,&K3,&K3,&K4,&T13,&T14);
         *status = 0;
-        dinvr(status,dfd,&fx,&qleft,&qhi);
+        dinvr(&istate,status,dfd,&fx,&qleft,&qhi);
 S260:
         if(!(*status == 1)) goto S270;
         cumfnc(f,dfn,dfd,phonc,&cum,&ccum);
         fx = cum-*p;
-        dinvr(status,dfd,&fx,&qleft,&qhi);
+        dinvr(&istate,status,dfd,&fx,&qleft,&qhi);
         goto S260;
 S270:
         if(!(*status == -1)) goto S300;
@@ -310,14 +311,14 @@ S290:
         T15 = tent4;
         T16 = atol;
         T17 = tol;
-        dstinv(&K1,&T15,&K3,&K3,&K4,&T16,&T17);
+        dstinv(&istate,&K1,&T15,&K3,&K3,&K4,&T16,&T17);
         *status = 0;
-        dinvr(status,phonc,&fx,&qleft,&qhi);
+        dinvr(&istate,status,phonc,&fx,&qleft,&qhi);
 S310:
         if(!(*status == 1)) goto S320;
         cumfnc(f,dfn,dfd,phonc,&cum,&ccum);
         fx = cum-*p;
-        dinvr(status,phonc,&fx,&qleft,&qhi);
+        dinvr(&istate,status,phonc,&fx,&qleft,&qhi);
         goto S310;
 S320:
         if(!(*status == -1)) goto S350;
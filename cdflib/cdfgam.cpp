@@ -85,13 +85,13 @@ void cdfgam ( int *which, double *p, double *q, double *x, double *shape,
 # define zero (1.0e-300)
 # define inf 1.0e300
 
-  static int K1 = 1;
-  static double K5 = 0.5e0;
-  static double K6 = 5.0e0;
-  static double xx,fx,xscale,cum,ccum,pq,porq;
-  static int ierr;
-  static unsigned long qhi,qleft,qporq;
-  static double T2,T3,T4,T7,T8,T9;
+  double K5 = 0.5e0;
+  double K6 = 5.0e0;
+  double xx,fx,xscale,cum,ccum,pq,porq = 0.0e0;
+  int ierr;
+  unsigned long qhi,qleft,qporq;
+  dinvr_state istate;
+  double T2,T3,T4,T7,T8,T9;
 
   *status = 0;
   *bound = 0.0;
@@ -173,7 +173,7 @@ S160:
 //     P + Q
 //
     pq = *p+*q;
-    if(!(fabs(pq-0.5e0-0.5e0) > 3.0e0*dpmpar(&K1))) goto S200;
+    if(!(fabs(pq-0.5e0-0.5e0) > 3.0e0*dpmpar_eps)) goto S200;
     if(!(pq < 0.0e0)) goto S180;
     *bound = 0.0e0;
     goto S190;
@@ -233,9 +233,9 @@ S230:
         T4 = inf;
         T7 = atol;
         T8 = tol;
-        dstinv(&T3,&T4,&K5,&K5,&K6,&T7,&T8);
+        dstinv(&istate,&T3,&T4,&K5,&K5,&K6,&T7,&T8);
         *status = 0;
-        dinvr(status,shape,&fx,&qleft,&qhi);
+        dinvr(&istate,status,shape,&fx,&qleft,&qhi);
 S250:
         if(!(*status == 1)) goto S290;
         cumgam(&xscale,shape,&cum,&ccum);
@@ -249,7 +249,7 @@ S270:
         *status = 10;
         return;
 S280:
-        dinvr(status,shape,&fx,&qleft,&qhi);
+        dinvr(&istate,status,shape,&fx,&qleft,&qhi);
         goto S250;
 S290:
         if(!(*status == -1)) goto S320;
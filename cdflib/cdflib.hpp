@@ -1,28 +1,205 @@
+# ifndef CDFLIB_HPP
+# define CDFLIB_HPP
+
+# include <cstddef>
+# include <limits>
+# include <string>
+
+//
+//  Machine constants: the results of DPMPAR(1..3), EXPARG(0..1) and
+//  IPMPAR(3) for IEEE double precision, known at compile time.  Defining
+//  CDFLIB_RUNTIME_MACHINE replaces them with values computed once from the
+//  IPMPAR table, for machines whose arithmetic is not IEEE.
+//
+# if defined ( CDFLIB_RUNTIME_MACHINE )
+extern const double dpmpar_eps;
+extern const double dpmpar_tiny;
+extern const double dpmpar_huge;
+extern const double exparg_max;
+extern const double exparg_min;
+extern const int ipmpar_int_max;
+# else
+static_assert ( std::numeric_limits<double>::is_iec559,
+  "cdflib: define CDFLIB_RUNTIME_MACHINE for non-IEEE arithmetic" );
+constexpr double dpmpar_eps = std::numeric_limits<double>::epsilon ( );
+constexpr double dpmpar_tiny = std::numeric_limits<double>::min ( );
+constexpr double dpmpar_huge = std::numeric_limits<double>::max ( );
+constexpr double exparg_max = 0.99999e0
+  * ( ( double ) std::numeric_limits<double>::max_exponent * .69314718055995e0 );
+constexpr double exparg_min = 0.99999e0
+  * ( ( double ) ( std::numeric_limits<double>::min_exponent - 1 )
+  * .69314718055995e0 );
+constexpr int ipmpar_int_max = std::numeric_limits<int>::max ( );
+# endif
+
+//
+//  State of a DZROR zero search, owned by the caller so that several
+//  searches can be in progress at once.
+//
+struct dzror_state
+{
+  double a,abstol,b,c,d,fa,fb,fc,fd,fda,fdb,m,mb,p,q,reltol,tol,w,xxhi,xxlo;
+  int ext,i99999;
+  unsigned long first,qrzero;
+};
+//
+//  State of a DINVR search: the search interval SMALL..BIG, the step
+//  sizes and multiplier, the tolerances, the current bracket, the label
+//  to resume at, and the DZROR search it hands over to.
+//
+struct dinvr_state
+{
+  double absstp,abstol,big,fbig,fsmall,relstp,reltol,small,step,stpmul,xhi,
+    xlb,xlo,xsave,xub,yy;
+  int i99999;
+  unsigned long qbdd,qcond,qincr,qlim,qup;
+  dzror_state zror;
+};
+//
+//  State of a DINVH search: the search interval SMALL..BIG, the
+//  tolerances, the bracket XLO..XHI found so far and which of its ends
+//  are known, and the length of the last step.
+//
+struct dinvh_state
+{
+  double abstol,big,reltol,small,step,xhi,xlo;
+  unsigned long qxhi,qxlo;
+};
+//
+//  Number of function evaluations requested by the current or last
+//  DINVR, DZROR or DINVH search on this thread.  See CDF_EVALS.
+//
+extern thread_local int cdf_eval_count;
+//
+//  Accuracy request (IND) of GAMMA_INC for CUMGAM, CUMCHI and CUMPOI on
+//  this thread.  See GAMMA_INC_SET_ACCURACY.
+//
+extern thread_local int gamma_inc_thread_ind;
+//
+//  Parts of GAMMA_INC that depend on A only, set by GAMMA_NORM_INIT.
+//
+struct gamma_norm
+{
+  double a,gam1,gamma_x,rta,stirling;
+};
+//
+//  Parts of the incomplete beta routines that depend on A and B only, set
+//  by BETA_NORM_INIT: the Beta function factor (LNBETA, or C, U, G1, T
+//  when min(A,B) < 1), exp(-BCORR), and the coefficients of BETA_GRAT
+//  (GR, GU, GV, GD) and BETA_ASYM (AD).
+//
+struct beta_norm
+{
+  double a,b,lnbeta,c,u,g1,t,ebcorr,gr,gu,gv,gd[30],ad[21];
+};
+//
+//  Log-normalizers of the gamma and beta densities, set by GAMMA_PDF_INIT
+//  and BETA_PDF_INIT.  BIG selects the asymptotic form used for large
+//  parameters; X0, Y0 are the beta mean and its complement.
+//
+struct gamma_pdf_norm
+{
+  double a,lnc;
+  int big;
+};
+
+struct beta_pdf_norm
+{
+  double a,b,lnc,x0,y0;
+  int big;
+};
+//
+//  A distribution with fixed parameters, for evaluation at many points.
+//  The constructor computes the parts that depend on the parameters only;
+//  CDF, SF and EVAL then give the same results as CUMGAM, CUMBET, CUMCHI
+//  and CUMT.
+//
+class PreparedGamma
+{
+public:
+  PreparedGamma ( double a );
+  double cdf ( double x ) const;
+  double sf ( double x ) const;
+  void eval ( double x, double *cum, double *ccum ) const;
+private:
+  double a;
+  gamma_norm nrm;
+};
+
+class PreparedBeta
+{
+public:
+  PreparedBeta ( double a, double b );
+  double cdf ( double x ) const;
+  double sf ( double x ) const;
+  void eval ( double x, double y, double *cum, double *ccum ) const;
+private:
+  double a,b;
+  int nnrm;
+  beta_norm nrm[10];
+};
+
+class PreparedChi2
+{
+public:
+  PreparedChi2 ( double df );
+  double cdf ( double x ) const;
+  double sf ( double x ) const;
+  void eval ( double x, double *cum, double *ccum ) const;
+private:
+  PreparedGamma gam;
+};
+
+class PreparedT
+{
+public:
+  PreparedT ( double df );
+  double cdf ( double t ) const;
+  double sf ( double t ) const;
+  void eval ( double t, double *cum, double *ccum ) const;
+private:
+  double df;
+  PreparedBeta bet;
+};
+
 double algdiv ( double *a, double *b );
 double alnrel ( double *a );
 double apser ( double *a, double *b, double *x, double *eps );
 double bcorr ( double *a0, double *b0 );
 double beta ( double a, double b );
-double beta_asym ( double *a, double *b, double *lambda, double *eps );
+double beta_asym ( double *a, double *b, double *lambda, double *eps,
+  const beta_norm *nrm = NULL );
 double beta_frac ( double *a, double *b, double *x, double *y, double *lambda,
-  double *eps );
+  double *eps, const beta_norm *nrm = NULL );
 void beta_grat ( double *a, double *b, double *x, double *y, double *w,
-  double *eps,int *ierr );
+  double *eps,int *ierr, const beta_norm *nrm = NULL );
 void beta_inc ( double *a, double *b, double *x, double *y, double *w,
-  double *w1, int *ierr );
+  double *w1, int *ierr, const beta_norm *nrm = NULL, int nnrm = 0 );
+void beta_inc_log ( double *a, double *b, double *x, double *y, double *lw,
+  double *lw1, int *ierr );
 void beta_inc_values ( int *n_data, double *a, double *b, double *x, double *fx );
 double beta_log ( double *a0, double *b0 );
-double beta_pser ( double *a, double *b, double *x, double *eps );
-double beta_rcomp ( double *a, double *b, double *x, double *y );
-double beta_rcomp1 ( int *mu, double *a, double *b, double *x, double *y );
-double beta_up ( double *a, double *b, double *x, double *y, int *n, double *eps );
+double beta_lpdf ( double *x, double *y, const beta_pdf_norm *nrm );
+void beta_norm_init ( double *a, double *b, beta_norm *nrm );
+void beta_pdf_init ( double *a, double *b, beta_pdf_norm *nrm );
+double beta_pser ( double *a, double *b, double *x, double *eps,
+  const beta_norm *nrm = NULL );
+double beta_rcomp ( double *a, double *b, double *x, double *y,
+  const beta_norm *nrm = NULL );
+double beta_rcomp1 ( int *mu, double *a, double *b, double *x, double *y,
+  const beta_norm *nrm = NULL );
+double beta_up ( double *a, double *b, double *x, double *y, int *n, double *eps,
+  const beta_norm *nrm = NULL );
 void binomial_cdf_values ( int *n_data, int *a, double *b, int *x, double *fx );
+int cdf_evals ( );
 void cdfbet ( int *which, double *p, double *q, double *x, double *y,
   double *a, double *b, int *status, double *bound );
 void cdfbin ( int *which, double *p, double *q, double *s, double *xn,
   double *pr, double *ompr, int *status, double *bound );
 void cdfchi ( int *which, double *p, double *q, double *x, double *df,
   int *status, double *bound );
+void cdfchi_batch ( int *which, double *p, double *q, double *x, double *df,
+  size_t n, int *status, double *bound );
 void cdfchn ( int *which, double *p, double *q, double *x, double *df,
   double *pnonc, int *status, double *bound );
 void cdff ( int *which, double *p, double *q, double *f, double *dfn,
@@ -37,6 +214,8 @@ void cdfnor ( int *which, double *p, double *q, double *x, double *mean,
   double *sd, int *status, double *bound );
 void cdfpoi ( int *which, double *p, double *q, double *s, double *xlam,
   int *status, double *bound );
+void cdfpoi_batch ( int *which, double *p, double *q, double *s, double *xlam,
+  size_t n, int *status, double *bound );
 void cdft ( int *which, double *p, double *q, double *t, double *df,
   int *status, double *bound );
 void chi_noncentral_cdf_values ( int *n_data, double *x, double *lambda,
@@ -46,45 +225,69 @@ void cumbet ( double *x, double *y, double *a, double *b, double *cum,
   double *ccum );
 void cumbin ( double *s, double *xn, double *pr, double *ompr,
   double *cum, double *ccum );
-void cumchi ( double *x, double *df, double *cum, double *ccum );
+void cumchi ( double *x, double *df, double *cum, double *ccum,
+  const int *ind = NULL );
 void cumchn ( double *x, double *df, double *pnonc, double *cum,
   double *ccum );
 void cumf ( double *f, double *dfn, double *dfd, double *cum, double *ccum );
 void cumfnc ( double *f, double *dfn, double *dfd, double *pnonc,
   double *cum, double *ccum );
-void cumgam ( double *x, double *a, double *cum, double *ccum );
+void cumgam ( double *x, double *a, double *cum, double *ccum,
+  const int *ind = NULL );
 void cumnbn ( double *s, double *xn, double *pr, double *ompr,
   double *cum, double *ccum );
 void cumnor ( double *arg, double *result, double *ccum );
-void cumpoi ( double *s, double *xlam, double *cum, double *ccum );
+void cumnor_batch ( const double *x, size_t n, double *p, double *q );
+void cumnor_batch_f ( const float *x, size_t n, float *p, float *q );
+void cumnor_log ( double *arg, double *lcum, double *lccum );
+void cumnor_log_batch ( const double *x, size_t n, double *lp, double *lq );
+void cumpoi ( double *s, double *xlam, double *cum, double *ccum,
+  const int *ind = NULL );
 void cumt ( double *t, double *df, double *cum, double *ccum );
 double dbetrm ( double *a, double *b );
 double dexpm1 ( double *x );
+void dinvh ( dinvh_state *state, int *status, double *x, double *fx,
+  double *dfx, double *d2fx, unsigned long *qleft, unsigned long *qhi );
 double dinvnr ( double *p, double *q );
+void dinvnr_batch ( const double *p, const double *q, size_t n, double *x );
+double dinvnr_log ( double *lp, double *lq );
 void dinvr ( int *status, double *x, double *fx,
   unsigned long *qleft, unsigned long *qhi );
+void dinvr ( dinvr_state *state, int *status, double *x, double *fx,
+  unsigned long *qleft, unsigned long *qhi );
 double dlanor ( double *x );
+void dlnres ( double *v, double *target, unsigned long qincr, double *fx,
+  double *dfx, double *d2fx );
 double dpmpar ( int *i );
+void dstinh ( dinvh_state *state, double *zsmall, double *zbig,
+  double *zabsto, double *zrelto );
 void dstinv ( double *zsmall, double *zbig, double *zabsst,
   double *zrelst, double *zstpmu, double *zabsto, double *zrelto );
+void dstinv ( dinvr_state *state, double *zsmall, double *zbig,
+  double *zabsst, double *zrelst, double *zstpmu, double *zabsto,
+  double *zrelto );
 double dstrem ( double *z );
 void dstzr ( double *zxlo, double *zxhi, double *zabstl, double *zreltl );
+void dstzr ( dzror_state *state, double *zxlo, double *zxhi,
+  double *zabstl, double *zreltl );
 double dt1 ( double *p, double *q, double *df );
 void dzror ( int *status, double *x, double *fx, double *xlo,
   double *xhi, unsigned long *qleft, unsigned long *qhi );
-void E0000 ( int IENTRY, int *status, double *x, double *fx,
-  unsigned long *qleft, unsigned long *qhi, double *zabsst,
+void dzror ( dzror_state *state, int *status, double *x, double *fx,
+  double *xlo, double *xhi, unsigned long *qleft, unsigned long *qhi );
+void E0000 ( dinvr_state *state, int IENTRY, int *status, double *x,
+  double *fx, unsigned long *qleft, unsigned long *qhi, double *zabsst,
   double *zabsto, double *zbig, double *zrelst,
   double *zrelto, double *zsmall, double *zstpmu );
-void E0001 ( int IENTRY, int *status, double *x, double *fx,
-  double *xlo, double *xhi, unsigned long *qleft,
+void E0001 ( dzror_state *state, int IENTRY, int *status, double *x,
+  double *fx, double *xlo, double *xhi, unsigned long *qleft,
   unsigned long *qhi, double *zabstl, double *zreltl,
   double *zxhi, double *zxlo );
 void erf_values ( int *n_data, double *x, double *fx );
 double error_f ( double *x );
 double error_fc ( int *ind, double *x );
 double esum ( int *mu, double *x );
-double eval_pol ( double a[], int *n, double *x );
+double eval_pol ( const double a[], const int *n, double *x );
 double exparg ( int *l );
 void f_cdf_values ( int *n_data, int *a, int *b, double *x, double *fx );
 void f_noncentral_cdf_values ( int *n_data, int *a, int *b, double *lambda,
@@ -96,23 +299,87 @@ double fifdsign ( double mag, double sign );
 long fifidint ( double a );
 long fifmod ( long a, long b );
 double fpser ( double *a, double *b, double *x, double *eps );
-void ftnstop ( string msg );
+void ftnstop ( std::string msg );
 double gam1 ( double *a );
-void gamma_inc ( double *a, double *x, double *ans, double *qans, int *ind );
+void gamma_inc ( double *a, double *x, double *ans, double *qans, int *ind,
+  const gamma_norm *nrm = NULL );
+int gamma_inc_accuracy ( );
+void gamma_inc_batch ( const double *a, const double *x, size_t n,
+  double *ans, double *qans, int *ind );
+int gamma_inc_ind ( double relerr );
+int gamma_inc_ind_nsigma ( double relerr, double nsigma );
 void gamma_inc_inv ( double *a, double *x, double *x0, double *p, double *q,
   int *ierr );
+void gamma_inc_log ( double *a, double *x, double *lans, double *lqans,
+  int *ind );
+void gamma_inc_set_accuracy ( int ind );
 void gamma_inc_values ( int *n_data, double *a, double *x, double *fx );
 double gamma_ln1 ( double *a );
+void gamma_norm_init ( double *a, gamma_norm *nrm );
+void gamma_pdf_init ( double *a, gamma_pdf_norm *nrm );
 double gamma_log ( double *a );
+double gamma_lpdf ( double *x, const gamma_pdf_norm *nrm );
 void gamma_rat1 ( double *a, double *x, double *r, double *p, double *q,
   double *eps );
 void gamma_values ( int *n_data, double *x, double *fx );
 double gamma_x ( double *a );
 double gsumln ( double *a, double *b );
 int ipmpar ( int *i );
+void irwin_hall_cdf ( double *x, int *n, double *cum, double *ccum );
+void irwin_hall_cdf_values ( int *n_data, int *n, double *x, double *fx );
+double logpdfbet ( double *x, double *y, double *a, double *b );
+void logpdfbet_batch ( const double *x, const double *y, size_t n, double *a,
+  double *b, double *fx );
+double logpdfbin ( double *s, double *xn, double *pr, double *ompr );
+void logpdfbin_batch ( const double *s, size_t n, double *xn, double *pr,
+  double *ompr, double *fx );
+double logpdfchi ( double *x, double *df );
+void logpdfchi_batch ( const double *x, size_t n, double *df, double *fx );
+double logpdfchn ( double *x, double *df, double *pnonc );
+void logpdfchn_batch ( const double *x, size_t n, double *df, double *pnonc,
+  double *fx );
+double logpdff ( double *f, double *dfn, double *dfd );
+void logpdff_batch ( const double *f, size_t n, double *dfn, double *dfd,
+  double *fx );
+double logpdfgam ( double *x, double *a );
+void logpdfgam_batch ( const double *x, size_t n, double *a, double *fx );
+double logpdfnbn ( double *s, double *xn, double *pr, double *ompr );
+void logpdfnbn_batch ( const double *s, size_t n, double *xn, double *pr,
+  double *ompr, double *fx );
+double logpdfnor ( double *x );
+void logpdfnor_batch ( const double *x, size_t n, double *fx );
+double logpdfpoi ( double *s, double *xlam );
+void logpdfpoi_batch ( const double *s, size_t n, double *xlam, double *fx );
+double logpdft ( double *t, double *df );
+void logpdft_batch ( const double *t, size_t n, double *df, double *fx );
 void negative_binomial_cdf_values ( int *n_data, int *f, int *s, double *p,
   double *cdf );
 void normal_cdf_values ( int *n_data, double *x, double *fx );
+double pdfbet ( double *x, double *y, double *a, double *b );
+void pdfbet_batch ( const double *x, const double *y, size_t n, double *a,
+  double *b, double *fx );
+double pdfbin ( double *s, double *xn, double *pr, double *ompr );
+void pdfbin_batch ( const double *s, size_t n, double *xn, double *pr,
+  double *ompr, double *fx );
+double pdfchi ( double *x, double *df );
+void pdfchi_batch ( const double *x, size_t n, double *df, double *fx );
+double pdfchn ( double *x, double *df, double *pnonc );
+void pdfchn_batch ( const double *x, size_t n, double *df, double *pnonc,
+  double *fx );
+double pdff ( double *f, double *dfn, double *dfd );
+void pdff_batch ( const double *f, size_t n, double *dfn, double *dfd,
+  double *fx );
+double pdfgam ( double *x, double *a );
+void pdfgam_batch ( const double *x, size_t n, double *a, double *fx );
+double pdfnbn ( double *s, double *xn, double *pr, double *ompr );
+void pdfnbn_batch ( const double *s, size_t n, double *xn, double *pr,
+  double *ompr, double *fx );
+double pdfnor ( double *x );
+void pdfnor_batch ( const double *x, size_t n, double *fx );
+double pdfpoi ( double *s, double *xlam );
+void pdfpoi_batch ( const double *s, size_t n, double *xlam, double *fx );
+double pdft ( double *t, double *df );
+void pdft_batch ( const double *t, size_t n, double *df, double *fx );
 void poisson_cdf_values ( int *n_data, double *a, int *x, double *fx );
 double psi ( double *xx );
 void psi_values ( int *n_data, double *x, double *fx );
@@ -120,6 +387,11 @@ double rcomp ( double *a, double *x );
 double rexp ( double *x );
 double rlog ( double *x );
 double rlog1 ( double *x );
+int simd_level ( );
 void student_cdf_values ( int *n_data, int *a, double *x, double *fx );
+double stvalf ( double *dfn, double *dfd, double *p, double *q );
+double stvalg ( double *a, double *p, double *q );
 double stvaln ( double *p );
 void timestamp ( void );
+
+# endif
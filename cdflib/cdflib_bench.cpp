@@ -0,0 +1,1466 @@
+# include <cstdlib>
+# include <cstring>
+# include <iostream>
+# include <fstream>
+# include <iomanip>
+# include <cmath>
+# include <cfloat>
+# include <chrono>
+# include <ctime>
+# include <string>
+# include <vector>
+
+using namespace std;
+
+# include "cdflib.hpp"
+
+//
+//  A parameter vector holds P and Q in slots 0 and 1, followed by the
+//  other arguments of the CDF* routine in the order of its argument list.
+//
+# define NSLOT 8
+//
+//  Number of parameter vectors generated for each region.
+//
+# define NVEC 64
+
+//
+//  A family is one CDF* routine with its kernels.  SOLVED gives the slot
+//  computed by each WHICH mode, and PAIR a slot whose complement is kept
+//  in the next one, such as X and Y for the beta distribution, or -1.
+//  The kernels fill in P and Q from the other slots; KERNEL_LOG marks
+//  those that return logarithms.
+//
+typedef void bench_cdf ( int which, double *v, int *status, double *bound );
+typedef void bench_kernel ( double *v );
+typedef bool bench_region ( int region, double u, double w, double *v );
+typedef bool bench_table ( int *n_data, double *v );
+
+struct bench_family
+{
+  const char *name;
+  const char *table_name;
+  int nwhich;
+  int solved[5];
+  int pair;
+  bench_cdf *cdf;
+  int nkernel;
+  const char *kernel_name[4];
+  bench_kernel *kernel[4];
+  bool kernel_log[4];
+  bench_region *region;
+  bench_table *table;
+};
+
+struct bench_result
+{
+  string routine;
+  int which;
+  string region;
+  long long calls;
+  double ns;
+  int failures;
+  double error;
+};
+
+struct bench_accuracy
+{
+  string routine;
+  int which;
+  string table;
+  int entries;
+  int failures;
+  double error;
+};
+
+const char *region_name[4] = { "bulk", "tail", "large", "near_integer" };
+
+void bench_batch ( double min_time, vector<bench_result> &results );
+void bench_family_accuracy ( const bench_family &fam,
+  vector<bench_accuracy> &acc );
+void bench_family_time ( const bench_family &fam, double min_time,
+  vector<bench_result> &results );
+double bench_rel ( double x, double ref );
+double bench_seconds ( );
+double bench_tail_error ( double p, double q, double pref, double qref );
+void bench_write_json ( const char *file, double min_time,
+  const vector<bench_result> &results, const vector<bench_accuracy> &acc );
+string json_number ( double x );
+
+//****************************************************************************80
+//
+//  Adapters from a parameter vector to the library routines.
+//
+//****************************************************************************80
+
+void bet_cdf ( int which, double *v, int *status, double *bound )
+{
+  cdfbet ( &which, v, v+1, v+2, v+3, v+4, v+5, status, bound );
+}
+void bet_cum ( double *v )
+{
+  cumbet ( v+2, v+3, v+4, v+5, v, v+1 );
+}
+void bet_inc ( double *v )
+{
+  int ierr;
+  beta_inc ( v+4, v+5, v+2, v+3, v, v+1, &ierr );
+}
+void bet_inc_log ( double *v )
+{
+  int ierr;
+  beta_inc_log ( v+4, v+5, v+2, v+3, v, v+1, &ierr );
+}
+bool bet_region ( int region, double u, double w, double *v )
+{
+  double a,b,m,s;
+
+  if ( region == 0 )
+  {
+    v[4] = 0.5 + 9.5 * u;
+    v[5] = 0.5 + 9.5 * w;
+    v[2] = 0.05 + 0.9 * fmod ( u + w, 1.0 );
+  }
+  else if ( region == 1 )
+  {
+    v[4] = 2.0 + 18.0 * u;
+    v[5] = 2.0 + 18.0 * w;
+    v[2] = 1.0E-03 * ( 1.0 + 9.0 * fmod ( u + w, 1.0 ) );
+  }
+  else if ( region == 2 )
+  {
+    a = 1.0E+03 * pow ( 100.0, u );
+    b = 1.0E+03 * pow ( 100.0, w );
+    m = a / ( a + b );
+    s = sqrt ( a * b / ( a + b + 1.0 ) ) / ( a + b );
+    v[4] = a;
+    v[5] = b;
+    v[2] = m + s * ( 4.0 * fmod ( u + w, 1.0 ) - 2.0 );
+  }
+  else
+  {
+    v[4] = floor ( 1.0 + 10.0 * u ) + 1.0E-09;
+    v[5] = floor ( 1.0 + 10.0 * w ) - 1.0E-09;
+    v[2] = 0.05 + 0.9 * fmod ( u + w, 1.0 );
+  }
+  v[3] = 1.0 - v[2];
+  return true;
+}
+bool bet_table ( int *n_data, double *v )
+{
+  beta_inc_values ( n_data, v+4, v+5, v+2, v );
+  v[1] = 1.0 - v[0];
+  v[3] = 1.0 - v[2];
+  return *n_data != 0;
+}
+
+void bin_cdf ( int which, double *v, int *status, double *bound )
+{
+  cdfbin ( &which, v, v+1, v+2, v+3, v+4, v+5, status, bound );
+}
+void bin_cum ( double *v )
+{
+  cumbin ( v+2, v+3, v+4, v+5, v, v+1 );
+}
+bool bin_region ( int region, double u, double w, double *v )
+{
+  double n,pr;
+
+  if ( region == 0 )
+  {
+    n = floor ( 5.0 + 45.0 * u );
+    pr = 0.1 + 0.8 * w;
+    v[2] = floor ( n * pr + sqrt ( n * pr * ( 1.0 - pr ) )
+      * ( 3.0 * fmod ( u + w, 1.0 ) - 1.5 ) );
+    v[2] = min ( max ( v[2], 0.0 ), n - 1.0 );
+  }
+  else if ( region == 1 )
+  {
+    n = floor ( 100.0 + 400.0 * u );
+    pr = 0.3 + 0.4 * w;
+    v[2] = floor ( 0.2 * n * pr );
+  }
+  else if ( region == 2 )
+  {
+    n = floor ( 1.0E+04 * pow ( 100.0, u ) );
+    pr = 0.1 + 0.8 * w;
+    v[2] = floor ( n * pr + sqrt ( n * pr * ( 1.0 - pr ) )
+      * ( 4.0 * fmod ( u + w, 1.0 ) - 2.0 ) );
+  }
+  else
+  {
+    return false;
+  }
+  v[3] = n;
+  v[4] = pr;
+  v[5] = 1.0 - pr;
+  return true;
+}
+bool bin_table ( int *n_data, double *v )
+{
+  int n,s;
+
+  binomial_cdf_values ( n_data, &n, v+4, &s, v );
+  v[1] = 1.0 - v[0];
+  v[2] = ( double ) s;
+  v[3] = ( double ) n;
+  v[5] = 1.0 - v[4];
+  return *n_data != 0;
+}
+
+void chi_cdf ( int which, double *v, int *status, double *bound )
+{
+  cdfchi ( &which, v, v+1, v+2, v+3, status, bound );
+}
+void chi_cum ( double *v )
+{
+  cumchi ( v+2, v+3, v, v+1 );
+}
+bool chi_region ( int region, double u, double w, double *v )
+{
+  double df;
+
+  if ( region == 0 )
+  {
+    df = 1.0 + 19.0 * u;
+    v[2] = df * ( 0.5 + 1.5 * w );
+  }
+  else if ( region == 1 )
+  {
+    df = 1.0 + 19.0 * u;
+    v[2] = df + sqrt ( 2.0 * df ) * ( 8.0 + 12.0 * w );
+  }
+  else if ( region == 2 )
+  {
+    df = 1.0E+04 * pow ( 100.0, u );
+    v[2] = df + sqrt ( 2.0 * df ) * ( 4.0 * w - 2.0 );
+  }
+  else
+  {
+    return false;
+  }
+  v[3] = df;
+  return true;
+}
+bool chi_table ( int *n_data, double *v )
+{
+  int df;
+
+  chi_square_cdf_values ( n_data, &df, v+2, v );
+  v[1] = 1.0 - v[0];
+  v[3] = ( double ) df;
+  return *n_data != 0;
+}
+
+void chn_cdf ( int which, double *v, int *status, double *bound )
+{
+  cdfchn ( &which, v, v+1, v+2, v+3, v+4, status, bound );
+}
+void chn_cum ( double *v )
+{
+  cumchn ( v+2, v+3, v+4, v, v+1 );
+}
+bool chn_region ( int region, double u, double w, double *v )
+{
+  double df,pnonc;
+
+  if ( region == 0 )
+  {
+    df = 1.0 + 9.0 * u;
+    pnonc = 0.5 + 9.5 * w;
+  }
+  else if ( region == 2 )
+  {
+    df = 100.0 + 900.0 * u;
+    pnonc = 100.0 + 900.0 * w;
+  }
+  else
+  {
+    return false;
+  }
+  v[2] = df + pnonc + sqrt ( 2.0 * ( df + 2.0 * pnonc ) )
+    * ( 3.0 * fmod ( u + w, 1.0 ) - 1.5 );
+  v[2] = max ( v[2], 0.1 );
+  v[3] = df;
+  v[4] = pnonc;
+  return true;
+}
+bool chn_table ( int *n_data, double *v )
+{
+  int df;
+
+  chi_noncentral_cdf_values ( n_data, v+2, v+4, &df, v );
+  v[1] = 1.0 - v[0];
+  v[3] = ( double ) df;
+  return *n_data != 0;
+}
+
+void f_cdf ( int which, double *v, int *status, double *bound )
+{
+  cdff ( &which, v, v+1, v+2, v+3, v+4, status, bound );
+}
+void f_cum ( double *v )
+{
+  cumf ( v+2, v+3, v+4, v, v+1 );
+}
+bool f_region ( int region, double u, double w, double *v )
+{
+  if ( region == 0 )
+  {
+    v[3] = 1.0 + 19.0 * u;
+    v[4] = 1.0 + 19.0 * w;
+    v[2] = 0.2 + 3.0 * fmod ( u + w, 1.0 );
+  }
+  else if ( region == 1 )
+  {
+    v[3] = 2.0 + 18.0 * u;
+    v[4] = 10.0 + 40.0 * w;
+    v[2] = 20.0 + 80.0 * fmod ( u + w, 1.0 );
+  }
+  else if ( region == 2 )
+  {
+    v[3] = 1.0E+04 * pow ( 100.0, u );
+    v[4] = 1.0E+04 * pow ( 100.0, w );
+    v[2] = 1.0 + 0.02 * ( 2.0 * fmod ( u + w, 1.0 ) - 1.0 );
+  }
+  else
+  {
+    return false;
+  }
+  return true;
+}
+bool f_table ( int *n_data, double *v )
+{
+  int dfn,dfd;
+
+  f_cdf_values ( n_data, &dfn, &dfd, v+2, v );
+  v[1] = 1.0 - v[0];
+  v[3] = ( double ) dfn;
+  v[4] = ( double ) dfd;
+  return *n_data != 0;
+}
+
+void fnc_cdf ( int which, double *v, int *status, double *bound )
+{
+  cdffnc ( &which, v, v+1, v+2, v+3, v+4, v+5, status, bound );
+}
+void fnc_cum ( double *v )
+{
+  cumfnc ( v+2, v+3, v+4, v+5, v, v+1 );
+}
+bool fnc_region ( int region, double u, double w, double *v )
+{
+  if ( region == 0 )
+  {
+    v[3] = 1.0 + 19.0 * u;
+    v[4] = 2.0 + 28.0 * w;
+    v[5] = 0.5 + 9.5 * fmod ( u + w, 1.0 );
+    v[2] = 0.3 + 4.0 * fmod ( u + 2.0 * w, 1.0 );
+  }
+  else if ( region == 2 )
+  {
+    v[3] = 100.0 + 900.0 * u;
+    v[4] = 100.0 + 900.0 * w;
+    v[5] = 10.0 + 90.0 * fmod ( u + w, 1.0 );
+    v[2] = ( 1.0 + v[5] / v[3] ) * ( 0.9 + 0.2 * fmod ( u + 2.0 * w, 1.0 ) );
+  }
+  else
+  {
+    return false;
+  }
+  return true;
+}
+bool fnc_table ( int *n_data, double *v )
+{
+  int dfn,dfd;
+
+  f_noncentral_cdf_values ( n_data, &dfn, &dfd, v+5, v+2, v );
+  v[1] = 1.0 - v[0];
+  v[3] = ( double ) dfn;
+  v[4] = ( double ) dfd;
+  return *n_data != 0;
+}
+
+void gam_cdf ( int which, double *v, int *status, double *bound )
+{
+  cdfgam ( &which, v, v+1, v+2, v+3, v+4, status, bound );
+}
+void gam_cum ( double *v )
+{
+  double xs = v[2] * v[4];
+  cumgam ( &xs, v+3, v, v+1 );
+}
+void gam_inc0 ( double *v )
+{
+  double xs = v[2] * v[4];
+  int ind = 0;
+  gamma_inc ( v+3, &xs, v, v+1, &ind );
+}
+void gam_inc1 ( double *v )
+{
+  double xs = v[2] * v[4];
+  int ind = 1;
+  gamma_inc ( v+3, &xs, v, v+1, &ind );
+}
+void gam_inc2 ( double *v )
+{
+  double xs = v[2] * v[4];
+  int ind = 2;
+  gamma_inc ( v+3, &xs, v, v+1, &ind );
+}
+bool gam_region ( int region, double u, double w, double *v )
+{
+  double a;
+
+  if ( region == 0 )
+  {
+    a = 0.5 + 19.5 * u;
+    v[2] = a * ( 0.3 + 1.7 * w );
+  }
+  else if ( region == 1 )
+  {
+    a = 0.5 + 19.5 * u;
+    v[2] = a + sqrt ( a ) * ( 8.0 + 12.0 * w ) + 10.0;
+  }
+  else if ( region == 2 )
+  {
+    a = 1.0E+04 * pow ( 100.0, u );
+    v[2] = a + sqrt ( a ) * ( 4.0 * w - 2.0 );
+  }
+  else
+  {
+    a = floor ( 1.0 + 20.0 * u ) + 1.0E-09 * ( 2.0 * w - 1.0 );
+    v[2] = a * ( 0.3 + 1.7 * fmod ( u + w, 1.0 ) );
+  }
+  v[3] = a;
+  v[4] = 1.0;
+  return true;
+}
+bool gam_table ( int *n_data, double *v )
+{
+  gamma_inc_values ( n_data, v+3, v+2, v );
+  v[1] = 1.0 - v[0];
+  v[4] = 1.0;
+  return *n_data != 0;
+}
+
+void nbn_cdf ( int which, double *v, int *status, double *bound )
+{
+  cdfnbn ( &which, v, v+1, v+2, v+3, v+4, v+5, status, bound );
+}
+void nbn_cum ( double *v )
+{
+  cumnbn ( v+2, v+3, v+4, v+5, v, v+1 );
+}
+bool nbn_region ( int region, double u, double w, double *v )
+{
+  double m,pr,xn;
+
+  if ( region == 0 )
+  {
+    xn = floor ( 1.0 + 19.0 * u );
+    pr = 0.2 + 0.6 * w;
+  }
+  else if ( region == 2 )
+  {
+    xn = floor ( 1.0E+03 * pow ( 100.0, u ) );
+    pr = 0.2 + 0.6 * w;
+  }
+  else
+  {
+    return false;
+  }
+  m = xn * ( 1.0 - pr ) / pr;
+  v[2] = floor ( m + sqrt ( m / pr ) * ( 3.0 * fmod ( u + w, 1.0 ) - 1.0 ) );
+  v[2] = max ( v[2], 0.0 );
+  v[3] = xn;
+  v[4] = pr;
+  v[5] = 1.0 - pr;
+  return true;
+}
+bool nbn_table ( int *n_data, double *v )
+{
+  int f,s;
+
+  negative_binomial_cdf_values ( n_data, &f, &s, v+4, v );
+  v[1] = 1.0 - v[0];
+  v[2] = ( double ) f;
+  v[3] = ( double ) s;
+  v[5] = 1.0 - v[4];
+  return *n_data != 0;
+}
+
+void nor_cdf ( int which, double *v, int *status, double *bound )
+{
+  cdfnor ( &which, v, v+1, v+2, v+3, v+4, status, bound );
+}
+void nor_cum ( double *v )
+{
+  double z = ( v[2] - v[3] ) / v[4];
+  cumnor ( &z, v, v+1 );
+}
+void nor_cum_log ( double *v )
+{
+  double z = ( v[2] - v[3] ) / v[4];
+  cumnor_log ( &z, v, v+1 );
+}
+bool nor_region ( int region, double u, double w, double *v )
+{
+  double z;
+
+  if ( region == 0 )
+  {
+    z = 6.0 * u - 3.0;
+  }
+  else if ( region == 1 )
+  {
+    z = - 8.0 - 29.0 * u;
+  }
+  else
+  {
+    return false;
+  }
+  v[3] = 10.0 * ( 2.0 * w - 1.0 );
+  v[4] = 0.5 + 4.5 * fmod ( u + w, 1.0 );
+  v[2] = v[3] + v[4] * z;
+  return true;
+}
+bool nor_table ( int *n_data, double *v )
+{
+  double x;
+
+  normal_cdf_values ( n_data, &x, v );
+  v[1] = 1.0 - v[0];
+  v[3] = 1.0;
+  v[4] = 2.0;
+  v[2] = v[3] + v[4] * x;
+  return *n_data != 0;
+}
+
+void poi_cdf ( int which, double *v, int *status, double *bound )
+{
+  cdfpoi ( &which, v, v+1, v+2, v+3, status, bound );
+}
+void poi_cum ( double *v )
+{
+  cumpoi ( v+2, v+3, v, v+1 );
+}
+bool poi_region ( int region, double u, double w, double *v )
+{
+  double xlam;
+
+  if ( region == 0 )
+  {
+    xlam = 0.5 + 49.5 * u;
+    v[2] = floor ( xlam + sqrt ( xlam ) * ( 3.0 * w - 1.5 ) );
+  }
+  else if ( region == 1 )
+  {
+    xlam = 100.0 + 900.0 * u;
+    v[2] = floor ( xlam - sqrt ( xlam ) * ( 7.0 + 2.0 * w ) );
+  }
+  else if ( region == 2 )
+  {
+    xlam = 1.0E+04 * pow ( 1000.0, u );
+    v[2] = floor ( xlam + sqrt ( xlam ) * ( 4.0 * w - 2.0 ) );
+  }
+  else
+  {
+    return false;
+  }
+  v[2] = max ( v[2], 0.0 );
+  v[3] = xlam;
+  return true;
+}
+bool poi_table ( int *n_data, double *v )
+{
+  int s;
+
+  poisson_cdf_values ( n_data, v+3, &s, v );
+  v[1] = 1.0 - v[0];
+  v[2] = ( double ) s;
+  return *n_data != 0;
+}
+
+void t_cdf ( int which, double *v, int *status, double *bound )
+{
+  cdft ( &which, v, v+1, v+2, v+3, status, bound );
+}
+void t_cum ( double *v )
+{
+  cumt ( v+2, v+3, v, v+1 );
+}
+bool t_region ( int region, double u, double w, double *v )
+{
+  if ( region == 0 )
+  {
+    v[3] = 1.0 + 29.0 * u;
+    v[2] = 6.0 * w - 3.0;
+  }
+  else if ( region == 1 )
+  {
+    v[3] = 3.0 + 27.0 * u;
+    v[2] = - 10.0 - 30.0 * w;
+  }
+  else if ( region == 2 )
+  {
+    v[3] = 1.0E+04 * pow ( 1.0E+04, u );
+    v[2] = 6.0 * w - 3.0;
+  }
+  else
+  {
+    return false;
+  }
+  return true;
+}
+bool t_table ( int *n_data, double *v )
+{
+  int df;
+
+  student_cdf_values ( n_data, &df, v+2, v );
+  v[1] = 1.0 - v[0];
+  v[3] = ( double ) df;
+  return *n_data != 0;
+}
+
+const bench_family families[] = {
+  { "cdfbet", "beta_inc_values", 4, { 0, 2, 4, 5 }, 2, bet_cdf,
+    3, { "cumbet", "beta_inc", "beta_inc_log" },
+    { bet_cum, bet_inc, bet_inc_log }, { false, false, true },
+    bet_region, bet_table },
+  { "cdfbin", "binomial_cdf_values", 4, { 0, 2, 3, 4 }, 4, bin_cdf,
+    1, { "cumbin" }, { bin_cum }, { false }, bin_region, bin_table },
+  { "cdfchi", "chi_square_cdf_values", 3, { 0, 2, 3 }, -1, chi_cdf,
+    1, { "cumchi" }, { chi_cum }, { false }, chi_region, chi_table },
+  { "cdfchn", "chi_noncentral_cdf_values", 4, { 0, 2, 3, 4 }, -1, chn_cdf,
+    1, { "cumchn" }, { chn_cum }, { false }, chn_region, chn_table },
+  { "cdff", "f_cdf_values", 4, { 0, 2, 3, 4 }, -1, f_cdf,
+    1, { "cumf" }, { f_cum }, { false }, f_region, f_table },
+  { "cdffnc", "f_noncentral_cdf_values", 5, { 0, 2, 3, 4, 5 }, -1, fnc_cdf,
+    1, { "cumfnc" }, { fnc_cum }, { false }, fnc_region, fnc_table },
+  { "cdfgam", "gamma_inc_values", 4, { 0, 2, 3, 4 }, -1, gam_cdf,
+    4, { "cumgam", "gamma_inc(ind=0)", "gamma_inc(ind=1)",
+    "gamma_inc(ind=2)" }, { gam_cum, gam_inc0, gam_inc1, gam_inc2 },
+    { false, false, false, false }, gam_region, gam_table },
+  { "cdfnbn", "negative_binomial_cdf_values", 4, { 0, 2, 3, 4 }, 4, nbn_cdf,
+    1, { "cumnbn" }, { nbn_cum }, { false }, nbn_region, nbn_table },
+  { "cdfnor", "normal_cdf_values", 4, { 0, 2, 3, 4 }, -1, nor_cdf,
+    2, { "cumnor", "cumnor_log" }, { nor_cum, nor_cum_log },
+    { false, true }, nor_region, nor_table },
+  { "cdfpoi", "poisson_cdf_values", 3, { 0, 2, 3 }, -1, poi_cdf,
+    1, { "cumpoi" }, { poi_cum }, { false }, poi_region, poi_table },
+  { "cdft", "student_cdf_values", 3, { 0, 2, 3 }, -1, t_cdf,
+    1, { "cumt" }, { t_cum }, { false }, t_region, t_table }
+};
+const int nfamilies = sizeof ( families ) / sizeof ( families[0] );
+
+//****************************************************************************80
+
+int main ( int argc, char *argv[] )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    MAIN is the main program for CDFLIB_BENCH.
+//
+//  Discussion:
+//
+//    CDFLIB_BENCH times every CDF* routine in every WHICH mode, the CUM*
+//    kernels behind them and the batch routines, in several regions of
+//    parameter space, and checks each against the reference tables of the
+//    *_VALUES routines.  A summary is printed and the results are written
+//    as JSON, so that runs of different versions can be compared.
+//
+//    Usage:
+//
+//      cdflib_bench [-t seconds] [-o file] [routine ...]
+//
+//    -t sets the minimum time spent on each row, 0.02 seconds by default;
+//    -o names the JSON file, cdflib_bench.json by default.  If routine
+//    names such as cdfgam are given, only those families are run.
+//
+{
+  vector<bench_accuracy> acc;
+  bool batch;
+  int f;
+  int i;
+  double min_time = 0.02;
+  const char *out = "cdflib_bench.json";
+  vector<bench_result> results;
+  vector<string> select;
+
+  for ( i = 1; i < argc; i++ )
+  {
+    if ( strcmp ( argv[i], "-t" ) == 0 && i + 1 < argc )
+    {
+      min_time = atof ( argv[++i] );
+    }
+    else if ( strcmp ( argv[i], "-o" ) == 0 && i + 1 < argc )
+    {
+      out = argv[++i];
+    }
+    else if ( argv[i][0] == '-' )
+    {
+      cerr << "Usage: cdflib_bench [-t seconds] [-o file] [routine ...]\n";
+      return 1;
+    }
+    else
+    {
+      select.push_back ( argv[i] );
+    }
+  }
+
+  timestamp ( );
+  cout << "\n";
+  cout << "CDFLIB_BENCH\n";
+  cout << "  Time and accuracy of the CDFLIB routines.\n";
+  cout << "  Minimum time per row: " << min_time << " s, SIMD level "
+       << simd_level ( ) << ".\n";
+  cout << "\n";
+  cout << "  Routine            Which  Region        ns/call     calls/s"
+       << "  Fail   Max error\n";
+
+  batch = select.empty ( );
+  for ( f = 0; f < nfamilies; f++ )
+  {
+    bool run = select.empty ( );
+    for ( i = 0; i < ( int ) select.size ( ); i++ )
+    {
+      run = run || select[i] == families[f].name;
+      batch = batch || select[i] == "batch";
+    }
+    if ( run )
+    {
+      bench_family_time ( families[f], min_time, results );
+      bench_family_accuracy ( families[f], acc );
+    }
+  }
+  if ( batch )
+  {
+    bench_batch ( min_time, results );
+  }
+
+  cout << "\n";
+  cout << "  Accuracy against the reference tables:\n";
+  cout << "\n";
+  cout << "  Routine            Which  Table                           "
+       << "Entries  Fail   Max error\n";
+  for ( i = 0; i < ( int ) acc.size ( ); i++ )
+  {
+    cout << "  " << setw(18) << left << acc[i].routine
+         << " " << setw(5) << right << acc[i].which
+         << "  " << setw(30) << left << acc[i].table
+         << " " << setw(7) << right << acc[i].entries
+         << " " << setw(5) << acc[i].failures
+         << " " << setw(11) << setprecision(3) << acc[i].error << "\n";
+  }
+
+  bench_write_json ( out, min_time, results, acc );
+  cout << "\n";
+  cout << "  Results written to " << out << ".\n";
+//
+//  Terminate.
+//
+  cout << "\n";
+  cout << "CDFLIB_BENCH\n";
+  cout << "  Normal end of execution.\n";
+  cout << "\n";
+  timestamp ( );
+
+  return 0;
+}
+//****************************************************************************80
+
+void bench_print ( const bench_result &r )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    BENCH_PRINT prints one timing row.
+//
+{
+  cout << "  " << setw(18) << left << r.routine
+       << " " << setw(5) << right << r.which
+       << "  " << setw(12) << left << r.region << right
+       << " " << setw(9) << setprecision(4) << r.ns
+       << " " << setw(11) << setprecision(4) << 1.0E+09 / r.ns
+       << " " << setw(5) << r.failures
+       << " " << setw(11) << setprecision(3) << r.error << "\n";
+}
+//****************************************************************************80
+
+void bench_family_time ( const bench_family &fam, double min_time,
+  vector<bench_result> &results )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    BENCH_FAMILY_TIME times the kernels and WHICH modes of one family.
+//
+//  Discussion:
+//
+//    For each region, NVEC parameter vectors are generated and P and Q
+//    are filled in by the first kernel, so that every vector is an exact
+//    solution.  The error reported is the largest relative error of the
+//    smaller tail: for the kernels and WHICH = 1 that of the computed
+//    probability, and for the other WHICH modes that of the probability
+//    recomputed at the parameter found, which is what the search
+//    controls.  Where the CDF hardly depends on a parameter, as for the
+//    degrees of freedom of T near zero, the parameter itself may be far
+//    off.  A vector counts as a failure when STATUS is nonzero or the
+//    result is not finite.
+//
+//    The routines are called over the vectors repeatedly until MIN_TIME
+//    has passed.  Outputs overwrite the inputs with the same values, so
+//    no copying is needed between passes.
+//
+{
+  double bound;
+  double c[NSLOT];
+  double e;
+  int i;
+  int k;
+  long long calls;
+  int region;
+  bench_result r;
+  double ref[NVEC][NSLOT];
+  int status;
+  double t0;
+  double t;
+  double u;
+  int which;
+  double work[NVEC][NSLOT];
+  double w;
+  int nref;
+
+  for ( region = 0; region < 4; region++ )
+  {
+    nref = 0;
+    for ( i = 0; i < NVEC; i++ )
+    {
+      u = ( ( double ) i + 0.5 ) / ( double ) NVEC;
+      w = fmod ( 0.5 + 0.6180339887498949 * ( double ) i, 1.0 );
+      for ( k = 0; k < NSLOT; k++ )
+      {
+        ref[nref][k] = 0.0;
+      }
+      if ( !fam.region ( region, u, w, ref[nref] ) )
+      {
+        break;
+      }
+      fam.kernel[0] ( ref[nref] );
+      if ( 0.0 < ref[nref][0] && 0.0 < ref[nref][1] )
+      {
+        nref = nref + 1;
+      }
+    }
+    if ( nref == 0 )
+    {
+      continue;
+    }
+    r.region = region_name[region];
+//
+//  The kernels.
+//
+    for ( k = 0; k < fam.nkernel; k++ )
+    {
+      memcpy ( work, ref, sizeof ( work ) );
+      r.routine = fam.kernel_name[k];
+      r.which = 0;
+      r.failures = 0;
+      r.error = 0.0;
+      for ( i = 0; i < nref; i++ )
+      {
+        fam.kernel[k] ( work[i] );
+        if ( fam.kernel_log[k] )
+        {
+          work[i][0] = exp ( work[i][0] );
+          work[i][1] = exp ( work[i][1] );
+        }
+        e = bench_tail_error ( work[i][0], work[i][1], ref[i][0], ref[i][1] );
+        r.failures += !isfinite ( e );
+        r.error = isfinite ( e ) ? max ( r.error, e ) : r.error;
+      }
+      calls = 0;
+      t0 = bench_seconds ( );
+      do
+      {
+        for ( i = 0; i < nref; i++ )
+        {
+          fam.kernel[k] ( work[i] );
+        }
+        calls = calls + nref;
+        t = bench_seconds ( ) - t0;
+      } while ( t < min_time );
+      r.calls = calls;
+      r.ns = 1.0E+09 * t / ( double ) calls;
+      bench_print ( r );
+      results.push_back ( r );
+    }
+//
+//  The WHICH modes.
+//
+    for ( which = 1; which <= fam.nwhich; which++ )
+    {
+      memcpy ( work, ref, sizeof ( work ) );
+      r.routine = fam.name;
+      r.which = which;
+      r.failures = 0;
+      r.error = 0.0;
+      for ( i = 0; i < nref; i++ )
+      {
+        fam.cdf ( which, work[i], &status, &bound );
+        memcpy ( c, work[i], sizeof ( c ) );
+        if ( 1 < which )
+        {
+          fam.kernel[0] ( c );
+        }
+        e = bench_tail_error ( c[0], c[1], ref[i][0], ref[i][1] );
+        if ( status != 0 || !isfinite ( e ) )
+        {
+          r.failures = r.failures + 1;
+          memcpy ( work[i], ref[i], sizeof ( work[i] ) );
+        }
+        else
+        {
+          r.error = max ( r.error, e );
+        }
+      }
+      calls = 0;
+      t0 = bench_seconds ( );
+      do
+      {
+        for ( i = 0; i < nref; i++ )
+        {
+          fam.cdf ( which, work[i], &status, &bound );
+        }
+        calls = calls + nref;
+        t = bench_seconds ( ) - t0;
+      } while ( t < min_time );
+      r.calls = calls;
+      r.ns = 1.0E+09 * t / ( double ) calls;
+      bench_print ( r );
+      results.push_back ( r );
+    }
+  }
+}
+//****************************************************************************80
+
+void bench_family_accuracy ( const bench_family &fam,
+  vector<bench_accuracy> &acc )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    BENCH_FAMILY_ACCURACY checks one family against its reference table.
+//
+//  Discussion:
+//
+//    Every entry of the table is a complete parameter vector.  The
+//    kernels and WHICH = 1 are compared with the tabulated CDF; every
+//    other WHICH mode solves for its parameter from the rest of the
+//    entry, and is compared with the tabulated value.  Entries with a
+//    CDF of 0 or 1, and entries whose parameter does not change the CDF,
+//    such as the standard deviation at the mean of a normal
+//    distribution, are skipped for the searches.
+//
+//    Some tables give only four to six digits, so the errors reported
+//    are as much those of the tables as of the routines.
+//
+{
+  bench_accuracy a;
+  double bound;
+  double c[NSLOT];
+  double e;
+  int k;
+  int n_data;
+  double ref[NSLOT];
+  int slot;
+  int status;
+  double v[NSLOT];
+  int which;
+
+  a.table = fam.table_name;
+
+  for ( k = 0; k < fam.nkernel + fam.nwhich; k++ )
+  {
+    which = k < fam.nkernel ? 0 : k - fam.nkernel + 1;
+    a.routine = which == 0 ? fam.kernel_name[k] : fam.name;
+    a.which = which;
+    a.entries = 0;
+    a.failures = 0;
+    a.error = 0.0;
+    slot = which == 0 ? 0 : fam.solved[which-1];
+
+    n_data = 0;
+    for ( ; ; )
+    {
+      for ( int j = 0; j < NSLOT; j++ )
+      {
+        ref[j] = 0.0;
+      }
+      if ( !fam.table ( &n_data, ref ) )
+      {
+        break;
+      }
+      if ( 1 < which && ( ref[0] == 0.0 || ref[0] == 1.0 ) )
+      {
+        continue;
+      }
+      if ( 1 < which )
+      {
+        memcpy ( c, ref, sizeof ( c ) );
+        c[slot] = 1.01 * c[slot];
+        if ( slot == fam.pair )
+        {
+          c[slot+1] = 1.0 - c[slot];
+        }
+        fam.kernel[0] ( c );
+        if ( c[0] == ref[0] )
+        {
+          continue;
+        }
+      }
+      memcpy ( v, ref, sizeof ( v ) );
+      if ( which == 0 )
+      {
+        fam.kernel[k] ( v );
+        status = 0;
+        if ( fam.kernel_log[k] )
+        {
+          v[0] = exp ( v[0] );
+          v[1] = exp ( v[1] );
+        }
+      }
+      else
+      {
+        fam.cdf ( which, v, &status, &bound );
+      }
+      if ( which <= 1 )
+      {
+        e = bench_rel ( v[0], ref[0] );
+      }
+      else
+      {
+        e = bench_rel ( v[slot], ref[slot] );
+      }
+      a.entries = a.entries + 1;
+      if ( status != 0 || !isfinite ( e ) )
+      {
+        a.failures = a.failures + 1;
+      }
+      else
+      {
+        a.error = max ( a.error, e );
+      }
+    }
+    acc.push_back ( a );
+  }
+}
+//****************************************************************************80
+
+void bench_batch ( double min_time, vector<bench_result> &results )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    BENCH_BATCH times the batch routines, per element.
+//
+//  Discussion:
+//
+//    Each batch routine is compared with the scalar routine it replaces,
+//    on 4096 elements in the bulk and in the tail.  For CUMNOR_BATCH_F
+//    the tail probabilities below the smallest normalized float, which
+//    it returns as zero, are left out of the error, and for
+//    CUMNOR_LOG_BATCH the error is that of the log of the smaller tail.
+//
+{
+  const int n = 4096;
+  double bound[n];
+  long long calls;
+  double df[n];
+  double e;
+  float fp[n];
+  float fq[n];
+  float fx[n];
+  int i;
+  int ind;
+  double p[n];
+  double q[n];
+  double pr[n];
+  double qr[n];
+  bench_result r;
+  int region;
+  double s[n];
+  int status[n];
+  double t;
+  double t0;
+  int which;
+  double x[n];
+  double xr[n];
+
+  for ( region = 0; region < 2; region++ )
+  {
+    r.region = region_name[region];
+    r.failures = 0;
+    for ( i = 0; i < n; i++ )
+    {
+      xr[i] = region == 0 ? -3.0 + 6.0 * ( i + 0.5 ) / n
+        : -8.0 - 29.0 * ( i + 0.5 ) / n;
+      fx[i] = ( float ) xr[i];
+      cumnor ( xr + i, pr + i, qr + i );
+    }
+//
+//  CUMNOR_BATCH and CUMNOR_BATCH_F.
+//
+    r.routine = "cumnor_batch";
+    r.which = 0;
+    calls = 0;
+    t0 = bench_seconds ( );
+    do
+    {
+      cumnor_batch ( xr, n, p, q );
+      calls = calls + n;
+      t = bench_seconds ( ) - t0;
+    } while ( t < min_time );
+    r.calls = calls;
+    r.ns = 1.0E+09 * t / ( double ) calls;
+    r.error = 0.0;
+    for ( i = 0; i < n; i++ )
+    {
+      r.error = max ( r.error, bench_tail_error ( p[i], q[i], pr[i], qr[i] ) );
+    }
+    bench_print ( r );
+    results.push_back ( r );
+
+    r.routine = "cumnor_batch_f";
+    calls = 0;
+    t0 = bench_seconds ( );
+    do
+    {
+      cumnor_batch_f ( fx, n, fp, fq );
+      calls = calls + n;
+      t = bench_seconds ( ) - t0;
+    } while ( t < min_time );
+    r.calls = calls;
+    r.ns = 1.0E+09 * t / ( double ) calls;
+    r.error = 0.0;
+    r.failures = 0;
+    for ( i = 0; i < n; i++ )
+    {
+      double xd = ( double ) fx[i];
+      double cum,ccum;
+      cumnor ( &xd, &cum, &ccum );
+      if ( FLT_MIN <= cum )
+      {
+        e = bench_tail_error ( fp[i], fq[i], cum, ccum );
+        r.error = max ( r.error, e );
+      }
+    }
+    bench_print ( r );
+    results.push_back ( r );
+//
+//  CUMNOR_LOG_BATCH, with the error of the log of the smaller tail.
+//
+    r.routine = "cumnor_log_batch";
+    r.failures = 0;
+    calls = 0;
+    t0 = bench_seconds ( );
+    do
+    {
+      cumnor_log_batch ( xr, n, p, q );
+      calls = calls + n;
+      t = bench_seconds ( ) - t0;
+    } while ( t < min_time );
+    r.calls = calls;
+    r.ns = 1.0E+09 * t / ( double ) calls;
+    r.error = 0.0;
+    for ( i = 0; i < n; i++ )
+    {
+      double lcum,lccum;
+      cumnor_log ( xr + i, &lcum, &lccum );
+      e = xr[i] < 0.0 ? fabs ( p[i] - lcum ) / fabs ( lcum )
+        : fabs ( q[i] - lccum ) / fabs ( lccum );
+      r.error = max ( r.error, e );
+    }
+    bench_print ( r );
+    results.push_back ( r );
+//
+//  DINVNR_BATCH.
+//
+    r.routine = "dinvnr_batch";
+    r.failures = 0;
+    calls = 0;
+    t0 = bench_seconds ( );
+    do
+    {
+      dinvnr_batch ( pr, qr, n, x );
+      calls = calls + n;
+      t = bench_seconds ( ) - t0;
+    } while ( t < min_time );
+    r.calls = calls;
+    r.ns = 1.0E+09 * t / ( double ) calls;
+    r.error = 0.0;
+    for ( i = 0; i < n; i++ )
+    {
+      r.error = max ( r.error, bench_rel ( x[i], xr[i] ) );
+    }
+    bench_print ( r );
+    results.push_back ( r );
+  }
+//
+//  GAMMA_INC_BATCH, CDFCHI_BATCH and CDFPOI_BATCH in the bulk.
+//
+  r.region = region_name[0];
+  r.failures = 0;
+  for ( i = 0; i < n; i++ )
+  {
+    df[i] = 1.0 + 19.0 * ( i + 0.5 ) / n;
+    xr[i] = df[i] * ( 0.5 + 1.5 * fmod ( 0.5 + 0.6180339887498949 * i, 1.0 ) );
+    ind = 0;
+    gamma_inc ( df + i, xr + i, pr + i, qr + i, &ind );
+  }
+  r.routine = "gamma_inc_batch";
+  r.which = 0;
+  ind = 0;
+  calls = 0;
+  t0 = bench_seconds ( );
+  do
+  {
+    gamma_inc_batch ( df, xr, n, p, q, &ind );
+    calls = calls + n;
+    t = bench_seconds ( ) - t0;
+  } while ( t < min_time );
+  r.calls = calls;
+  r.ns = 1.0E+09 * t / ( double ) calls;
+  r.error = 0.0;
+  for ( i = 0; i < n; i++ )
+  {
+    r.error = max ( r.error, bench_tail_error ( p[i], q[i], pr[i], qr[i] ) );
+  }
+  bench_print ( r );
+  results.push_back ( r );
+
+  for ( i = 0; i < n; i++ )
+  {
+    s[i] = 2.0 * df[i];
+    cumchi ( xr + i, s + i, pr + i, qr + i );
+  }
+  for ( which = 1; which <= 2; which++ )
+  {
+    r.routine = "cdfchi_batch";
+    r.which = which;
+    calls = 0;
+    t0 = bench_seconds ( );
+    do
+    {
+      memcpy ( p, pr, sizeof ( p ) );
+      memcpy ( q, qr, sizeof ( q ) );
+      memcpy ( x, xr, sizeof ( x ) );
+      cdfchi_batch ( &which, p, q, x, s, n, status, bound );
+      calls = calls + n;
+      t = bench_seconds ( ) - t0;
+    } while ( t < min_time );
+    r.calls = calls;
+    r.ns = 1.0E+09 * t / ( double ) calls;
+    r.error = 0.0;
+    r.failures = 0;
+    for ( i = 0; i < n; i++ )
+    {
+      e = which == 1 ? bench_tail_error ( p[i], q[i], pr[i], qr[i] )
+        : bench_rel ( x[i], xr[i] );
+      r.failures += ( status[i] != 0 );
+      r.error = status[i] != 0 ? r.error : max ( r.error, e );
+    }
+    bench_print ( r );
+    results.push_back ( r );
+  }
+
+  for ( i = 0; i < n; i++ )
+  {
+    s[i] = floor ( xr[i] );
+    cumpoi ( s + i, df + i, pr + i, qr + i );
+  }
+  for ( which = 1; which <= 3; which++ )
+  {
+    r.routine = "cdfpoi_batch";
+    r.which = which;
+    calls = 0;
+    t0 = bench_seconds ( );
+    do
+    {
+      memcpy ( p, pr, sizeof ( p ) );
+      memcpy ( q, qr, sizeof ( q ) );
+      memcpy ( x, s, sizeof ( x ) );
+      memcpy ( xr, df, sizeof ( xr ) );
+      cdfpoi_batch ( &which, p, q, x, xr, n, status, bound );
+      calls = calls + n;
+      t = bench_seconds ( ) - t0;
+    } while ( t < min_time );
+    r.calls = calls;
+    r.ns = 1.0E+09 * t / ( double ) calls;
+    r.error = 0.0;
+    r.failures = 0;
+    for ( i = 0; i < n; i++ )
+    {
+      if ( which == 1 )
+      {
+        e = bench_tail_error ( p[i], q[i], pr[i], qr[i] );
+      }
+      else if ( which == 2 )
+      {
+        e = bench_rel ( x[i], s[i] );
+      }
+      else
+      {
+        e = bench_rel ( xr[i], df[i] );
+      }
+      r.failures += ( status[i] != 0 );
+      r.error = status[i] != 0 ? r.error : max ( r.error, e );
+    }
+    bench_print ( r );
+    results.push_back ( r );
+  }
+}
+//****************************************************************************80
+
+double bench_rel ( double x, double ref )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    BENCH_REL returns the relative error of X, or the absolute error if
+//    REF is zero.
+//
+{
+  if ( ref == 0.0 )
+  {
+    return fabs ( x );
+  }
+  return fabs ( x - ref ) / fabs ( ref );
+}
+//****************************************************************************80
+
+double bench_seconds ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    BENCH_SECONDS returns the time in seconds from a monotonic clock.
+//
+{
+  return chrono::duration<double> (
+    chrono::steady_clock::now ( ).time_since_epoch ( ) ).count ( );
+}
+//****************************************************************************80
+
+double bench_tail_error ( double p, double q, double pref, double qref )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    BENCH_TAIL_ERROR returns the relative error of the smaller tail.
+//
+{
+  if ( pref <= qref )
+  {
+    return bench_rel ( p, pref );
+  }
+  return bench_rel ( q, qref );
+}
+//****************************************************************************80
+
+string json_number ( double x )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    JSON_NUMBER formats X for JSON, which has no infinities or NaNs.
+//
+{
+  char buf[32];
+
+  if ( !isfinite ( x ) )
+  {
+    return "null";
+  }
+  snprintf ( buf, sizeof ( buf ), "%.6g", x );
+  return buf;
+}
+//****************************************************************************80
+
+void bench_write_json ( const char *file, double min_time,
+  const vector<bench_result> &results, const vector<bench_accuracy> &acc )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    BENCH_WRITE_JSON writes the results as a JSON document.
+//
+//  Discussion:
+//
+//    The document has a "run" object describing the machine and build,
+//    a "timing" array with one object per row of the summary, and an
+//    "accuracy" array with one object per routine and table.
+//
+{
+  char date[32];
+  size_t i;
+  ofstream os ( file );
+  time_t now = time ( NULL );
+
+  if ( !os )
+  {
+    cerr << "CDFLIB_BENCH - Could not open " << file << "\n";
+    return;
+  }
+  strftime ( date, sizeof ( date ), "%Y-%m-%dT%H:%M:%SZ", gmtime ( &now ) );
+
+  os << "{\n";
+  os << "  \"run\": {\n";
+  os << "    \"date\": \"" << date << "\",\n";
+# if defined ( __VERSION__ )
+  os << "    \"compiler\": \"" << __VERSION__ << "\",\n";
+# endif
+  os << "    \"simd_level\": " << simd_level ( ) << ",\n";
+  os << "    \"min_time\": " << json_number ( min_time ) << ",\n";
+  os << "    \"vectors_per_region\": " << NVEC << "\n";
+  os << "  },\n";
+
+  os << "  \"timing\": [\n";
+  for ( i = 0; i < results.size ( ); i++ )
+  {
+    const bench_result &r = results[i];
+    os << "    {\"routine\": \"" << r.routine << "\", \"which\": " << r.which
+       << ", \"region\": \"" << r.region << "\", \"calls\": " << r.calls
+       << ", \"ns_per_call\": " << json_number ( r.ns )
+       << ", \"calls_per_sec\": " << json_number ( 1.0E+09 / r.ns )
+       << ", \"failures\": " << r.failures
+       << ", \"max_rel_error\": " << json_number ( r.error ) << "}"
+       << ( i + 1 < results.size ( ) ? "," : "" ) << "\n";
+  }
+  os << "  ],\n";
+
+  os << "  \"accuracy\": [\n";
+  for ( i = 0; i < acc.size ( ); i++ )
+  {
+    const bench_accuracy &a = acc[i];
+    os << "    {\"routine\": \"" << a.routine << "\", \"which\": " << a.which
+       << ", \"table\": \"" << a.table << "\", \"entries\": " << a.entries
+       << ", \"failures\": " << a.failures
+       << ", \"max_rel_error\": " << json_number ( a.error ) << "}"
+       << ( i + 1 < acc.size ( ) ? "," : "" ) << "\n";
+  }
+  os << "  ]\n";
+  os << "}\n";
+}
@@ -1,12 +1,16 @@
 # include <cstdlib>
 # include <iostream>
 # include <iomanip>
+# include <cfloat>
 # include <cmath>
 # include <ctime>
+# include <thread>
+# include <vector>
 
 using namespace std;
 
 # include "cdflib.hpp"
+# include "cdf.hpp"
 
 int main ( );
 void test005 ( );
@@ -39,6 +43,26 @@ void test24 ( );
 void test25 ( );
 void test26 ( );
 void test27 ( );
+void test28 ( );
+void test29 ( );
+void test30 ( );
+void test31 ( );
+void test32 ( );
+void test33 ( );
+void test34 ( );
+void test35 ( );
+void test36 ( );
+void test37 ( );
+void test38 ( );
+void test38_worker ( int *ind );
+void test39 ( );
+void test40 ( );
+void test41 ( );
+void test42 ( );
+void test43 ( );
+int test28_eval ( int icase, double result[] );
+void test28_worker ( int id, int reps, double *ref, int case_num,
+  int *mismatch );
 
 //****************************************************************************80
 
@@ -99,6 +123,22 @@ int main ( )
   test25 ( );
   test26 ( );
   test27 ( );
+  test28 ( );
+  test29 ( );
+  test30 ( );
+  test31 ( );
+  test32 ( );
+  test33 ( );
+  test34 ( );
+  test35 ( );
+  test36 ( );
+  test37 ( );
+  test38 ( );
+  test39 ( );
+  test40 ( );
+  test41 ( );
+  test42 ( );
+  test43 ( );
 //
 //  Terminate.
 //
@@ -2544,3 +2584,2335 @@ void test27 ( )
 
   return;
 }
+//****************************************************************************80
+
+void test28 ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST28 tests the reentrancy of the CDF* routines.
+//
+//  Discussion:
+//
+//    Every WHICH mode of every CDF* routine is evaluated once on a single
+//    thread to build a reference table.  Several threads then evaluate
+//    the same cases concurrently, each in its own rotated order, and
+//    count the results that differ from the reference.  Any routine that
+//    keeps its working variables in shared storage shows up here as a
+//    mismatch.
+//
+{
+  int case_num;
+  int i;
+  int j;
+  int mismatch_total;
+  int reps = 200;
+  int thread_num = 8;
+
+  cout << "\n";
+  cout << "TEST28\n";
+  cout << "  Concurrent evaluation of every WHICH mode of the CDF* routines\n";
+  cout << "  compared against a single-threaded reference.\n";
+
+  case_num = 0;
+  for ( ; ; )
+  {
+    double result[8];
+    if ( !test28_eval ( case_num, result ) )
+    {
+      break;
+    }
+    case_num = case_num + 1;
+  }
+
+  vector<double> ref ( 8 * case_num );
+  for ( i = 0; i < case_num; i++ )
+  {
+    test28_eval ( i, &ref[8*i] );
+  }
+
+  vector<int> mismatch ( thread_num, 0 );
+  vector<thread> workers;
+  for ( j = 0; j < thread_num; j++ )
+  {
+    workers.push_back ( thread ( test28_worker, j, reps, &ref[0], case_num,
+      &mismatch[j] ) );
+  }
+  mismatch_total = 0;
+  for ( j = 0; j < thread_num; j++ )
+  {
+    workers[j].join ( );
+    mismatch_total = mismatch_total + mismatch[j];
+  }
+
+  cout << "\n";
+  cout << "  Cases:                " << case_num << "\n";
+  cout << "  Threads:              " << thread_num << "\n";
+  cout << "  Evaluations:          " << thread_num * reps * case_num << "\n";
+  cout << "  Mismatched results:   " << mismatch_total << "\n";
+
+  return;
+}
+//****************************************************************************80
+
+int test28_eval ( int icase, double result[] )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST28_EVAL evaluates one CDF* routine in one WHICH mode.
+//
+//  Parameters:
+//
+//    Input, int ICASE, the index of the case.
+//
+//    Output, double RESULT[8], all arguments of the routine after the
+//    call, followed by STATUS and BOUND.
+//
+//    Output, int TEST28_EVAL, is 0 if ICASE is past the last case.
+//
+{
+  double a = 2.0;
+  double b = 3.0;
+  double bound;
+  double df = 6.0;
+  double dfd = 10.0;
+  double dfn = 4.0;
+  double mean = 0.2;
+  double ompr = 0.7;
+  double p = 0.3;
+  double pnonc = 1.5;
+  double pr = 0.3;
+  double q = 0.7;
+  double s = 4.0;
+  double sd = 1.7;
+  double shape = 3.0;
+  double scale = 1.5;
+  int status;
+  int which;
+  double x = 0.4;
+  double xlam = 3.5;
+  double xn = 10.0;
+  double y = 0.6;
+
+  for ( int i = 0; i < 8; i++ )
+  {
+    result[i] = 0.0;
+  }
+
+  if ( icase < 4 )
+  {
+    which = icase + 1;
+    cdfbet ( &which, &p, &q, &x, &y, &a, &b, &status, &bound );
+    result[0] = p; result[1] = q; result[2] = x; result[3] = y;
+    result[4] = a; result[5] = b;
+  }
+  else if ( icase < 8 )
+  {
+    which = icase - 3;
+    p = 0.6;
+    q = 0.4;
+    cdfbin ( &which, &p, &q, &s, &xn, &pr, &ompr, &status, &bound );
+    result[0] = p; result[1] = q; result[2] = s; result[3] = xn;
+    result[4] = pr; result[5] = ompr;
+  }
+  else if ( icase < 11 )
+  {
+    which = icase - 7;
+    x = 3.0;
+    df = 4.0;
+    cdfchi ( &which, &p, &q, &x, &df, &status, &bound );
+    result[0] = p; result[1] = q; result[2] = x; result[3] = df;
+  }
+  else if ( icase < 15 )
+  {
+    which = icase - 10;
+    x = 5.0;
+    df = 3.0;
+    cdfchn ( &which, &p, &q, &x, &df, &pnonc, &status, &bound );
+    result[0] = p; result[1] = q; result[2] = x; result[3] = df;
+    result[4] = pnonc;
+  }
+  else if ( icase < 19 )
+  {
+    which = icase - 14;
+    x = 1.5;
+    cdff ( &which, &p, &q, &x, &dfn, &dfd, &status, &bound );
+    result[0] = p; result[1] = q; result[2] = x; result[3] = dfn;
+    result[4] = dfd;
+  }
+  else if ( icase < 24 )
+  {
+    which = icase - 18;
+    x = 1.5;
+    pnonc = 2.0;
+    cdffnc ( &which, &p, &q, &x, &dfn, &dfd, &pnonc, &status, &bound );
+    result[0] = p; result[1] = q; result[2] = x; result[3] = dfn;
+    result[4] = dfd; result[5] = pnonc;
+  }
+  else if ( icase < 28 )
+  {
+    which = icase - 23;
+    x = 2.5;
+    cdfgam ( &which, &p, &q, &x, &shape, &scale, &status, &bound );
+    result[0] = p; result[1] = q; result[2] = x; result[3] = shape;
+    result[4] = scale;
+  }
+  else if ( icase < 32 )
+  {
+    which = icase - 27;
+    s = 5.0;
+    xn = 8.0;
+    pr = 0.6;
+    ompr = 0.4;
+    cdfnbn ( &which, &p, &q, &s, &xn, &pr, &ompr, &status, &bound );
+    result[0] = p; result[1] = q; result[2] = s; result[3] = xn;
+    result[4] = pr; result[5] = ompr;
+  }
+  else if ( icase < 36 )
+  {
+    which = icase - 31;
+    x = 1.3;
+    cdfnor ( &which, &p, &q, &x, &mean, &sd, &status, &bound );
+    result[0] = p; result[1] = q; result[2] = x; result[3] = mean;
+    result[4] = sd;
+  }
+  else if ( icase < 39 )
+  {
+    which = icase - 35;
+    cdfpoi ( &which, &p, &q, &s, &xlam, &status, &bound );
+    result[0] = p; result[1] = q; result[2] = s; result[3] = xlam;
+  }
+  else if ( icase < 42 )
+  {
+    which = icase - 38;
+    x = 1.2;
+    cdft ( &which, &p, &q, &x, &df, &status, &bound );
+    result[0] = p; result[1] = q; result[2] = x; result[3] = df;
+  }
+  else
+  {
+    return 0;
+  }
+
+  result[6] = ( double ) status;
+  result[7] = bound;
+
+  return 1;
+}
+//****************************************************************************80
+
+void test28_worker ( int id, int reps, double *ref, int case_num,
+  int *mismatch )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST28_WORKER is the thread body for TEST28.
+//
+//  Parameters:
+//
+//    Input, int ID, the thread index, used to rotate the case order.
+//
+//    Input, int REPS, the number of passes over the cases.
+//
+//    Input, double *REF, the single-threaded reference results.
+//
+//    Input, int CASE_NUM, the number of cases.
+//
+//    Output, int *MISMATCH, the number of results that differ from REF.
+//
+{
+  double result[8];
+
+  for ( int rep = 0; rep < reps; rep++ )
+  {
+    for ( int k = 0; k < case_num; k++ )
+    {
+      int icase = ( k + id * 5 + rep ) % case_num;
+      test28_eval ( icase, result );
+      for ( int i = 0; i < 8; i++ )
+      {
+        if ( result[i] != ref[8*icase+i] )
+        {
+          *mismatch = *mismatch + 1;
+          break;
+        }
+      }
+    }
+  }
+
+  return;
+}
+//****************************************************************************80
+
+void test29 ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST29 interleaves two DINVR searches on one thread.
+//
+//  Discussion:
+//
+//    Each search owns a DINVR_STATE, so the function values requested by
+//    one search can be supplied in between the steps of the other.  The
+//    searches solve X**3 = 2 and EXP(X) = 5 on [0,10].
+//
+{
+  double abstol = 1.0e-50;
+  double big = 10.0;
+  double fx[2];
+  int i;
+  unsigned long qhi[2];
+  unsigned long qleft[2];
+  double reltol = 1.0e-10;
+  double small = 0.0;
+  dinvr_state state[2];
+  int status[2];
+  double step = 0.5;
+  double stpmul = 5.0;
+  double x[2];
+
+  cout << "\n";
+  cout << "TEST29\n";
+  cout << "  DINVR with caller-owned state: two searches in lockstep.\n";
+  cout << "\n";
+
+  for ( i = 0; i < 2; i++ )
+  {
+    dstinv ( &state[i], &small, &big, &step, &step, &stpmul, &abstol,
+      &reltol );
+    x[i] = 1.0;
+    fx[i] = 0.0;
+    status[i] = 0;
+    dinvr ( &state[i], &status[i], &x[i], &fx[i], &qleft[i], &qhi[i] );
+  }
+
+  while ( status[0] == 1 || status[1] == 1 )
+  {
+    for ( i = 0; i < 2; i++ )
+    {
+      if ( status[i] != 1 )
+      {
+        continue;
+      }
+      if ( i == 0 )
+      {
+        fx[i] = x[i] * x[i] * x[i] - 2.0;
+      }
+      else
+      {
+        fx[i] = exp ( x[i] ) - 5.0;
+      }
+      dinvr ( &state[i], &status[i], &x[i], &fx[i], &qleft[i], &qhi[i] );
+    }
+  }
+
+  cout << "    Equation      Status  Root          Exact\n";
+  cout << "\n";
+  cout << "  X**3 = 2    "
+       << setw(8)  << status[0] << "  "
+       << setw(12) << x[0] << "  "
+       << setw(12) << pow ( 2.0, 1.0 / 3.0 ) << "\n";
+  cout << "  EXP(X) = 5  "
+       << setw(8)  << status[1] << "  "
+       << setw(12) << x[1] << "  "
+       << setw(12) << log ( 5.0 ) << "\n";
+
+  return;
+}
+//****************************************************************************80
+
+void test30 ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST30 compares CUMNOR_BATCH and DINVNR_BATCH with CUMNOR and DINVNR.
+//
+//  Discussion:
+//
+//    The batch routines are evaluated on a grid of arguments and checked
+//    against the scalar routines, and both versions are timed on the
+//    same arrays, taking the best of several passes since the timings of
+//    a shared machine vary from one pass to the next.
+//
+{
+  double ccum;
+  double cum;
+  int i;
+  double err;
+  double errp;
+  double errq;
+  double errx;
+  int n = 1000000;
+  int reps = 20;
+  int r;
+  double sum;
+  double t;
+  clock_t t0;
+  double tbatch;
+  double tscalar;
+
+  cout << "\n";
+  cout << "TEST30\n";
+  cout << "  CUMNOR_BATCH and DINVNR_BATCH against CUMNOR and DINVNR.\n";
+  cout << "  SIMD_LEVEL = " << simd_level ( ) << "\n";
+
+  vector<double> x ( n );
+  vector<double> p ( n );
+  vector<double> q ( n );
+  vector<double> p2 ( n );
+  vector<double> q2 ( n );
+  vector<double> x2 ( n );
+
+  for ( i = 0; i < n; i++ )
+  {
+    x[i] = -38.0 + 76.0 * ( double ) i / ( double ) ( n - 1 );
+  }
+//
+//  Accuracy.
+//
+  cumnor_batch ( &x[0], n, &p[0], &q[0] );
+  errp = 0.0;
+  errq = 0.0;
+  for ( i = 0; i < n; i++ )
+  {
+    cumnor ( &x[i], &cum, &ccum );
+    if ( 0.0 < cum )
+    {
+      err = fabs ( p[i] - cum ) / cum;
+      errp = errp < err ? err : errp;
+    }
+    if ( 0.0 < ccum )
+    {
+      err = fabs ( q[i] - ccum ) / ccum;
+      errq = errq < err ? err : errq;
+    }
+  }
+
+  for ( i = 0; i < n; i++ )
+  {
+    p2[i] = ( double ) ( i + 1 ) / ( double ) ( n + 1 );
+    q2[i] = 1.0 - p2[i];
+  }
+  dinvnr_batch ( &p2[0], &q2[0], n, &x2[0] );
+  errx = 0.0;
+  for ( i = 0; i < n; i++ )
+  {
+    double xs = dinvnr ( &p2[i], &q2[i] );
+    err = fabs ( x2[i] - xs ) / ( 1.0 < fabs ( xs ) ? fabs ( xs ) : 1.0 );
+    errx = errx < err ? err : errx;
+  }
+
+  cout << "\n";
+  cout << "  Maximum relative error, CUMNOR_BATCH P:  " << errp << "\n";
+  cout << "  Maximum relative error, CUMNOR_BATCH Q:  " << errq << "\n";
+  cout << "  Maximum relative error, DINVNR_BATCH X:  " << errx << "\n";
+//
+//  Throughput.
+//
+  cout << "\n";
+  cout << "  Routine     Scalar (s)    Batch (s)     Speedup\n";
+  cout << "\n";
+
+  sum = 0.0;
+  tscalar = 0.0;
+  tbatch = 0.0;
+  for ( r = 0; r < reps; r++ )
+  {
+    t0 = clock ( );
+    for ( i = 0; i < n; i++ )
+    {
+      cumnor ( &x[i], &p[i], &q[i] );
+    }
+    t = ( double ) ( clock ( ) - t0 ) / CLOCKS_PER_SEC;
+    tscalar = ( r == 0 || t < tscalar ) ? t : tscalar;
+    sum = sum + p[r];
+    t0 = clock ( );
+    cumnor_batch ( &x[0], n, &p[0], &q[0] );
+    t = ( double ) ( clock ( ) - t0 ) / CLOCKS_PER_SEC;
+    tbatch = ( r == 0 || t < tbatch ) ? t : tbatch;
+    sum = sum + p[r];
+  }
+  cout << "  CUMNOR  "
+       << setw(12) << tscalar << "  "
+       << setw(12) << tbatch << "  "
+       << setw(10) << tscalar / tbatch << "\n";
+
+  for ( r = 0; r < reps; r++ )
+  {
+    t0 = clock ( );
+    for ( i = 0; i < n; i++ )
+    {
+      x2[i] = dinvnr ( &p2[i], &q2[i] );
+    }
+    t = ( double ) ( clock ( ) - t0 ) / CLOCKS_PER_SEC;
+    tscalar = ( r == 0 || t < tscalar ) ? t : tscalar;
+    t0 = clock ( );
+    dinvnr_batch ( &p2[0], &q2[0], n, &x2[0] );
+    t = ( double ) ( clock ( ) - t0 ) / CLOCKS_PER_SEC;
+    tbatch = ( r == 0 || t < tbatch ) ? t : tbatch;
+    sum = sum + x2[0];
+  }
+  cout << "  DINVNR  "
+       << setw(12) << tscalar << "  "
+       << setw(12) << tbatch << "  "
+       << setw(10) << tscalar / tbatch << "\n";
+  cout << "\n";
+  cout << "  Times are the best of " << reps << " passes over " << n << " arguments.\n";
+  cout << "  The target for the batch routines is a speedup of 4.\n";
+
+  if ( sum != sum )
+  {
+    cout << "  (NaN in timing loop)\n";
+  }
+
+  return;
+}
+//****************************************************************************80
+
+void test31 ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST31 compares GAMMA_INC_BATCH with GAMMA_INC.
+//
+//  Discussion:
+//
+//    The arguments cover every algorithm of GAMMA_INC, including the
+//    integer and half-integer shape parameters of Poisson tails.  The
+//    batch results should agree with the scalar ones exactly.
+//
+{
+  double a;
+  int i;
+  int ind;
+  int j;
+  int mismatch;
+  int n;
+  int na = 400;
+  int nx = 500;
+  double p;
+  double q;
+  int r;
+  int reps = 20;
+  double sum;
+  clock_t t0;
+  double tbatch;
+  double tscalar;
+  double x;
+
+  cout << "\n";
+  cout << "TEST31\n";
+  cout << "  GAMMA_INC_BATCH against GAMMA_INC.\n";
+
+  n = na * nx;
+  vector<double> av ( n );
+  vector<double> xv ( n );
+  vector<double> pv ( n );
+  vector<double> qv ( n );
+//
+//  Mix integer, half-integer and general shapes on a log-spaced grid,
+//  and interleave them so that neighbours use different algorithms.
+//
+  for ( i = 0; i < na; i++ )
+  {
+    if ( i % 4 == 0 )
+    {
+      a = ( double ) ( 1 + i / 4 );
+    }
+    else if ( i % 4 == 1 )
+    {
+      a = 0.5 + ( double ) ( i / 8 );
+    }
+    else
+    {
+      a = pow ( 10.0, -3.0 + 6.0 * ( double ) i / ( double ) ( na - 1 ) );
+    }
+    for ( j = 0; j < nx; j++ )
+    {
+      x = a * pow ( 10.0, -2.0 + 3.0 * ( double ) j / ( double ) ( nx - 1 ) );
+      av[j*na+i] = a;
+      xv[j*na+i] = x;
+    }
+  }
+  av[0] = 0.0;
+  xv[1] = 0.0;
+  av[2] = -1.0;
+
+  cout << "\n";
+  cout << "  IND   Mismatches\n";
+  cout << "\n";
+  for ( ind = 0; ind <= 2; ind++ )
+  {
+    gamma_inc_batch ( &av[0], &xv[0], n, &pv[0], &qv[0], &ind );
+    mismatch = 0;
+    for ( i = 0; i < n; i++ )
+    {
+      q = 2.0;
+      gamma_inc ( &av[i], &xv[i], &p, &q, &ind );
+      if ( p != pv[i] || ( p != 2.0 && q != qv[i] ) )
+      {
+        mismatch = mismatch + 1;
+      }
+    }
+    cout << "  " << setw(3) << ind
+         << "  " << setw(12) << mismatch << "\n";
+  }
+
+  ind = 0;
+  sum = 0.0;
+  t0 = clock ( );
+  for ( r = 0; r < reps; r++ )
+  {
+    for ( i = 0; i < n; i++ )
+    {
+      gamma_inc ( &av[i], &xv[i], &pv[i], &qv[i], &ind );
+    }
+    sum = sum + pv[r];
+  }
+  tscalar = ( double ) ( clock ( ) - t0 ) / CLOCKS_PER_SEC;
+  t0 = clock ( );
+  for ( r = 0; r < reps; r++ )
+  {
+    gamma_inc_batch ( &av[0], &xv[0], n, &pv[0], &qv[0], &ind );
+    sum = sum + pv[r];
+  }
+  tbatch = ( double ) ( clock ( ) - t0 ) / CLOCKS_PER_SEC;
+
+  cout << "\n";
+  cout << "  Scalar time (s) = " << tscalar << "\n";
+  cout << "  Batch time (s) =  " << tbatch << "\n";
+  cout << "  Speedup =         " << tscalar / tbatch << "\n";
+
+  if ( sum != sum )
+  {
+    cout << "  (NaN in timing loop)\n";
+  }
+
+  return;
+}
+//****************************************************************************80
+
+void test32 ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST32 tests IRWIN_HALL_CDF, IRWIN_HALL_CDF_VALUES.
+//
+//  Discussion:
+//
+//    The computed CDF is compared with exact values, and with the
+//    alternating sum that the Edgington combination used to evaluate.
+//    The timing part covers N from 10 to 10^6 at three standard
+//    deviations below the mean.
+//
+{
+  double a;
+  double b;
+  double ccum;
+  double cum;
+  double cum_lookup;
+  double err;
+  double err_max;
+  int j;
+  int n;
+  int n_data;
+  double naive;
+  int r;
+  int reps;
+  double sum;
+  clock_t t0;
+  double term;
+  double x;
+
+  cout << "\n";
+  cout << "TEST32\n";
+  cout << "  IRWIN_HALL_CDF computes the CDF of a sum of uniforms;\n";
+  cout << "  IRWIN_HALL_CDF_VALUES looks up some exact values.\n";
+  cout << "\n";
+  cout << "       N         X   CDF (Lookup)    Rel. error    Rel. error\n";
+  cout << "                                     (Computed)    (Alternating sum)\n";
+  cout << "\n";
+
+  err_max = 0.0;
+  n_data = 0;
+
+  for ( ; ; )
+  {
+    irwin_hall_cdf_values ( &n_data, &n, &x, &cum_lookup );
+
+    if ( n_data == 0 )
+    {
+      break;
+    }
+
+    irwin_hall_cdf ( &x, &n, &cum, &ccum );
+
+    naive = 0.0;
+    for ( j = 0; j <= ( int ) x; j++ )
+    {
+      a = ( double ) ( n + 1 - j );
+      b = ( double ) ( 1 + j );
+      term = exp ( ( double ) n * log ( x - ( double ) j )
+        - gamma_log ( &a ) - gamma_log ( &b ) );
+      naive = naive + ( ( j % 2 == 0 ) ? term : -term );
+    }
+
+    err = fabs ( cum - cum_lookup ) / cum_lookup;
+    if ( err_max < err )
+    {
+      err_max = err;
+    }
+    cout << "  " << setw(6)  << n
+         << "  " << setw(8)  << x
+         << "  " << setw(12) << cum_lookup
+         << "  " << setw(12) << err
+         << "  " << setw(12) << fabs ( naive - cum_lookup ) / cum_lookup << "\n";
+  }
+  cout << "\n";
+  cout << "  Maximum relative error = " << err_max << "\n";
+
+  cout << "\n";
+  cout << "        N         X   CDF           Time per call (s)\n";
+  cout << "\n";
+  sum = 0.0;
+  for ( n = 10; n <= 1000000; n = n * 10 )
+  {
+    x = 0.5 * ( double ) n - 3.0 * sqrt ( ( double ) n / 12.0 );
+    reps = ( n <= 100 ) ? 10000 : 20;
+    t0 = clock ( );
+    for ( r = 0; r < reps; r++ )
+    {
+      irwin_hall_cdf ( &x, &n, &cum, &ccum );
+      sum = sum + cum;
+    }
+    cout << "  " << setw(7)  << n
+         << "  " << setw(8)  << x
+         << "  " << setw(12) << cum
+         << "  " << setw(12)
+         << ( double ) ( clock ( ) - t0 ) / CLOCKS_PER_SEC / ( double ) reps
+         << "\n";
+  }
+
+  if ( sum != sum )
+  {
+    cout << "  (NaN in timing loop)\n";
+  }
+
+  return;
+}
+//****************************************************************************80
+
+void test33 ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST33 checks the compile-time machine constants and times CUMNOR
+//    and GAMMA_INC.
+//
+//  Discussion:
+//
+//    The constants must equal what DPMPAR, EXPARG and IPMPAR compute
+//    from the machine table.  The timings are for arguments spread over
+//    the ranges where each routine takes its different branches.
+//
+{
+  double a;
+  double ccum;
+  double cum;
+  int i;
+  int ind;
+  int k;
+  int mismatch;
+  int n = 1000;
+  double p;
+  double q;
+  int r;
+  int reps = 2000;
+  double sum;
+  clock_t t0;
+  double x;
+
+  cout << "\n";
+  cout << "TEST33\n";
+  cout << "  Compile-time machine constants against DPMPAR, EXPARG, IPMPAR;\n";
+  cout << "  time per call of CUMNOR and GAMMA_INC.\n";
+
+  mismatch = 0;
+  k = 1;
+  mismatch = mismatch + ( dpmpar ( &k ) != dpmpar_eps );
+  k = 2;
+  mismatch = mismatch + ( dpmpar ( &k ) != dpmpar_tiny );
+  k = 3;
+  mismatch = mismatch + ( dpmpar ( &k ) != dpmpar_huge );
+  k = 0;
+  mismatch = mismatch + ( exparg ( &k ) != exparg_max );
+  k = 1;
+  mismatch = mismatch + ( exparg ( &k ) != exparg_min );
+  k = 3;
+  mismatch = mismatch + ( ipmpar ( &k ) != ipmpar_int_max );
+
+  cout << "\n";
+  cout << "  Mismatching constants = " << mismatch << "\n";
+
+  vector<double> xv ( n );
+  vector<double> av ( n );
+  for ( i = 0; i < n; i++ )
+  {
+    xv[i] = -8.0 + 16.0 * ( double ) i / ( double ) ( n - 1 );
+    av[i] = pow ( 10.0, -1.0 + 3.0 * ( double ) ( ( i * 37 ) % n ) / ( double ) n );
+  }
+
+  cout << "\n";
+  cout << "  Routine          Time per call (ns)\n";
+  cout << "\n";
+
+  sum = 0.0;
+  t0 = clock ( );
+  for ( r = 0; r < reps; r++ )
+  {
+    for ( i = 0; i < n; i++ )
+    {
+      cumnor ( &xv[i], &cum, &ccum );
+      sum = sum + cum;
+    }
+  }
+  cout << "  CUMNOR         " << setw(12)
+       << 1.0E+09 * ( double ) ( clock ( ) - t0 ) / CLOCKS_PER_SEC
+          / ( double ) reps / ( double ) n << "\n";
+
+  ind = 0;
+  t0 = clock ( );
+  for ( r = 0; r < reps / 10; r++ )
+  {
+    for ( i = 0; i < n; i++ )
+    {
+      a = av[i];
+      x = a * ( 1.0 + 0.5 * xv[i] / sqrt ( a + 1.0 ) );
+      if ( x < 0.0 )
+      {
+        x = 0.01 * a;
+      }
+      gamma_inc ( &a, &x, &p, &q, &ind );
+      sum = sum + p;
+    }
+  }
+  cout << "  GAMMA_INC      " << setw(12)
+       << 1.0E+09 * ( double ) ( clock ( ) - t0 ) / CLOCKS_PER_SEC
+          / ( double ) ( reps / 10 ) / ( double ) n << "\n";
+
+  if ( sum != sum )
+  {
+    cout << "  (NaN in timing loop)\n";
+  }
+
+  return;
+}
+//****************************************************************************80
+
+void test34 ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST34 compares PREPAREDGAMMA, PREPAREDBETA, PREPAREDCHI2 and
+//    PREPAREDT with CUMGAM, CUMBET, CUMCHI and CUMT.
+//
+//  Discussion:
+//
+//    The results must agree exactly.  The parameters and arguments are
+//    chosen to reach every branch of GAMMA_INC and BETA_INC.  The times
+//    are per call, over the same arguments.
+//
+{
+  static const double ag[9] = {
+    0.3, 0.5, 1.0, 2.5, 7.0, 15.0, 30.0, 150.0, 3000.0 };
+  static const double ab[10][2] = {
+    { 0.3, 0.7 }, { 0.5, 5.5 }, { 0.5, 20.0 }, { 3.0, 4.5 }, { 2.0, 50.0 },
+    { 12.0, 12.0 }, { 150.0, 300.0 }, { 1000.0, 1500.0 }, { 0.5, 300.0 },
+    { 7.5, 0.5 } };
+  static const double dfc[5] = { 1.0, 3.0, 10.0, 60.0, 500.0 };
+  static const double dft[6] = { 1.0, 3.0, 10.0, 30.0, 200.0, 5000.0 };
+  double a;
+  double b;
+  double ccum;
+  double ccum2;
+  double cum;
+  double cum2;
+  double df;
+  int i;
+  int k;
+  int mismatch;
+  int n = 2000;
+  int r;
+  int reps = 20;
+  double sum;
+  clock_t t0;
+  double t1;
+  double t2;
+  double x;
+  double y;
+
+  cout << "\n";
+  cout << "TEST34\n";
+  cout << "  PREPAREDGAMMA, PREPAREDBETA, PREPAREDCHI2 and PREPAREDT\n";
+  cout << "  against CUMGAM, CUMBET, CUMCHI and CUMT: mismatches, and\n";
+  cout << "  time per call (ns) over all parameters.\n";
+  cout << "\n";
+  cout << "  Distribution  Mismatches    CUM*      Prepared\n";
+  cout << "\n";
+
+  vector<double> u ( n );
+  for ( i = 0; i < n; i++ )
+  {
+    u[i] = ( ( double ) i + 0.5 ) / ( double ) n;
+  }
+  sum = 0.0;
+//
+//  Gamma.
+//
+  mismatch = 0;
+  t1 = t2 = 0.0;
+  for ( k = 0; k < 9; k++ )
+  {
+    a = ag[k];
+    PreparedGamma g ( a );
+    vector<double> xv ( n );
+    for ( i = 0; i < n; i++ )
+    {
+      xv[i] = a * exp ( 6.0 * ( u[i] - 0.5 ) / sqrt ( a ) );
+      cumgam ( &xv[i], &a, &cum, &ccum );
+      g.eval ( xv[i], &cum2, &ccum2 );
+      mismatch = mismatch + ( cum != cum2 || ccum != ccum2 );
+      mismatch = mismatch + ( g.cdf ( xv[i] ) != cum || g.sf ( xv[i] ) != ccum );
+    }
+    t0 = clock ( );
+    for ( r = 0; r < reps; r++ )
+    {
+      for ( i = 0; i < n; i++ )
+      {
+        cumgam ( &xv[i], &a, &cum, &ccum );
+        sum = sum + cum;
+      }
+    }
+    t1 = t1 + ( double ) ( clock ( ) - t0 );
+    t0 = clock ( );
+    for ( r = 0; r < reps; r++ )
+    {
+      for ( i = 0; i < n; i++ )
+      {
+        sum = sum + g.cdf ( xv[i] );
+      }
+    }
+    t2 = t2 + ( double ) ( clock ( ) - t0 );
+  }
+  cout << "  Gamma     " << setw(12) << mismatch
+       << setw(12) << 1.0E+09 * t1 / CLOCKS_PER_SEC / ( double ) ( 9 * reps * n )
+       << setw(12) << 1.0E+09 * t2 / CLOCKS_PER_SEC / ( double ) ( 9 * reps * n )
+       << "\n";
+//
+//  Beta.
+//
+  mismatch = 0;
+  t1 = t2 = 0.0;
+  for ( k = 0; k < 10; k++ )
+  {
+    a = ab[k][0];
+    b = ab[k][1];
+    PreparedBeta be ( a, b );
+    vector<double> xv ( n );
+    for ( i = 0; i < n; i++ )
+    {
+      xv[i] = u[i];
+      y = 1.0 - xv[i];
+      cumbet ( &xv[i], &y, &a, &b, &cum, &ccum );
+      be.eval ( xv[i], y, &cum2, &ccum2 );
+      mismatch = mismatch + ( cum != cum2 || ccum != ccum2 );
+      mismatch = mismatch + ( be.cdf ( xv[i] ) != cum || be.sf ( xv[i] ) != ccum );
+    }
+    t0 = clock ( );
+    for ( r = 0; r < reps; r++ )
+    {
+      for ( i = 0; i < n; i++ )
+      {
+        y = 1.0 - xv[i];
+        cumbet ( &xv[i], &y, &a, &b, &cum, &ccum );
+        sum = sum + cum;
+      }
+    }
+    t1 = t1 + ( double ) ( clock ( ) - t0 );
+    t0 = clock ( );
+    for ( r = 0; r < reps; r++ )
+    {
+      for ( i = 0; i < n; i++ )
+      {
+        sum = sum + be.cdf ( xv[i] );
+      }
+    }
+    t2 = t2 + ( double ) ( clock ( ) - t0 );
+  }
+  cout << "  Beta      " << setw(12) << mismatch
+       << setw(12) << 1.0E+09 * t1 / CLOCKS_PER_SEC / ( double ) ( 10 * reps * n )
+       << setw(12) << 1.0E+09 * t2 / CLOCKS_PER_SEC / ( double ) ( 10 * reps * n )
+       << "\n";
+//
+//  Chi-square.
+//
+  mismatch = 0;
+  t1 = t2 = 0.0;
+  for ( k = 0; k < 5; k++ )
+  {
+    df = dfc[k];
+    PreparedChi2 c ( df );
+    vector<double> xv ( n );
+    for ( i = 0; i < n; i++ )
+    {
+      xv[i] = df * exp ( 8.0 * ( u[i] - 0.5 ) / sqrt ( df ) );
+      cumchi ( &xv[i], &df, &cum, &ccum );
+      c.eval ( xv[i], &cum2, &ccum2 );
+      mismatch = mismatch + ( cum != cum2 || ccum != ccum2 );
+      mismatch = mismatch + ( c.cdf ( xv[i] ) != cum || c.sf ( xv[i] ) != ccum );
+    }
+    t0 = clock ( );
+    for ( r = 0; r < reps; r++ )
+    {
+      for ( i = 0; i < n; i++ )
+      {
+        cumchi ( &xv[i], &df, &cum, &ccum );
+        sum = sum + ccum;
+      }
+    }
+    t1 = t1 + ( double ) ( clock ( ) - t0 );
+    t0 = clock ( );
+    for ( r = 0; r < reps; r++ )
+    {
+      for ( i = 0; i < n; i++ )
+      {
+        sum = sum + c.sf ( xv[i] );
+      }
+    }
+    t2 = t2 + ( double ) ( clock ( ) - t0 );
+  }
+  cout << "  Chi2      " << setw(12) << mismatch
+       << setw(12) << 1.0E+09 * t1 / CLOCKS_PER_SEC / ( double ) ( 5 * reps * n )
+       << setw(12) << 1.0E+09 * t2 / CLOCKS_PER_SEC / ( double ) ( 5 * reps * n )
+       << "\n";
+//
+//  Student's T.
+//
+  mismatch = 0;
+  t1 = t2 = 0.0;
+  for ( k = 0; k < 6; k++ )
+  {
+    df = dft[k];
+    PreparedT st ( df );
+    vector<double> xv ( n );
+    for ( i = 0; i < n; i++ )
+    {
+      x = 20.0 * ( u[i] - 0.5 );
+      xv[i] = x * fabs ( x );
+      cumt ( &xv[i], &df, &cum, &ccum );
+      st.eval ( xv[i], &cum2, &ccum2 );
+      mismatch = mismatch + ( cum != cum2 || ccum != ccum2 );
+      mismatch = mismatch + ( st.cdf ( xv[i] ) != cum || st.sf ( xv[i] ) != ccum );
+    }
+    t0 = clock ( );
+    for ( r = 0; r < reps; r++ )
+    {
+      for ( i = 0; i < n; i++ )
+      {
+        cumt ( &xv[i], &df, &cum, &ccum );
+        sum = sum + cum;
+      }
+    }
+    t1 = t1 + ( double ) ( clock ( ) - t0 );
+    t0 = clock ( );
+    for ( r = 0; r < reps; r++ )
+    {
+      for ( i = 0; i < n; i++ )
+      {
+        sum = sum + st.cdf ( xv[i] );
+      }
+    }
+    t2 = t2 + ( double ) ( clock ( ) - t0 );
+  }
+  cout << "  T         " << setw(12) << mismatch
+       << setw(12) << 1.0E+09 * t1 / CLOCKS_PER_SEC / ( double ) ( 6 * reps * n )
+       << setw(12) << 1.0E+09 * t2 / CLOCKS_PER_SEC / ( double ) ( 6 * reps * n )
+       << "\n";
+
+  if ( sum != sum )
+  {
+    cout << "  (NaN in timing loop)\n";
+  }
+
+  return;
+}
+//****************************************************************************80
+
+void test35 ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST35 checks the DINVH inversions in CDFCHI, CDFT, CDFF, CDFPOI,
+//    CDFBIN and CDFNBN, and counts their CDF evaluations.
+//
+//  Discussion:
+//
+//    Each solve is checked by recomputing the tail probability it was
+//    asked to match.  CDF_EVALS gives the number of evaluations of the
+//    CDF per solve.  For comparison, the chi-square quantile is also
+//    found with DINVR, using the search parameters CDFCHI had before.
+//
+{
+  static const double dfs[6] = { 0.5, 1.0, 3.0, 10.0, 100.0, 1000.0 };
+  static const double ps[10] = {
+    1.0E-10, 1.0E-04, 0.01, 0.1, 0.3, 0.5, 0.7, 0.9, 0.99, 0.9999 };
+  double a;
+  double atol = 1.0E-50;
+  double b;
+  double big = 1.0E+300;
+  double bound;
+  double ccum;
+  double cum;
+  double e;
+  double err[7];
+  long evals[7];
+  double fx;
+  int i;
+  int j;
+  int k;
+  dinvr_state istate;
+  double K4 = 0.5;
+  double K5 = 5.0;
+  int n;
+  double ompr;
+  double p;
+  double pr;
+  double q;
+  unsigned long qhi;
+  unsigned long qleft;
+  double s;
+  double small = 0.0;
+  int status;
+  double tol = 1.0E-08;
+  int which;
+  double x;
+  double xn;
+  static const char *name[7] = {
+    "CDFCHI  X   ", "CDFT    T   ", "CDFF    F   ", "CDFPOI  XLAM",
+    "CDFBIN  PR  ", "CDFNBN  PR  ", "DINVR   X   " };
+
+  cout << "\n";
+  cout << "TEST35\n";
+  cout << "  Quantile and parameter solves by DINVH, or by GAMMA_INC_INV\n";
+  cout << "  for CDFCHI and CDFPOI: largest relative error in the matched\n";
+  cout << "  tail probability, and CDF evaluations per solve, reported\n";
+  cout << "  by CDF_EVALS.\n";
+  cout << "\n";
+  cout << "  Routine Solves for    Max error   Evaluations\n";
+  cout << "\n";
+
+  for ( k = 0; k < 7; k++ )
+  {
+    err[k] = 0.0;
+    evals[k] = 0;
+  }
+  n = 0;
+
+  for ( i = 0; i < 6; i++ )
+  {
+    for ( j = 0; j < 10; j++ )
+    {
+      p = ps[j];
+      q = 1.0 - p;
+      a = dfs[i];
+      s = floor ( a );
+      n = n + 1;
+
+      which = 2;
+      cdfchi ( &which, &p, &q, &x, &a, &status, &bound );
+      evals[0] = evals[0] + cdf_evals ( );
+      cumchi ( &x, &a, &cum, &ccum );
+      e = ( p <= q ) ? fabs ( cum - p ) / p : fabs ( ccum - q ) / q;
+      err[0] = fmax ( err[0], status == 0 ? e : 1.0 );
+
+      which = 2;
+      cdft ( &which, &p, &q, &x, &a, &status, &bound );
+      evals[1] = evals[1] + cdf_evals ( );
+      cumt ( &x, &a, &cum, &ccum );
+      e = ( p <= q ) ? fabs ( cum - p ) / p : fabs ( ccum - q ) / q;
+      err[1] = fmax ( err[1], status == 0 ? e : 1.0 );
+
+      which = 2;
+      b = 3.0 * a + 1.0;
+      cdff ( &which, &p, &q, &x, &a, &b, &status, &bound );
+      evals[2] = evals[2] + cdf_evals ( );
+      cumf ( &x, &a, &b, &cum, &ccum );
+      e = ( p <= q ) ? fabs ( cum - p ) / p : fabs ( ccum - q ) / q;
+      err[2] = fmax ( err[2], status == 0 ? e : 1.0 );
+
+      which = 3;
+      cdfpoi ( &which, &p, &q, &s, &x, &status, &bound );
+      evals[3] = evals[3] + cdf_evals ( );
+      cumpoi ( &s, &x, &cum, &ccum );
+      e = ( p <= q ) ? fabs ( cum - p ) / p : fabs ( ccum - q ) / q;
+      err[3] = fmax ( err[3], status == 0 ? e : 1.0 );
+
+      which = 4;
+      xn = 2.0 * s + 5.0;
+      cdfbin ( &which, &p, &q, &s, &xn, &pr, &ompr, &status, &bound );
+      evals[4] = evals[4] + cdf_evals ( );
+      cumbin ( &s, &xn, &pr, &ompr, &cum, &ccum );
+      e = ( p <= q ) ? fabs ( cum - p ) / p : fabs ( ccum - q ) / q;
+      err[4] = fmax ( err[4], status == 0 ? e : 1.0 );
+
+      which = 4;
+      cdfnbn ( &which, &p, &q, &s, &a, &pr, &ompr, &status, &bound );
+      evals[5] = evals[5] + cdf_evals ( );
+      cumnbn ( &s, &a, &pr, &ompr, &cum, &ccum );
+      e = ( p <= q ) ? fabs ( cum - p ) / p : fabs ( ccum - q ) / q;
+      err[5] = fmax ( err[5], status == 0 ? e : 1.0 );
+
+      x = 5.0;
+      dstinv ( &istate, &small, &big, &K4, &K4, &K5, &atol, &tol );
+      status = 0;
+      dinvr ( &istate, &status, &x, &fx, &qleft, &qhi );
+      while ( status == 1 )
+      {
+        cumchi ( &x, &a, &cum, &ccum );
+        fx = ( p <= q ) ? cum - p : ccum - q;
+        dinvr ( &istate, &status, &x, &fx, &qleft, &qhi );
+      }
+      evals[6] = evals[6] + cdf_evals ( );
+      cumchi ( &x, &a, &cum, &ccum );
+      e = ( p <= q ) ? fabs ( cum - p ) / p : fabs ( ccum - q ) / q;
+      err[6] = fmax ( err[6], status == 0 ? e : 1.0 );
+    }
+  }
+
+  for ( k = 0; k < 7; k++ )
+  {
+    cout << "  " << name[k]
+         << "  " << setw(12) << err[k]
+         << "  " << setw(12) << ( double ) evals[k] / ( double ) n << "\n";
+  }
+
+  return;
+}
+//****************************************************************************80
+
+void test36 ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST36 checks the PDF* routines against the CUM* routines.
+//
+//  Discussion:
+//
+//    For the continuous distributions, the density is integrated by
+//    Simpson's rule over intervals [X1,X2] and compared with
+//    CUM(X2) - CUM(X1).  For the discrete ones, the probability of S is
+//    compared with CUM(S) - CUM(S-1).  The largest absolute difference is
+//    listed.  The batch routines must agree exactly with the scalar ones.
+//
+//    CUMCHN truncates its series too early to serve as a reference, so
+//    the noncentral chi-square CDF is summed here as a Poisson mixture
+//    of CUMCHI values.
+//
+{
+  static const double par[4] = { 0.7, 2.0, 9.5, 60.0 };
+  static const double ends[5] = { 0.05, 0.5, 1.5, 4.0, 12.0 };
+  double a;
+  double b;
+  double c1;
+  double c2;
+  double cc;
+  double cp;
+  double d;
+  double err[10];
+  double h;
+  int i;
+  int j;
+  int k;
+  int l;
+  int m = 200;
+  int mismatch;
+  int n;
+  double ompr;
+  double pr;
+  double s;
+  double sm;
+  double sum;
+  double w;
+  double x;
+  double x1;
+  double x2;
+  double xn;
+  double y;
+  static const char *name[10] = {
+    "PDFNOR", "PDFGAM", "PDFBET", "PDFCHI", "PDFCHN",
+    "PDFF  ", "PDFT  ", "PDFPOI", "PDFBIN", "PDFNBN" };
+
+  cout << "\n";
+  cout << "TEST36\n";
+  cout << "  PDF* against CUM*: largest difference between the integral\n";
+  cout << "  of the density and the CDF difference, or between the\n";
+  cout << "  probability of S and CUM(S) - CUM(S-1).\n";
+  cout << "\n";
+
+  for ( k = 0; k < 10; k++ )
+  {
+    err[k] = 0.0;
+  }
+//
+//  Continuous distributions: Simpson's rule on [X1,X2], scaled by the
+//  parameter A where that sets the scale.
+//
+  for ( i = 0; i < 4; i++ )
+  {
+    a = par[i];
+    b = par[3-i];
+    for ( j = 0; j < 4; j++ )
+    {
+      for ( k = 0; k < 7; k++ )
+      {
+        if ( k == 0 || k == 6 )
+        {
+          x1 = 2.0 * ends[j] - 3.0;
+          x2 = 2.0 * ends[j+1] - 3.0;
+        }
+        else if ( k == 2 )
+        {
+          x1 = ends[j] / 13.0;
+          x2 = ends[j+1] / 13.0;
+        }
+        else if ( k == 1 || k == 3 || k == 4 )
+        {
+          x1 = ends[j] * a;
+          x2 = ends[j+1] * a;
+        }
+        else
+        {
+          x1 = ends[j];
+          x2 = ends[j+1];
+        }
+        h = ( x2 - x1 ) / ( double ) m;
+        sum = 0.0;
+        for ( l = 0; l <= m; l++ )
+        {
+          x = x1 + h * ( double ) l;
+          y = 1.0 - x;
+          w = ( l == 0 || l == m ) ? 1.0 : ( ( l % 2 ) ? 4.0 : 2.0 );
+          if ( k == 0 ) d = pdfnor ( &x );
+          else if ( k == 1 ) d = pdfgam ( &x, &a );
+          else if ( k == 2 ) d = pdfbet ( &x, &y, &a, &b );
+          else if ( k == 3 ) d = pdfchi ( &x, &a );
+          else if ( k == 4 ) d = pdfchn ( &x, &a, &b );
+          else if ( k == 5 ) d = pdff ( &x, &a, &b );
+          else d = pdft ( &x, &a );
+          sum = sum + w * d;
+        }
+        sum = sum * h / 3.0;
+        for ( l = 0; l < 2; l++ )
+        {
+          x = ( l == 0 ) ? x1 : x2;
+          y = 1.0 - x;
+          if ( k == 0 ) cumnor ( &x, &c2, &cc );
+          else if ( k == 1 ) cumgam ( &x, &a, &c2, &cc );
+          else if ( k == 2 ) cumbet ( &x, &y, &a, &b, &c2, &cc );
+          else if ( k == 3 ) cumchi ( &x, &a, &c2, &cc );
+          else if ( k == 4 )
+          {
+            c2 = 0.0;
+            for ( n = 0; n < 400; n++ )
+            {
+              d = a + 2.0 * ( double ) n;
+              cumchi ( &x, &d, &cp, &cc );
+              c2 = c2 + exp ( - 0.5 * b + ( double ) n * log ( 0.5 * b )
+                - lgamma ( ( double ) n + 1.0 ) ) * cp;
+            }
+          }
+          else if ( k == 5 ) cumf ( &x, &a, &b, &c2, &cc );
+          else cumt ( &x, &a, &c2, &cc );
+          if ( l == 0 )
+          {
+            c1 = c2;
+          }
+        }
+        err[k] = fmax ( err[k], fabs ( sum - ( c2 - c1 ) ) );
+      }
+    }
+  }
+//
+//  Discrete distributions.
+//
+  for ( i = 0; i < 4; i++ )
+  {
+    a = par[i];
+    pr = 0.05 + 0.3 * ( double ) i;
+    ompr = 1.0 - pr;
+    xn = floor ( par[3-i] ) + 1.0;
+    for ( j = 0; j <= 20; j++ )
+    {
+      s = ( double ) j;
+      sm = s - 1.0;
+      cumpoi ( &s, &a, &c2, &cc );
+      c1 = 0.0;
+      if ( 0 < j ) cumpoi ( &sm, &a, &c1, &cc );
+      err[7] = fmax ( err[7], fabs ( pdfpoi ( &s, &a ) - ( c2 - c1 ) ) );
+      if ( s <= xn )
+      {
+        cumbin ( &s, &xn, &pr, &ompr, &c2, &cc );
+        c1 = 0.0;
+        if ( 0 < j ) cumbin ( &sm, &xn, &pr, &ompr, &c1, &cc );
+        err[8] = fmax ( err[8], fabs ( pdfbin ( &s, &xn, &pr, &ompr ) - ( c2 - c1 ) ) );
+      }
+      cumnbn ( &s, &a, &pr, &ompr, &c2, &cc );
+      c1 = 0.0;
+      if ( 0 < j ) cumnbn ( &sm, &a, &pr, &ompr, &c1, &cc );
+      err[9] = fmax ( err[9], fabs ( pdfnbn ( &s, &a, &pr, &ompr ) - ( c2 - c1 ) ) );
+    }
+  }
+
+  cout << "  Routine      Max difference\n";
+  cout << "\n";
+  for ( k = 0; k < 10; k++ )
+  {
+    cout << "  " << name[k] << "  " << setw(16) << err[k] << "\n";
+  }
+//
+//  Batch against scalar.
+//
+  vector<double> xv ( 41 );
+  vector<double> yv ( 41 );
+  vector<double> fv ( 41 );
+  for ( l = 0; l <= 40; l++ )
+  {
+    xv[l] = ( double ) l / 40.0;
+    yv[l] = 1.0 - xv[l];
+  }
+  mismatch = 0;
+  a = 2.5;
+  b = 7.0;
+  pr = 0.3;
+  ompr = 0.7;
+  xn = 40.0;
+  for ( k = 0; k < 10; k++ )
+  {
+    if ( k == 0 ) logpdfnor_batch ( &xv[0], 41, &fv[0] );
+    else if ( k == 1 ) logpdfgam_batch ( &xv[0], 41, &a, &fv[0] );
+    else if ( k == 2 ) logpdfbet_batch ( &xv[0], &yv[0], 41, &a, &b, &fv[0] );
+    else if ( k == 3 ) logpdfchi_batch ( &xv[0], 41, &a, &fv[0] );
+    else if ( k == 4 ) logpdfchn_batch ( &xv[0], 41, &a, &b, &fv[0] );
+    else if ( k == 5 ) logpdff_batch ( &xv[0], 41, &a, &b, &fv[0] );
+    else if ( k == 6 ) logpdft_batch ( &xv[0], 41, &a, &fv[0] );
+    else if ( k == 7 ) logpdfpoi_batch ( &xv[0], 41, &a, &fv[0] );
+    else if ( k == 8 ) logpdfbin_batch ( &xv[0], 41, &xn, &pr, &ompr, &fv[0] );
+    else logpdfnbn_batch ( &xv[0], 41, &a, &pr, &ompr, &fv[0] );
+    for ( l = 0; l <= 40; l++ )
+    {
+      x = xv[l];
+      y = yv[l];
+      if ( k == 0 ) d = logpdfnor ( &x );
+      else if ( k == 1 ) d = logpdfgam ( &x, &a );
+      else if ( k == 2 ) d = logpdfbet ( &x, &y, &a, &b );
+      else if ( k == 3 ) d = logpdfchi ( &x, &a );
+      else if ( k == 4 ) d = logpdfchn ( &x, &a, &b );
+      else if ( k == 5 ) d = logpdff ( &x, &a, &b );
+      else if ( k == 6 ) d = logpdft ( &x, &a );
+      else if ( k == 7 ) d = logpdfpoi ( &x, &a );
+      else if ( k == 8 ) d = logpdfbin ( &x, &xn, &pr, &ompr );
+      else d = logpdfnbn ( &x, &a, &pr, &ompr );
+      mismatch = mismatch + ( d != fv[l] );
+    }
+  }
+  cout << "\n";
+  cout << "  Batch values that differ from the scalar ones = " << mismatch << "\n";
+
+  return;
+}
+//****************************************************************************80
+
+void test37 ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST37 builds a Poisson confidence belt with CDFPOI_BATCH.
+//
+//  Discussion:
+//
+//    For S = 0, ..., N-1 the central 95% limits on the mean are the
+//    solutions of P(S-1,XLO) = 0.975 and P(S,XHI) = 0.025.  The batch
+//    results must equal those of CDFPOI, and the CDFCHI_BATCH quantiles
+//    2*XHI with 2*S+2 degrees of freedom must match XHI.
+//
+{
+  double bound;
+  vector<double> bv;
+  vector<double> cv;
+  vector<double> dv;
+  double err;
+  int i;
+  int mismatch;
+  int n = 2000;
+  double p;
+  vector<double> pv;
+  double q;
+  vector<double> qv;
+  double s;
+  vector<int> sv;
+  int status;
+  vector<double> svv;
+  clock_t t0;
+  double tbatch;
+  int which;
+  double xlam;
+  vector<double> xv;
+
+  cout << "\n";
+  cout << "TEST37\n";
+  cout << "  CDFPOI_BATCH computes the 95% central confidence belt\n";
+  cout << "  of a Poisson mean for S = 0, ..., " << n - 1 << ".\n";
+  cout << "\n";
+
+  pv.resize ( 2 * n );
+  qv.resize ( 2 * n );
+  svv.resize ( 2 * n );
+  xv.resize ( 2 * n );
+  bv.resize ( 2 * n );
+  sv.resize ( 2 * n );
+  for ( i = 0; i < n; i++ )
+  {
+    pv[i] = 0.975;
+    qv[i] = 0.025;
+    svv[i] = ( double ) i - 1.0;
+    pv[n+i] = 0.025;
+    qv[n+i] = 0.975;
+    svv[n+i] = ( double ) i;
+  }
+//
+//  There is no lower limit for S = 0.
+//
+  svv[0] = 0.0;
+  which = 3;
+  t0 = clock ( );
+  cdfpoi_batch ( &which, &pv[0], &qv[0], &svv[0], &xv[0], 2 * n, &sv[0],
+    &bv[0] );
+  tbatch = ( double ) ( clock ( ) - t0 ) / CLOCKS_PER_SEC;
+  xv[0] = 0.0;
+
+  mismatch = 0;
+  for ( i = 1; i < 2 * n; i++ )
+  {
+    p = pv[i];
+    q = qv[i];
+    s = svv[i];
+    cdfpoi ( &which, &p, &q, &s, &xlam, &status, &bound );
+    mismatch = mismatch + ( xlam != xv[i] || status != sv[i] );
+  }
+//
+//  The upper limits as chi square quantiles.
+//
+  dv.resize ( n );
+  cv.resize ( n );
+  for ( i = 0; i < n; i++ )
+  {
+    dv[i] = 2.0 * ( double ) i + 2.0;
+  }
+  which = 2;
+  cdfchi_batch ( &which, &qv[n], &pv[n], &cv[0], &dv[0], n, &sv[0], &bv[0] );
+  err = 0.0;
+  for ( i = 0; i < n; i++ )
+  {
+    err = fmax ( err, fabs ( 0.5 * cv[i] - xv[n+i] ) / xv[n+i] );
+  }
+
+  cout << "       S         Lower           Upper\n";
+  cout << "\n";
+  for ( i = 0; i < n; i = ( i < 10 ) ? i + 3 : 10 * i )
+  {
+    cout << "  " << setw(6) << i
+         << "  " << setw(14) << xv[i]
+         << "  " << setw(14) << xv[n+i] << "\n";
+  }
+  cout << "\n";
+  cout << "  Batch limits that differ from CDFPOI = " << mismatch << "\n";
+  cout << "  Largest relative difference from CDFCHI_BATCH = " << err << "\n";
+  cout << "  Limits per millisecond = "
+       << ( tbatch > 0.0 ? 2.0 * n / ( 1000.0 * tbatch ) : 0.0 ) << "\n";
+
+  return;
+}
+//****************************************************************************80
+
+void test38 ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST38 checks the accuracy requests of GAMMA_INC.
+//
+//  Discussion:
+//
+//    CUMGAM is evaluated with each thread setting over a range of shape
+//    parameters, and compared with the full accuracy values.  The
+//    largest relative error, in whichever tail is smaller, must stay
+//    below the bound that GAMMA_INC_IND assumes.  A new thread must
+//    start at full accuracy.
+//
+{
+  double a;
+  vector<double> av;
+  double ccum;
+  double cum;
+  double err;
+  int i;
+  int ind;
+  int ind_new;
+  int j;
+  int n = 20000;
+  vector<double> qv;
+  static const double relerr[3] = { 5.0e-15, 5.0e-07, 5.0e-04 };
+  clock_t t0;
+  double t;
+  vector<double> xv;
+
+  cout << "\n";
+  cout << "TEST38\n";
+  cout << "  CUMGAM at the accuracy requests of GAMMA_INC_SET_ACCURACY:\n";
+  cout << "  largest relative error in the smaller tail, and time.\n";
+  cout << "\n";
+
+  av.resize ( n );
+  xv.resize ( n );
+  qv.resize ( n );
+  for ( i = 0; i < n; i++ )
+  {
+    a = exp ( -2.0 + 9.0 * ( double ) i / ( double ) n );
+    av[i] = a;
+    xv[i] = a * ( 1.0 + 3.0 * sin ( ( double ) i ) / sqrt ( a + 1.0 ) );
+    if ( xv[i] <= 0.0 )
+    {
+      xv[i] = 0.01 * a;
+    }
+  }
+
+  cout << "   IND   Bound        Max error     Time (s)\n";
+  cout << "\n";
+  for ( ind = 0; ind < 3; ind++ )
+  {
+    gamma_inc_set_accuracy ( ind );
+    err = 0.0;
+    t0 = clock ( );
+    for ( j = 0; j < 20; j++ )
+    {
+      for ( i = 0; i < n; i++ )
+      {
+        cumgam ( &xv[i], &av[i], &cum, &ccum );
+        if ( ind == 0 )
+        {
+          qv[i] = fmin ( cum, ccum );
+        }
+        else
+        {
+          err = fmax ( err, fabs ( fmin ( cum, ccum ) - qv[i] ) / qv[i] );
+        }
+      }
+    }
+    t = ( double ) ( clock ( ) - t0 ) / CLOCKS_PER_SEC;
+    cout << "  " << setw(4) << ind
+         << "  " << setw(10) << relerr[ind]
+         << "  " << setw(12) << err
+         << "  " << setw(10) << t << "\n";
+  }
+
+  thread worker ( test38_worker, &ind_new );
+  worker.join ( );
+  gamma_inc_set_accuracy ( 0 );
+
+  cout << "\n";
+  cout << "  Accuracy request of a new thread = " << ind_new << "\n";
+  cout << "\n";
+  cout << "  GAMMA_INC_IND and GAMMA_INC_IND_NSIGMA for a relative\n";
+  cout << "  error of 1.0E-04:\n";
+  cout << "\n";
+  cout << "    P-value: " << gamma_inc_ind ( 1.0E-04 ) << "\n";
+  for ( j = 1; j <= 7; j = j + 2 )
+  {
+    cout << "    " << j << " sigma: "
+         << gamma_inc_ind_nsigma ( 1.0E-04, ( double ) j ) << "\n";
+  }
+  cout << "  and of 1.0E-07:\n";
+  cout << "\n";
+  cout << "    P-value: " << gamma_inc_ind ( 1.0E-07 ) << "\n";
+  for ( j = 1; j <= 7; j = j + 2 )
+  {
+    cout << "    " << j << " sigma: "
+         << gamma_inc_ind_nsigma ( 1.0E-07, ( double ) j ) << "\n";
+  }
+
+  return;
+}
+//****************************************************************************80
+
+void test38_worker ( int *ind )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST38_WORKER reports the accuracy request of a new thread.
+//
+//  Parameters:
+//
+//    Output, int *IND, the value of GAMMA_INC_ACCURACY.
+//
+{
+  *ind = gamma_inc_accuracy ( );
+  return;
+}
+//****************************************************************************80
+
+void test39 ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST39 checks the log tail probabilities.
+//
+//  Discussion:
+//
+//    CUMNOR_LOG is compared with CUMNOR where that does not underflow,
+//    and with the asymptotic series of the normal tail beyond; DINVNR_LOG
+//    must recover the argument from the log of the smaller tail out to
+//    1000 standard deviations.  GAMMA_INC_LOG and BETA_INC_LOG are
+//    compared with Poisson and binomial tail sums, added up in log space,
+//    for tails down to 10^-6000.
+//
+{
+  double a;
+  double b;
+  double ccum;
+  double cum;
+  double err;
+  int i;
+  int ind = 0;
+  int ierr;
+  double k;
+  double lccum;
+  double lcum;
+  double lexact;
+  double lmax;
+  double lp;
+  double lq;
+  double lsum;
+  double lt;
+  double nb;
+  double s;
+  double x;
+  double y;
+  double z;
+  static const double gam_a[5] = { 2000.0, 3.0, 10000.0, 1.0, 50.0 };
+  static const double gam_x[5] = { 100.0, 1000.0, 1000.0, 800.0, 10.0 };
+  static const double bin_n[4] = { 1000.0, 2000000.0, 100.0, 5000.0 };
+  static const double bin_k[4] = { 500.0, 1042500.0, 1.0, 4000.0 };
+  static const double bin_p[4] = { 0.01, 0.5, 0.999, 0.1 };
+
+  cout << "\n";
+  cout << "TEST39\n";
+  cout << "  CUMNOR_LOG, DINVNR_LOG, GAMMA_INC_LOG and BETA_INC_LOG\n";
+  cout << "  compute the logs of tail probabilities that underflow.\n";
+  cout << "\n";
+//
+//  Normal tails.
+//
+  err = 0.0;
+  for ( i = -300; i <= 300; i++ )
+  {
+    x = 0.1 * ( double ) i + 0.01;
+    cumnor ( &x, &cum, &ccum );
+    cumnor_log ( &x, &lcum, &lccum );
+    err = fmax ( err, fabs ( lcum - log ( cum ) ) / fmax ( 1.0, fabs ( log ( cum ) ) ) );
+    err = fmax ( err, fabs ( lccum - log ( ccum ) ) / fmax ( 1.0, fabs ( log ( ccum ) ) ) );
+  }
+  cout << "  CUMNOR_LOG against CUMNOR, |x| <= 30:      " << err << "\n";
+
+  err = 0.0;
+  for ( i = 50; i <= 1000; i = i + 10 )
+  {
+    x = ( double ) i;
+    z = 1.0 / ( x * x );
+    lexact = - 0.5 * x * x - log ( x * sqrt ( 2.0 * M_PI ) )
+      + log1p ( z * ( -1.0 + z * ( 3.0 + z * ( -15.0 + z * 105.0 ) ) ) );
+    cumnor_log ( &x, &lcum, &lccum );
+    err = fmax ( err, fabs ( lccum - lexact ) / fabs ( lexact ) );
+    y = -x;
+    cumnor_log ( &y, &lcum, &lccum );
+    err = fmax ( err, fabs ( lcum - lexact ) / fabs ( lexact ) );
+  }
+  cout << "  CUMNOR_LOG against asymptotic series, 50 <= |x| <= 1000:  "
+       << err << "\n";
+
+  err = 0.0;
+  for ( i = -1000; i <= 1000; i++ )
+  {
+    x = ( double ) i + 0.37;
+    cumnor_log ( &x, &lcum, &lccum );
+    y = dinvnr_log ( &lcum, &lccum );
+    err = fmax ( err, fabs ( y - x ) / fmax ( 1.0, fabs ( x ) ) );
+  }
+  cout << "  DINVNR_LOG round trip, |x| <= 1000:        " << err << "\n";
+//
+//  Gamma tails: P(a,x) = Pr ( N >= a ) and Q(a,x) = Pr ( N < a ) for
+//  N Poisson with mean x and integer a.
+//
+  cout << "\n";
+  cout << "         A            X    Log P(a,x)     Log Q(a,x)    Rel. error\n";
+  cout << "\n";
+  for ( i = 0; i < 5; i++ )
+  {
+    a = gam_a[i];
+    x = gam_x[i];
+    gamma_inc_log ( &a, &x, &lp, &lq, &ind );
+    lt = ( a < x ) ? lq : lp;
+    lmax = -HUGE_VAL;
+    lsum = 0.0;
+    for ( k = ( a < x ) ? a - 1.0 : a; 0.0 <= k; k = ( a < x ) ? k - 1.0 : k + 1.0 )
+    {
+      s = -x + k * log ( x ) - lgamma ( k + 1.0 );
+      if ( lmax == -HUGE_VAL )
+      {
+        lmax = s;
+      }
+      lsum = lsum + exp ( s - lmax );
+      if ( s < lmax - 40.0 )
+      {
+        break;
+      }
+    }
+    lexact = lmax + log ( lsum );
+    cout << "  " << setw(8) << a
+         << "  " << setw(11) << x
+         << "  " << setw(12) << lp
+         << "  " << setw(12) << lq
+         << "  " << setw(12) << fabs ( lt - lexact ) / fabs ( lexact ) << "\n";
+  }
+//
+//  Beta tails: I_p(k, n-k+1) = Pr ( S >= k ) for S binomial (n,p).
+//
+  cout << "\n";
+  cout << "         N            K       P    Log I_p        Log 1-I_p     Rel. error\n";
+  cout << "\n";
+  for ( i = 0; i < 4; i++ )
+  {
+    nb = bin_n[i];
+    a = bin_k[i];
+    b = nb - a + 1.0;
+    x = bin_p[i];
+    y = 1.0 - x;
+    beta_inc_log ( &a, &b, &x, &y, &lp, &lq, &ierr );
+    lt = ( a < nb * x ) ? lq : lp;
+    lmax = -HUGE_VAL;
+    lsum = 0.0;
+    for ( k = ( a < nb * x ) ? a - 1.0 : a; 0.0 <= k && k <= nb;
+      k = ( a < nb * x ) ? k - 1.0 : k + 1.0 )
+    {
+      s = lgamma ( nb + 1.0 ) - lgamma ( k + 1.0 ) - lgamma ( nb - k + 1.0 )
+        + k * log ( x ) + ( nb - k ) * log1p ( -x );
+      if ( lmax == -HUGE_VAL )
+      {
+        lmax = s;
+      }
+      lsum = lsum + exp ( s - lmax );
+      if ( s < lmax - 40.0 )
+      {
+        break;
+      }
+    }
+    lexact = lmax + log ( lsum );
+    cout << "  " << setw(8) << nb
+         << "  " << setw(11) << a
+         << "  " << setw(6) << x
+         << "  " << setw(12) << lp
+         << "  " << setw(12) << lq
+         << "  " << setw(12) << fabs ( lt - lexact ) / fabs ( lexact ) << "\n";
+  }
+
+  return;
+}
+//****************************************************************************80
+
+void test40 ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST40 checks the value interface of cdf.hpp.
+//
+//  Discussion:
+//
+//    Every CDF:: function must return exactly what the pointer routine
+//    returns, and searches must report the same status.  The time per
+//    call of CUMNOR and CDF::NORMAL_CDF is compared in a loop like that
+//    of a quadrature rule.
+//
+{
+  double a;
+  double b;
+  double bound;
+  double ccum;
+  double cum;
+  double df;
+  int i;
+  int ierr;
+  double lccum;
+  double lcum;
+  int mismatch;
+  int n = 4000000;
+  double p;
+  double q;
+  double s;
+  double sum1;
+  double sum2;
+  int status;
+  clock_t t0;
+  double t1;
+  double t2;
+  int which;
+  double x;
+  double x0;
+  double y;
+
+  cout << "\n";
+  cout << "TEST40\n";
+  cout << "  The value interface CDF:: against the pointer routines.\n";
+  cout << "\n";
+
+  mismatch = 0;
+  for ( i = 0; i < 2000; i++ )
+  {
+    x = -40.0 + 0.04 * ( double ) i;
+    cumnor ( &x, &cum, &ccum );
+    mismatch += ( cdf::normal_cdf ( x ) != cum );
+    mismatch += ( cdf::normal_sf ( x ) != ccum );
+    cumnor_log ( &x, &lcum, &lccum );
+    mismatch += ( cdf::normal_logcdf ( x ) != lcum );
+    mismatch += ( cdf::normal_logsf ( x ) != lccum );
+    mismatch += ( cdf::normal_pdf ( x ) != pdfnor ( &x ) );
+
+    p = ( ( double ) i + 0.5 ) / 2000.0;
+    q = 1.0 - p;
+    mismatch += ( cdf::normal_quantile ( p ) != dinvnr ( &p, &q ) );
+
+    a = 0.1 + 0.05 * ( double ) i;
+    b = 30.0 / a;
+    y = 0.02 * ( double ) i;
+    gamma_inc ( &a, &y, &cum, &ccum, &gamma_inc_thread_ind );
+    mismatch += ( cdf::gamma_p ( a, y ) != cum );
+    mismatch += ( cdf::gamma_q ( a, y ) != ccum );
+
+    q = 1.0 - p;
+    beta_inc ( &a, &b, &p, &q, &cum, &ccum, &ierr );
+    mismatch += ( cdf::beta_p ( a, b, p ) != cum );
+    mismatch += ( cdf::beta_q ( a, b, p ) != ccum );
+
+    df = 2.0 * a;
+    cumchi ( &y, &df, &cum, &ccum );
+    mismatch += ( cdf::chi2_cdf ( y, df ) != cum );
+    mismatch += ( cdf::chi2_sf ( y, df ) != ccum );
+
+    cumt ( &x, &df, &cum, &ccum );
+    mismatch += ( cdf::t_cdf ( x, df ) != cum );
+    mismatch += ( cdf::t_sf ( x, df ) != ccum );
+
+    s = ( double ) ( i % 40 );
+    cumpoi ( &s, &a, &cum, &ccum );
+    mismatch += ( cdf::poisson_cdf ( i % 40, a ) != cum );
+    mismatch += ( cdf::poisson_sf ( s, a ) != ccum );
+
+    b = 60.0;
+    cumbin ( &s, &b, &p, &q, &cum, &ccum );
+    mismatch += ( cdf::binomial_cdf ( s, 60, p ) != cum );
+    mismatch += ( cdf::binomial_sf ( s, b, p ) != ccum );
+
+    which = 2;
+    cdfchi ( &which, &p, &q, &x0, &df, &status, &bound );
+    cdf::result<double> r = cdf::chi2_quantile ( p, df );
+    mismatch += ( r.status != status || ( status == 0 && *r != x0 ) );
+    which = 3;
+    cdfpoi ( &which, &p, &q, &s, &x0, &status, &bound );
+    r = cdf::poisson_mean ( p, s );
+    mismatch += ( r.status != status || ( status == 0 && *r != x0 ) );
+  }
+  cout << "  Mismatches in 38000 comparisons: " << mismatch << "\n";
+
+  cdf::result<double> r = cdf::t_quantile ( 1.5, 3.0 );
+  cout << "  T_QUANTILE ( 1.5, 3 ): status = " << r.status
+       << ", bound = " << r.bound << ", value_or ( -1 ) = "
+       << r.value_or ( -1.0 ) << "\n";
+//
+//  Timing, on a grid of points as in a quadrature rule.
+//
+  sum1 = 0.0;
+  t0 = clock ( );
+  for ( i = 0; i < n; i++ )
+  {
+    x = -8.0 + 16.0 * ( ( double ) i + 0.5 ) / ( double ) n;
+    cumnor ( &x, &cum, &ccum );
+    sum1 = sum1 + cum;
+  }
+  t1 = ( double ) ( clock ( ) - t0 ) / CLOCKS_PER_SEC;
+
+  sum2 = 0.0;
+  t0 = clock ( );
+  for ( i = 0; i < n; i++ )
+  {
+    x = -8.0 + 16.0 * ( ( double ) i + 0.5 ) / ( double ) n;
+    sum2 = sum2 + cdf::normal_cdf ( x );
+  }
+  t2 = ( double ) ( clock ( ) - t0 ) / CLOCKS_PER_SEC;
+
+  cout << "\n";
+  cout << "  Time per call (ns), " << n << " calls:\n";
+  cout << "    CUMNOR:          " << 1.0E+09 * t1 / ( double ) n << "\n";
+  cout << "    CDF::NORMAL_CDF: " << 1.0E+09 * t2 / ( double ) n << "\n";
+  cout << "  Sums agree: " << ( sum1 == sum2 ) << "\n";
+
+  return;
+}
+//****************************************************************************80
+
+void test41 ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST41 checks the single precision kernels of cdf.hpp.
+//
+//  Discussion:
+//
+//    Each float kernel is compared with the double routine over its
+//    range, and the largest relative error is reported; for the normal
+//    CDF it is the error of the smaller tail, down to 1.0E-36.
+//    CUMNOR_BATCH_F is checked the same way against CUMNOR_BATCH, since
+//    the vector build may contract multiplies and adds differently from
+//    the scalar one, and the two batch routines are timed.
+//
+{
+  float cf;
+  float cqf;
+  double ccum;
+  double cum;
+  double e;
+  double emax[5];
+  float *fp;
+  float *fq;
+  float *fx;
+  int i;
+  int ierr;
+  int n = 4000000;
+  double *p;
+  double *q;
+  double t1;
+  double t2;
+  clock_t t0;
+  double x;
+  float xf;
+  double *xx;
+
+  cout << "\n";
+  cout << "TEST41\n";
+  cout << "  Single precision kernels against the double routines.\n";
+  cout << "\n";
+
+  for ( i = 0; i < 5; i++ )
+  {
+    emax[i] = 0.0;
+  }
+
+  for ( i = 0; i < 200000; i++ )
+  {
+    xf = ( float ) ( -12.5 + 25.0 * ( ( double ) i + 0.5 ) / 200000.0 );
+    x = ( double ) xf;
+    cumnor ( &x, &cum, &ccum );
+    cdf::detail::cumnor ( xf, cf, cqf );
+    e = x < 0.0 ? fabs ( cf - cum ) / cum : fabs ( cqf - ccum ) / ccum;
+    emax[0] = max ( emax[0], e );
+
+    xf = ( float ) ( -9.0 + 18.0 * ( ( double ) i + 0.5 ) / 200000.0 );
+    x = ( double ) xf;
+    e = fabs ( cdf::erf ( xf ) - error_f ( &x ) ) / fabs ( error_f ( &x ) );
+    emax[1] = max ( emax[1], e );
+    ierr = 0;
+    e = fabs ( cdf::erfc ( xf ) - error_fc ( &ierr, &x ) )
+      / error_fc ( &ierr, &x );
+    emax[2] = max ( emax[2], e );
+
+    xf = ( float ) ( -0.9 + 3.0 * ( ( double ) i + 0.5 ) / 200000.0 );
+    x = ( double ) xf;
+    e = fabs ( cdf::detail::alnrel ( xf ) - alnrel ( &x ) )
+      / fabs ( alnrel ( &x ) );
+    emax[3] = max ( emax[3], e );
+    e = fabs ( cdf::detail::rlog1 ( xf ) - rlog1 ( &x ) ) / rlog1 ( &x );
+    emax[4] = max ( emax[4], e );
+  }
+
+  cout << "  Largest relative error:\n";
+  cout << "    CUMNOR, -12.5 <= X <= 12.5: " << emax[0] << "\n";
+  cout << "    ERF,      -9 <= X <= 9:    " << emax[1] << "\n";
+  cout << "    ERFC,     -9 <= X <= 9:    " << emax[2] << "\n";
+  cout << "    ALNREL, -0.9 <= A <= 2.1:  " << emax[3] << "\n";
+  cout << "    RLOG1,  -0.9 <= X <= 2.1:  " << emax[4] << "\n";
+//
+//  The float batch routine against the double one.
+//
+  xx = new double[n];
+  p = new double[n];
+  q = new double[n];
+  fx = new float[n];
+  fp = new float[n];
+  fq = new float[n];
+
+  for ( i = 0; i < n; i++ )
+  {
+    fx[i] = ( float ) ( -8.0 + 16.0 * ( ( double ) i + 0.5 ) / ( double ) n );
+    xx[i] = ( double ) fx[i];
+  }
+
+  t0 = clock ( );
+  cumnor_batch ( xx, n, p, q );
+  t1 = ( double ) ( clock ( ) - t0 ) / CLOCKS_PER_SEC;
+  t0 = clock ( );
+  cumnor_batch_f ( fx, n, fp, fq );
+  t2 = ( double ) ( clock ( ) - t0 ) / CLOCKS_PER_SEC;
+
+  emax[0] = 0.0;
+  for ( i = 0; i < n; i++ )
+  {
+    e = xx[i] < 0.0 ? fabs ( fp[i] - p[i] ) / p[i]
+      : fabs ( fq[i] - q[i] ) / q[i];
+    emax[0] = max ( emax[0], e );
+  }
+
+  cout << "\n";
+  cout << "  CUMNOR_BATCH_F against CUMNOR_BATCH, " << n << " values:\n";
+  cout << "    Largest relative error: " << emax[0] << "\n";
+  cout << "  Time per value (ns):\n";
+  cout << "    CUMNOR_BATCH:   " << 1.0E+09 * t1 / ( double ) n << "\n";
+  cout << "    CUMNOR_BATCH_F: " << 1.0E+09 * t2 / ( double ) n << "\n";
+
+  delete [] xx;
+  delete [] p;
+  delete [] q;
+  delete [] fx;
+  delete [] fp;
+  delete [] fq;
+
+  return;
+}
+//****************************************************************************80
+
+void test42 ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST42 checks CUMNOR_LOG_BATCH against CUMNOR_LOG.
+//
+//  Discussion:
+//
+//    The logs of both tails are compared from -60 to 60, where the
+//    smaller tail of CUMNOR underflows beyond 37.5, and at a few far out
+//    points.  The errors are relative to the log of each tail; the log of
+//    the larger tail is left out where it is a subnormal number.  The
+//    batch routine is timed against a loop over CUMNOR_LOG.
+//
+{
+  double emax[2];
+  int i;
+  double lcum;
+  double lccum;
+  double *lp;
+  double *lq;
+  int n = 4000000;
+  double t1;
+  double t2;
+  clock_t t0;
+  double *x;
+  double xfar[8] = { -1.0E+06, -1.0E+03, -200.0, -40.0,
+    40.0, 200.0, 1.0E+03, 1.0E+06 };
+
+  cout << "\n";
+  cout << "TEST42\n";
+  cout << "  CUMNOR_LOG_BATCH against CUMNOR_LOG.\n";
+  cout << "\n";
+
+  x = new double[n];
+  lp = new double[n];
+  lq = new double[n];
+
+  for ( i = 0; i < n; i++ )
+  {
+    x[i] = -60.0 + 120.0 * ( ( double ) i + 0.5 ) / ( double ) n;
+  }
+  for ( i = 0; i < 8; i++ )
+  {
+    x[i] = xfar[i];
+  }
+  for ( i = 0; i < n; i++ )
+  {
+    lp[i] = 0.0;
+    lq[i] = 0.0;
+  }
+
+  t0 = clock ( );
+  cumnor_log_batch ( x, n, lp, lq );
+  t1 = ( double ) ( clock ( ) - t0 ) / CLOCKS_PER_SEC;
+
+  emax[0] = 0.0;
+  emax[1] = 0.0;
+  t0 = clock ( );
+  for ( i = 0; i < n; i++ )
+  {
+    cumnor_log ( x + i, &lcum, &lccum );
+    if ( x[i] < 0.0 )
+    {
+      emax[0] = max ( emax[0], fabs ( lp[i] - lcum ) / fabs ( lcum ) );
+      if ( DBL_MIN <= fabs ( lccum ) )
+      {
+        emax[1] = max ( emax[1], fabs ( lq[i] - lccum ) / fabs ( lccum ) );
+      }
+    }
+    else
+    {
+      emax[0] = max ( emax[0], fabs ( lq[i] - lccum ) / fabs ( lccum ) );
+      if ( DBL_MIN <= fabs ( lcum ) )
+      {
+        emax[1] = max ( emax[1], fabs ( lp[i] - lcum ) / fabs ( lcum ) );
+      }
+    }
+  }
+  t2 = ( double ) ( clock ( ) - t0 ) / CLOCKS_PER_SEC;
+
+  cout << "  " << n << " values, -60 <= X <= 60 and |X| up to 1.0E+06:\n";
+  cout << "  Largest relative error of the log:\n";
+  cout << "    Smaller tail: " << emax[0] << "\n";
+  cout << "    Larger tail:  " << emax[1] << "\n";
+  cout << "  Time per value (ns):\n";
+  cout << "    CUMNOR_LOG_BATCH:        " << 1.0E+09 * t1 / ( double ) n << "\n";
+  cout << "    CUMNOR_LOG, with checks: " << 1.0E+09 * t2 / ( double ) n << "\n";
+
+  delete [] x;
+  delete [] lp;
+  delete [] lq;
+
+  return;
+}
+//****************************************************************************80
+
+void test43 ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    TEST43 checks the batch normal routines at the ends of their range.
+//
+//  Discussion:
+//
+//    CUMNOR_LOG_BATCH is compared with CUMNOR_LOG for arguments beyond
+//    1.0E+14, where the batch routine stops splitting X*X, up to where the
+//    log of the smaller tail overflows to -infinity, and DINVNR_BATCH
+//    with DINVNR at P = 0 and Q = 0, which give -infinity and +infinity.
+//    Values that differ by more than a relative 1.0E-14 are flagged.
+//
+{
+  double e;
+  int i;
+  double lcum;
+  double lccum;
+  double lp[10];
+  double lq[10];
+  int n = 10;
+  double p[4] = { 0.0, 1.0, 1.0E-300, 0.5 };
+  double q[4] = { 1.0, 0.0, 1.0, 0.5 };
+  double x[10] = { -HUGE_VAL, -1.0E+300, -1.0E+160, -1.0E+100, -1.0E+15,
+    1.0E+15, 1.0E+100, 1.0E+160, 1.0E+300, HUGE_VAL };
+  double xb[4];
+  double xs;
+
+  cout << "\n";
+  cout << "TEST43\n";
+  cout << "  CUMNOR_LOG_BATCH and DINVNR_BATCH at the ends of their range.\n";
+  cout << "\n";
+  cout << "          X      log CUM (batch)     log CUM (scalar)"
+       << "    log CCUM (batch)    log CCUM (scalar)\n";
+  cout << "\n";
+
+  cumnor_log_batch ( x, n, lp, lq );
+  for ( i = 0; i < n; i++ )
+  {
+    cumnor_log ( x + i, &lcum, &lccum );
+    e = max ( fabs ( lp[i] - lcum ), fabs ( lq[i] - lccum ) );
+    cout << "  " << setw ( 9 ) << x[i]
+         << "  " << setw ( 19 ) << lp[i]
+         << "  " << setw ( 19 ) << lcum
+         << "  " << setw ( 19 ) << lq[i]
+         << "  " << setw ( 19 ) << lccum;
+    if ( ! ( lp[i] == lcum && lq[i] == lccum )
+      && ! ( e <= 1.0E-14 * max ( fabs ( lcum ), fabs ( lccum ) ) ) )
+    {
+      cout << "  MISMATCH";
+    }
+    cout << "\n";
+  }
+
+  cout << "\n";
+  cout << "          P           Q      X (batch)         X (scalar)\n";
+  cout << "\n";
+
+  dinvnr_batch ( p, q, 4, xb );
+  for ( i = 0; i < 4; i++ )
+  {
+    xs = dinvnr ( p + i, q + i );
+    cout << "  " << setw ( 9 ) << p[i]
+         << "  " << setw ( 9 ) << q[i]
+         << "  " << setw ( 14 ) << xb[i]
+         << "  " << setw ( 14 ) << xs;
+    if ( ! ( xb[i] == xs ) && ! ( fabs ( xb[i] - xs ) <= 1.0E-14 * fabs ( xs ) ) )
+    {
+      cout << "  MISMATCH";
+    }
+    cout << "\n";
+  }
+
+  return;
+}
@@ -91,14 +91,16 @@ void cdfnbn ( int *which, double *p, double *q, double *s, double *xn,
 # define inf 1.0e300
 # define one 1.0e0
 
-  static int K1 = 1;
-  static double K2 = 0.0e0;
-  static double K4 = 0.5e0;
-  static double K5 = 5.0e0;
-  static double K11 = 1.0e0;
-  static double fx,xhi,xlo,pq,prompr,cum,ccum;
-  static unsigned long qhi,qleft,qporq;
-  static double T3,T6,T7,T8,T9,T10,T12,T13;
+  double K2 = 0.0e0;
+  double K4 = 0.5e0;
+  double K5 = 5.0e0;
+  double K11 = 1.0e0;
+  double fx,pq,prompr,cum,ccum;
+  unsigned long qhi,qleft,qporq;
+  dinvr_state istate;
+  dinvh_state hstate;
+  double alpha,beta,dfx,d2fx,lnc,omx0,x0,T14,T15,T16;
+  double T3,T6,T7,T8,T9,T10,T12,T13;
 
   *status = 0;
   *bound = 0.0;
@@ -200,7 +202,7 @@ S220:
 //     P + Q
 //
     pq = *p+*q;
-    if(!(fabs(pq-0.5e0-0.5e0) > 3.0e0*dpmpar(&K1))) goto S260;
+    if(!(fabs(pq-0.5e0-0.5e0) > 3.0e0*dpmpar_eps)) goto S260;
     if(!(pq < 0.0e0)) goto S240;
     *bound = 0.0e0;
     goto S250;
@@ -216,7 +218,7 @@ S260:
 //     PR + OMPR
 //
     prompr = *pr+*ompr;
-    if(!(fabs(prompr-0.5e0-0.5e0) > 3.0e0*dpmpar(&K1))) goto S300;
+    if(!(fabs(prompr-0.5e0-0.5e0) > 3.0e0*dpmpar_eps)) goto S300;
     if(!(prompr < 0.0e0)) goto S280;
     *bound = 0.0e0;
     goto S290;
@@ -247,9 +249,9 @@ S300:
         T3 = inf;
         T6 = atol;
         T7 = tol;
-        dstinv(&K2,&T3,&K4,&K4,&K5,&T6,&T7);
+        dstinv(&istate,&K2,&T3,&K4,&K4,&K5,&T6,&T7);
         *status = 0;
-        dinvr(status,s,&fx,&qleft,&qhi);
+        dinvr(&istate,status,s,&fx,&qleft,&qhi);
 S320:
         if(!(*status == 1)) goto S350;
         cumnbn(s,xn,pr,ompr,&cum,&ccum);
@@ -259,7 +261,7 @@ S320:
 S330:
         fx = ccum-*q;
 S340:
-        dinvr(status,s,&fx,&qleft,&qhi);
+        dinvr(&istate,status,s,&fx,&qleft,&qhi);
         goto S320;
 S350:
         if(!(*status == -1)) goto S380;
@@ -282,9 +284,9 @@ S370:
         T8 = inf;
         T9 = atol;
         T10 = tol;
-        dstinv(&K2,&T8,&K4,&K4,&K5,&T9,&T10);
+        dstinv(&istate,&K2,&T8,&K4,&K4,&K5,&T9,&T10);
         *status = 0;
-        dinvr(status,xn,&fx,&qleft,&qhi);
+        dinvr(&istate,status,xn,&fx,&qleft,&qhi);
 S390:
         if(!(*status == 1)) goto S420;
         cumnbn(s,xn,pr,ompr,&cum,&ccum);
@@ -294,7 +296,7 @@ S390:
 S400:
         fx = ccum-*q;
 S410:
-        dinvr(status,xn,&fx,&qleft,&qhi);
+        dinvr(&istate,status,xn,&fx,&qleft,&qhi);
         goto S390;
 S420:
         if(!(*status == -1)) goto S450;
@@ -312,32 +314,56 @@ S440:
     else if(4 == *which) {
 //
 //     Calculating PR and OMPR
-//
+//     .. CUM is the Beta(XN,S+1) CDF in PR, so start from the
+//        beta approximation and use the beta density
+//
+        alpha = *xn;
+        beta = *s+1.0e0;
+        if(beta > 0.0e0) {
+            lnc = -beta_log(&alpha,&beta);
+            T14 = 2.0e0*alpha;
+            T15 = 2.0e0*beta;
+            T16 = alpha*stvalf(&T14,&T15,p,q);
+            x0 = T16/(beta+T16);
+            omx0 = beta/(beta+T16);
+        }
+        else {
+            lnc = 0.0e0;
+            x0 = omx0 = 0.5e0;
+        }
         T12 = atol;
         T13 = tol;
-        dstzr(&K2,&K11,&T12,&T13);
-        if(!qporq) goto S480;
+        dstinh(&hstate,&K2,&K11,&T12,&T13);
+        if(!(x0 <= omx0)) goto S480;
+        *pr = x0;
         *status = 0;
-        dzror(status,pr,&fx,&xlo,&xhi,&qleft,&qhi);
+        dinvh(&hstate,status,pr,&fx,&dfx,&d2fx,&qleft,&qhi);
         *ompr = one-*pr;
 S460:
         if(!(*status == 1)) goto S470;
         cumnbn(s,xn,pr,ompr,&cum,&ccum);
-        fx = cum-*p;
-        dzror(status,pr,&fx,&xlo,&xhi,&qleft,&qhi);
+        dfx = exp(lnc+(alpha-1.0e0)*log(*pr)+(beta-1.0e0)*log(*ompr));
+        d2fx = dfx*((alpha-1.0e0)/ *pr-(beta-1.0e0)/ *ompr);
+        if(qporq) dlnres(&cum,p,1,&fx,&dfx,&d2fx);
+        else dlnres(&ccum,q,0,&fx,&dfx,&d2fx);
+        dinvh(&hstate,status,pr,&fx,&dfx,&d2fx,&qleft,&qhi);
         *ompr = one-*pr;
         goto S460;
 S470:
         goto S510;
 S480:
+        *ompr = omx0;
         *status = 0;
-        dzror(status,ompr,&fx,&xlo,&xhi,&qleft,&qhi);
+        dinvh(&hstate,status,ompr,&fx,&dfx,&d2fx,&qleft,&qhi);
         *pr = one-*ompr;
 S490:
         if(!(*status == 1)) goto S500;
         cumnbn(s,xn,pr,ompr,&cum,&ccum);
-        fx = ccum-*q;
-        dzror(status,ompr,&fx,&xlo,&xhi,&qleft,&qhi);
+        dfx = exp(lnc+(alpha-1.0e0)*log(*pr)+(beta-1.0e0)*log(*ompr));
+        d2fx = -(dfx*((alpha-1.0e0)/ *pr-(beta-1.0e0)/ *ompr));
+        if(qporq) dlnres(&cum,p,0,&fx,&dfx,&d2fx);
+        else dlnres(&ccum,q,1,&fx,&dfx,&d2fx);
+        dinvh(&hstate,status,ompr,&fx,&dfx,&d2fx,&qleft,&qhi);
         *pr = one-*ompr;
         goto S490;
 S510:
@@ -85,8 +85,7 @@ void cdfnor ( int *which, double *p, double *q, double *x, double *mean,
 //    if STATUS is 1 or 2, this is the search bound that was exceeded.
 //
 {
-  static int K1 = 1;
-  static double z,pq;
+  double z,pq;
 
   *status = 0;
   *bound = 0.0;
@@ -139,7 +138,7 @@ S100:
 //     P + Q
 //
     pq = *p+*q;
-    if(!(fabs(pq-0.5e0-0.5e0) > 3.0e0*dpmpar(&K1))) goto S140;
+    if(!(fabs(pq-0.5e0-0.5e0) > 3.0e0*dpmpar_eps)) goto S140;
     if(!(pq < 0.0e0)) goto S120;
     *bound = 0.0e0;
     goto S130;
@@ -24,7 +24,9 @@ void cdfpoi ( int *which, double *p, double *q, double *s, double *xlam,
 //
 //    Computation of other parameters involve a seach for a value that
 //    produces the desired value of P.  The search relies on the
-//    monotonicity of P with respect to the other parameters.
+//    monotonicity of P with respect to the other parameters.  XLAM is
+//    the exception: Q is the incomplete gamma ratio P(S+1,XLAM), so XLAM
+//    is its inverse, which GAMMA_INC_INV usually computes without a search.
 //
 //  Reference:
 //
@@ -74,13 +76,15 @@ void cdfpoi ( int *which, double *p, double *q, double *s, double *xlam,
 # define atol (1.0e-50)
 # define inf 1.0e300
 
-  static int K1 = 1;
-  static double K2 = 0.0e0;
-  static double K4 = 0.5e0;
-  static double K5 = 5.0e0;
-  static double fx,cum,ccum,pq;
-  static unsigned long qhi,qleft,qporq;
-  static double T3,T6,T7,T8,T9,T10;
+  double K2 = 0.0e0;
+  double K4 = 0.5e0;
+  double K5 = 5.0e0;
+  double fx,dfx,d2fx,cum,ccum,lnc,pq,sp1;
+  int ierr;
+  unsigned long qhi,qleft,qporq;
+  dinvr_state istate;
+  dinvh_state hstate;
+  double T2,T3,T6,T7,T8,T9,T10;
 
   *status = 0;
   *bound = 0.0;
@@ -152,7 +156,7 @@ S140:
 //     P + Q
 //
     pq = *p+*q;
-    if(!(fabs(pq-0.5e0-0.5e0) > 3.0e0*dpmpar(&K1))) goto S180;
+    if(!(fabs(pq-0.5e0-0.5e0) > 3.0e0*dpmpar_eps)) goto S180;
     if(!(pq < 0.0e0)) goto S160;
     *bound = 0.0e0;
     goto S170;
@@ -183,9 +187,9 @@ S180:
         T3 = inf;
         T6 = atol;
         T7 = tol;
-        dstinv(&K2,&T3,&K4,&K4,&K5,&T6,&T7);
+        dstinv(&istate,&K2,&T3,&K4,&K4,&K5,&T6,&T7);
         *status = 0;
-        dinvr(status,s,&fx,&qleft,&qhi);
+        dinvr(&istate,status,s,&fx,&qleft,&qhi);
 S200:
         if(!(*status == 1)) goto S230;
         cumpoi(s,xlam,&cum,&ccum);
@@ -195,7 +199,7 @@ S200:
 S210:
         fx = ccum-*q;
 S220:
-        dinvr(status,s,&fx,&qleft,&qhi);
+        dinvr(&istate,status,s,&fx,&qleft,&qhi);
         goto S200;
 S230:
         if(!(*status == -1)) goto S260;
@@ -213,24 +217,40 @@ S250:
     else if(3 == *which) {
 //
 //     Calculating XLAM
-//
-        *xlam = 5.0e0;
+//     .. CCUM = P(S+1,XLAM) is the gamma CDF in XLAM, so XLAM is the
+//        inverse incomplete gamma ratio at Q.  GAMMA_INC_INV finds it
+//        directly unless Q or P is too small for its Schroder iteration;
+//        then its estimate, or the gamma approximation, starts a search
+//        that uses the gamma density
+//
+        sp1 = *s+1.0e0;
+        T2 = -1.0e0;
+        gamma_inc_inv(&sp1,xlam,&T2,q,p,&ierr);
+        if(!(ierr >= 0 && *xlam <= inf)) goto S265;
+        cdf_eval_count = ierr;
+        *status = 0;
+        goto S330;
+S265:
+        if(!(*xlam > 0.0e0 && *xlam <= inf)) *xlam = stvalg(&sp1,q,p);
+        lnc = -gamma_log(&sp1);
         T8 = inf;
         T9 = atol;
         T10 = tol;
-        dstinv(&K2,&T8,&K4,&K4,&K5,&T9,&T10);
+        dstinh(&hstate,&K2,&T8,&T9,&T10);
         *status = 0;
-        dinvr(status,xlam,&fx,&qleft,&qhi);
+        dinvh(&hstate,status,xlam,&fx,&dfx,&d2fx,&qleft,&qhi);
 S270:
         if(!(*status == 1)) goto S300;
         cumpoi(s,xlam,&cum,&ccum);
+        dfx = exp(lnc+*s*log(*xlam)-*xlam);
+        d2fx = dfx*(*s/ *xlam-1.0e0);
         if(!qporq) goto S280;
-        fx = cum-*p;
+        dlnres(&cum,p,0,&fx,&dfx,&d2fx);
         goto S290;
 S280:
-        fx = ccum-*q;
+        dlnres(&ccum,q,1,&fx,&dfx,&d2fx);
 S290:
-        dinvr(status,xlam,&fx,&qleft,&qhi);
+        dinvh(&hstate,status,xlam,&fx,&dfx,&d2fx,&qleft,&qhi);
         goto S270;
 S300:
         if(!(*status == -1)) goto S330;
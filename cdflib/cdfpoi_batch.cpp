@@ -0,0 +1,50 @@
+# include <iomanip>
+# include <cmath>
+using namespace std;
+# include "cdflib.hpp"
+
+//****************************************************************************80
+
+void cdfpoi_batch ( int *which, double *p, double *q, double *s, double *xlam,
+  size_t n, int *status, double *bound )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    CDFPOI_BATCH applies CDFPOI to arrays of Poisson parameters.
+//
+//  Discussion:
+//
+//    Element I of every array is one call of CDFPOI, so the arrays hold
+//    inputs or outputs according to WHICH, as for CDFPOI.  With WHICH = 3,
+//    each element is one inverse incomplete gamma ratio, which is the
+//    fast way to compute many confidence limits at once.
+//
+//  Parameters:
+//
+//    Input, int *WHICH, indicates which argument is to be calculated
+//    from the others, as for CDFPOI.
+//
+//    Input/output, double *P, *Q, the lower and upper tail probabilities.
+//
+//    Input/output, double *S, the numbers of events.
+//
+//    Input/output, double *XLAM, the means.
+//
+//    Input, size_t N, the number of elements in each array.
+//
+//    Output, int *STATUS, the status of each element, as for CDFPOI.
+//
+//    Output, double *BOUND, the bound for each element whose STATUS
+//    is nonzero, as for CDFPOI.
+//
+{
+  size_t i;
+
+  for ( i = 0; i < n; i++ )
+  {
+    cdfpoi ( which, p+i, q+i, s+i, xlam+i, status+i, bound+i );
+  }
+  return;
+}
@@ -80,12 +80,14 @@ void cdft ( int *which, double *p, double *q, double *t, double *df,
 # define inf 1.0e30
 # define maxdf 1.0e10
 
-  static int K1 = 1;
-  static double K4 = 0.5e0;
-  static double K5 = 5.0e0;
-  static double fx,cum,ccum,pq;
-  static unsigned long qhi,qleft,qporq;
-  static double T2,T3,T6,T7,T8,T9,T10,T11;
+  double K4 = 0.5e0;
+  double K5 = 5.0e0;
+  double K12 = 0.5e0;
+  double fx,dfx,d2fx,cum,ccum,hdf,lnc,pq;
+  unsigned long qhi,qleft,qporq;
+  dinvr_state istate;
+  dinvh_state hstate;
+  double T2,T3,T6,T7,T8,T9,T10,T11;
 
   *status = 0;
   *bound = 0.0;
@@ -147,7 +149,7 @@ S120:
 //     P + Q
 //
     pq = *p+*q;
-    if(!(fabs(pq-0.5e0-0.5e0) > 3.0e0*dpmpar(&K1))) goto S160;
+    if(!(fabs(pq-0.5e0-0.5e0) > 3.0e0*dpmpar_eps)) goto S160;
     if(!(pq < 0.0e0)) goto S140;
     *bound = 0.0e0;
     goto S150;
@@ -173,26 +175,32 @@ S160:
     else if(2 == *which) {
 //
 //     Computing T
-//     .. Get initial approximation for T
+//     .. Get initial approximation for T, and the log of the
+//        normalization of the density
 //
         *t = dt1(p,q,df);
+        hdf = 0.5e0**df;
+        lnc = -(beta_log(&hdf,&K12)+0.5e0*log(*df));
         T2 = -inf;
         T3 = inf;
         T6 = atol;
         T7 = tol;
-        dstinv(&T2,&T3,&K4,&K4,&K5,&T6,&T7);
+        dstinh(&hstate,&T2,&T3,&T6,&T7);
         *status = 0;
-        dinvr(status,t,&fx,&qleft,&qhi);
+        dinvh(&hstate,status,t,&fx,&dfx,&d2fx,&qleft,&qhi);
 S180:
         if(!(*status == 1)) goto S210;
         cumt(t,df,&cum,&ccum);
+        T8 = *t**t/ *df;
+        dfx = exp(lnc-(hdf+0.5e0)*alnrel(&T8));
+        d2fx = -(dfx*(*df+1.0e0)**t/(*df+*t**t));
         if(!qporq) goto S190;
-        fx = cum-*p;
+        dlnres(&cum,p,1,&fx,&dfx,&d2fx);
         goto S200;
 S190:
-        fx = ccum-*q;
+        dlnres(&ccum,q,0,&fx,&dfx,&d2fx);
 S200:
-        dinvr(status,t,&fx,&qleft,&qhi);
+        dinvh(&hstate,status,t,&fx,&dfx,&d2fx,&qleft,&qhi);
         goto S180;
 S210:
         if(!(*status == -1)) goto S240;
@@ -216,9 +224,9 @@ S230:
         T9 = maxdf;
         T10 = atol;
         T11 = tol;
-        dstinv(&T8,&T9,&K4,&K4,&K5,&T10,&T11);
+        dstinv(&istate,&T8,&T9,&K4,&K4,&K5,&T10,&T11);
         *status = 0;
-        dinvr(status,df,&fx,&qleft,&qhi);
+        dinvr(&istate,status,df,&fx,&qleft,&qhi);
 S250:
         if(!(*status == 1)) goto S280;
         cumt(t,df,&cum,&ccum);
@@ -228,7 +236,7 @@ S250:
 S260:
         fx = ccum-*q;
 S270:
-        dinvr(status,df,&fx,&qleft,&qhi);
+        dinvr(&istate,status,df,&fx,&qleft,&qhi);
         goto S250;
 S280:
         if(!(*status == -1)) goto S310;
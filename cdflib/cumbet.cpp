@@ -44,7 +44,7 @@ void cumbet ( double *x, double *y, double *a, double *b, double *cum,
 //    density function and complementary cumulative density function.
 //
 {
-  static int ierr;
+  int ierr;
 
   if ( *x <= 0.0 )
   {
@@ -45,7 +45,7 @@ void cumbin ( double *s, double *xn, double *pr, double *ompr,
 //    binomial distribution.
 //
 {
-  static double T1,T2;
+  double T1,T2;
 
   if ( *s < *xn )
   {
@@ -5,7 +5,8 @@ using namespace std;
 
 //****************************************************************************80
 
-void cumchi ( double *x, double *df, double *cum, double *ccum )
+void cumchi ( double *x, double *df, double *cum, double *ccum,
+  const int *ind )
 
 //****************************************************************************80
 //
@@ -25,12 +26,15 @@ void cumchi ( double *x, double *df, double *cum, double *ccum )
 //    Output, double *CCUM, the complement of the cumulative
 //    chi-square distribution.
 //
+//    Input, const int *IND, the accuracy request passed to GAMMA_INC,
+//    or NULL for that of this thread.
+//
 {
-  static double a;
-  static double xx;
+  double a;
+  double xx;
 
   a = *df * 0.5;
   xx = *x * 0.5;
-  cumgam ( &xx, &a, cum, ccum );
+  cumgam ( &xx, &a, cum, ccum, ind );
   return;
 }
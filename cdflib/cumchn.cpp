@@ -56,12 +56,12 @@ void cumchn ( double *x, double *df, double *pnonc, double *cum,
 # define qsmall(xx) (int)(sum < 1.0e-20 || (xx) < eps*sum)
 # define qtired(i) (int)((i) > ntired)
 
-  static double eps = 1.0e-5;
-  static int ntired = 1000;
-  static double adj,centaj,centwt,chid2,dfd2,lcntaj,lcntwt,lfact,pcent,pterm,sum,
+  double eps = 1.0e-5;
+  int ntired = 1000;
+  double adj,centaj,centwt,chid2,dfd2,lcntaj,lcntwt,lfact,pcent,pterm,sum,
     sumadj,term,wt,xnonc;
-  static int i,icent,iterb,iterf;
-  static double T1,T2,T3;
+  int i,icent,iterb,iterf;
+  double T1,T2,T3;
 
     if(!(*x <= 0.0e0)) goto S10;
     *cum = 0.0e0;
@@ -38,9 +38,9 @@ void cumf ( double *f, double *dfn, double *dfd, double *cum, double *ccum )
 # define half 0.5e0
 # define done 1.0e0
 
-  static double dsum,prod,xx,yy;
-  static int ierr;
-  static double T1,T2;
+  double dsum,prod,xx,yy;
+  int ierr;
+  double T1,T2;
 
   if(!(*f <= 0.0e0)) goto S10;
   *cum = 0.0e0;
@@ -62,11 +62,11 @@ void cumfnc ( double *f, double *dfn, double *dfd, double *pnonc,
 # define half 0.5e0
 # define done 1.0e0
 
-  static double eps = 1.0e-4;
-  static double dsum,dummy,prod,xx,yy,adn,aup,b,betdn,betup,centwt,dnterm,sum,
+  double eps = 1.0e-4;
+  double dsum,dummy,prod,xx,yy,adn,aup,b,betdn,betup,centwt,dnterm,sum,
     upterm,xmult,xnonc;
-  static int i,icent,ierr;
-  static double T1,T2,T3,T4,T5,T6;
+  int i,icent,ierr;
+  double T1,T2,T3,T4,T5,T6;
 
     if(!(*f <= 0.0e0)) goto S10;
     *cum = 0.0e0;
@@ -5,7 +5,8 @@ using namespace std;
 
 //****************************************************************************80
 
-void cumgam ( double *x, double *a, double *cum, double *ccum )
+void cumgam ( double *x, double *a, double *cum, double *ccum,
+  const int *ind )
 
 //****************************************************************************80
 //
@@ -34,8 +35,11 @@ void cumgam ( double *x, double *a, double *cum, double *ccum )
 //    Output, double *CUM, *CCUM, the incomplete Gamma CDF and
 //    complementary CDF.
 //
+//    Input, const int *IND, the accuracy request passed to GAMMA_INC,
+//    or NULL for that of this thread, set by GAMMA_INC_SET_ACCURACY.
+//
 {
-  static int K1 = 0;
+  int K1 = ( ind != NULL ) ? *ind : gamma_inc_thread_ind;
 
   if(!(*x <= 0.0e0)) goto S10;
   *cum = 0.0e0;
@@ -44,7 +44,7 @@ void cumnbn ( double *s, double *xn, double *pr, double *ompr,
 //    and the complementary CDF.
 //
 {
-  static double T1;
+  double T1;
 
   T1 = *s+1.e0;
   cumbet(pr,ompr,xn,&T1,cum,ccum);
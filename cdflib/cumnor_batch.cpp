@@ -0,0 +1,50 @@
+# include <iomanip>
+# include <cmath>
+using namespace std;
+# include "cdflib.hpp"
+# include "cumnor_simd.hpp"
+
+//****************************************************************************80
+
+void cumnor_batch ( const double *x, size_t n, double *p, double *q )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    CUMNOR_BATCH computes the cumulative normal distribution for an array.
+//
+//  Discussion:
+//
+//    This evaluates the same rational approximations as CUMNOR, lane by
+//    lane in vector registers, using AVX-512 or AVX2 when the processor
+//    has them and the baseline instruction set otherwise.  Results agree
+//    with CUMNOR to a few units in the last place.
+//
+//  Parameters:
+//
+//    Input, const double *X, the upper limits of integration.
+//
+//    Input, size_t N, the number of values.
+//
+//    Output, double *P, *Q, the Normal CDF and complementary CDF at each
+//    X.  They may not overlap X.
+//
+{
+  int level = simd_level ( );
+
+# if defined ( CDFLIB_HAVE_SIMD )
+  if ( level == 2 )
+  {
+    cumnor_batch_avx512 ( x, n, p, q );
+    return;
+  }
+  if ( level == 1 )
+  {
+    cumnor_batch_avx2 ( x, n, p, q );
+    return;
+  }
+# endif
+  (void) level;
+  cumnor_batch_kernel ( x, n, p, q );
+}
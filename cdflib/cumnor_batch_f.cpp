@@ -0,0 +1,52 @@
+# include <iomanip>
+# include <cmath>
+using namespace std;
+# include "cdflib.hpp"
+# include "cumnor_simd.hpp"
+
+//****************************************************************************80
+
+void cumnor_batch_f ( const float *x, size_t n, float *p, float *q )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    CUMNOR_BATCH_F computes the cumulative normal distribution for an
+//    array of floats.
+//
+//  Discussion:
+//
+//    This is the single precision counterpart of CUMNOR_BATCH, for
+//    screening runs that need many normal probabilities and only a few
+//    digits of each.  The smaller of P and Q has a relative error below
+//    5.0E-07, and twice as many lanes fit in a vector register as for
+//    doubles.
+//
+//  Parameters:
+//
+//    Input, const float *X, the upper limits of integration.
+//
+//    Input, size_t N, the number of values.
+//
+//    Output, float *P, *Q, the Normal CDF and complementary CDF at each
+//    X.  They may not overlap X.
+//
+{
+  int level = simd_level ( );
+
+# if defined ( CDFLIB_HAVE_SIMD )
+  if ( level == 2 )
+  {
+    cumnor_batch_f_avx512 ( x, n, p, q );
+    return;
+  }
+  if ( level == 1 )
+  {
+    cumnor_batch_f_avx2 ( x, n, p, q );
+    return;
+  }
+# endif
+  (void) level;
+  cumnor_batch_f_kernel ( x, n, p, q );
+}
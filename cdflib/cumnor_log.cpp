@@ -0,0 +1,39 @@
+# include <iomanip>
+# include <cmath>
+using namespace std;
+# include "cdf.hpp"
+
+//****************************************************************************80
+
+void cumnor_log ( double *arg, double *lcum, double *lccum )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    CUMNOR_LOG evaluates the logs of the normal CDF and its complement.
+//
+//  Discussion:
+//
+//    CUMNOR sets a tail probability below the smallest positive number to
+//    0, which happens beyond about 37.5 standard deviations.  Up to 35
+//    standard deviations, where both tails are still far above that
+//    limit, the log of the smaller CUMNOR value is returned, and the log
+//    of the other is computed from it with LOG1P.  Beyond, the log
+//    of the small tail comes from the asymptotic series of DLANOR, which
+//    is accurate to full precision there, and the log of the other tail
+//    is minus the small tail.
+//
+//    The computation is the inline CDF::DETAIL::CUMNOR_LOG of cdf.hpp.
+//
+//  Parameters:
+//
+//    Input, double *ARG, the upper limit of integration.
+//
+//    Output, double *LCUM, *LCCUM, the logs of the normal CDF and of
+//    its complement.
+//
+{
+  cdf::detail::cumnor_log ( *arg, *lcum, *lccum );
+  return;
+}
@@ -0,0 +1,56 @@
+# include <iomanip>
+# include <cmath>
+using namespace std;
+# include "cdflib.hpp"
+# include "cumnor_simd.hpp"
+
+//****************************************************************************80
+
+void cumnor_log_batch ( const double *x, size_t n, double *lp, double *lq )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    CUMNOR_LOG_BATCH computes the logs of the normal CDF and its
+//    complement for an array.
+//
+//  Discussion:
+//
+//    This is the batch form of CUMNOR_LOG, for integrands and likelihoods
+//    that need the log of a normal tail at many points.  The smaller tail
+//    is evaluated directly as a log from the rational approximations of
+//    CUMNOR, so it does not underflow however far out X is, and the
+//    larger one with LOG1P.  The vector lanes use AVX-512 or AVX2 when
+//    the processor has them.  The results agree with CUMNOR_LOG to a few
+//    units in the last place of the smaller tail; beyond 35 standard
+//    deviations, where CUMNOR_LOG switches to the asymptotic series of
+//    DLANOR, to a relative error of about 1.0E-15.
+//
+//  Parameters:
+//
+//    Input, const double *X, the upper limits of integration.
+//
+//    Input, size_t N, the number of values.
+//
+//    Output, double *LP, *LQ, the logs of the normal CDF and of its
+//    complement at each X.  They may not overlap X.
+//
+{
+  int level = simd_level ( );
+
+# if defined ( CDFLIB_HAVE_SIMD )
+  if ( level == 2 )
+  {
+    cumnor_log_batch_avx512 ( x, n, lp, lq );
+    return;
+  }
+  if ( level == 1 )
+  {
+    cumnor_log_batch_avx2 ( x, n, lp, lq );
+    return;
+  }
+# endif
+  (void) level;
+  cumnor_log_batch_kernel ( x, n, lp, lq );
+}
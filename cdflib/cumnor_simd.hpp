@@ -0,0 +1,573 @@
+# ifndef CUMNOR_SIMD_HPP
+# define CUMNOR_SIMD_HPP
+//
+//  Branch-free lane kernels for the batch normal routines.
+//
+//  Every routine below is written as straight-line code on one double,
+//  with the branches of the scalar routines replaced by selects, so that
+//  a loop over an array marked "omp simd" is vectorized by the compiler.
+//  This header is compiled once per instruction set (simd_avx2.cpp,
+//  simd_avx512.cpp, and the baseline build in each batch routine), and
+//  the batch routines pick the widest version the processor supports at
+//  run time.
+//
+# include <cstddef>
+# include <cstdint>
+# include <cstring>
+# include <limits>
+# include "cdf.hpp"
+
+//
+//  Instruction-set specific versions, defined in simd_avx2.cpp and
+//  simd_avx512.cpp.
+//
+void cumnor_batch_avx2 ( const double *x, size_t n, double *p, double *q );
+void cumnor_batch_avx512 ( const double *x, size_t n, double *p, double *q );
+void cumnor_batch_f_avx2 ( const float *x, size_t n, float *p, float *q );
+void cumnor_log_batch_avx2 ( const double *x, size_t n, double *lp,
+  double *lq );
+void cumnor_batch_f_avx512 ( const float *x, size_t n, float *p, float *q );
+void cumnor_log_batch_avx512 ( const double *x, size_t n, double *lp,
+  double *lq );
+void dinvnr_batch_avx2 ( const double *p, const double *q, size_t n,
+  double *x );
+void dinvnr_batch_avx512 ( const double *p, const double *q, size_t n,
+  double *x );
+
+//****************************************************************************80
+
+static inline double simd_pow2i ( double k )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    SIMD_POW2I returns 2**K for an integral K in [-1022,1023].
+//
+{
+  const double shift = 6755399441055744.0;
+  double t = k + shift;
+  uint64_t bits;
+  memcpy ( &bits, &t, sizeof ( bits ) );
+  bits = ( bits + 1023 ) << 52;
+  memcpy ( &t, &bits, sizeof ( t ) );
+  return t;
+}
+//****************************************************************************80
+
+static inline double simd_trunc ( double x )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    SIMD_TRUNC rounds X toward zero, for |X| < 2**51.
+//
+//  Discussion:
+//
+//    This replaces the conversion to int used by FIFDINT, which the
+//    compiler will not vectorize under a select.
+//
+{
+  const double shift = 6755399441055744.0;
+  double a,r;
+
+  a = x < 0.0 ? -x : x;
+  r = ( a + shift ) - shift;
+  r = r > a ? r - 1.0 : r;
+  return x < 0.0 ? -r : r;
+}
+//****************************************************************************80
+
+static inline double simd_exp_split ( double a, double b )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    SIMD_EXP_SPLIT evaluates EXP(A+B) without branches.
+//
+//  Discussion:
+//
+//    The argument is reduced to A + B = K*LN2 + R with |R| <= LN2/2, and
+//    EXP(R) is evaluated with the rational approximation of the FDLIBM
+//    exponential, which is accurate to within one unit in the last place.
+//    The scaling by 2**K is split in two so that subnormal results come
+//    out right.
+//
+//    A is reduced before B is added, so when A is a multiple of 2**(-20)
+//    of magnitude below 2**11, such as X*X/2 for X a multiple of 1/16, the
+//    large part of the argument loses nothing to rounding.  This gives the
+//    accuracy of EXP(A)*EXP(B) with a single exponential.
+//
+{
+  const double log2e = 1.44269504088896338700e+00;
+  const double ln2hi = 6.93147180369123816490e-01;
+  const double ln2lo = 1.90821492927058770002e-10;
+  const double shift = 6755399441055744.0;
+  const double P1 =  1.66666666666666019037e-01;
+  const double P2 = -2.77777777770155933842e-03;
+  const double P3 =  6.61375632143793436117e-05;
+  const double P4 = -1.65339022054652515390e-06;
+  const double P5 =  4.13813679705723846039e-08;
+  double c,hi,k,k1,lo,r,t,x,xc,y;
+
+  x = a + b;
+  xc = x < -746.0 ? -746.0 : x;
+  xc = xc > 709.78 ? 709.78 : xc;
+  k = ( xc * log2e + shift ) - shift;
+  hi = ( a - k * ln2hi ) + b;
+  lo = k * ln2lo;
+  r = hi - lo;
+  t = r * r;
+  c = r - t * ( P1 + t * ( P2 + t * ( P3 + t * ( P4 + t * P5 ) ) ) );
+  y = 1.0 - ( ( lo - ( r * c ) / ( 2.0 - c ) ) - hi );
+  k1 = ( k * 0.5 + shift ) - shift;
+  y = y * simd_pow2i ( k1 ) * simd_pow2i ( k - k1 );
+  y = x < -745.2 ? 0.0 : y;
+  y = x > 709.78 ? std::numeric_limits<double>::infinity ( ) : y;
+  return y;
+}
+//****************************************************************************80
+
+static inline double simd_exp ( double x )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    SIMD_EXP evaluates EXP(X) without branches.
+//
+{
+  return simd_exp_split ( x, 0.0 );
+}
+//****************************************************************************80
+
+static inline double simd_log ( double x )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    SIMD_LOG evaluates LOG(X) for positive finite X without branches.
+//
+//  Discussion:
+//
+//    X is split as 2**E * M with SQRT(2)/2 <= M < SQRT(2), and LOG(M) is
+//    evaluated with the polynomial of the FDLIBM logarithm.  X = 0 gives
+//    -infinity.
+//
+{
+  const double ln2hi = 6.93147180369123816490e-01;
+  const double ln2lo = 1.90821492927058770002e-10;
+  const double two52 = 4503599627370496.0;
+  const double Lg1 = 6.666666666666735130e-01;
+  const double Lg2 = 3.999999999940941908e-01;
+  const double Lg3 = 2.857142874366239149e-01;
+  const double Lg4 = 2.222219843214978396e-01;
+  const double Lg5 = 1.818357216161805012e-01;
+  const double Lg6 = 1.531383769920937332e-01;
+  const double Lg7 = 1.479819860511658591e-01;
+  double e,eoff,f,hfsq,m,R,s,t1,t2,w,xs,z;
+  uint64_t bits,ebits;
+
+  xs = x < 2.2250738585072014e-308 ? x * 18014398509481984.0 : x;
+  eoff = x < 2.2250738585072014e-308 ? 54.0 : 0.0;
+  memcpy ( &bits, &xs, sizeof ( bits ) );
+  ebits = ( bits >> 52 ) | 0x4330000000000000ULL;
+  memcpy ( &e, &ebits, sizeof ( e ) );
+  e = e - two52 - 1023.0 - eoff;
+  bits = ( bits & 0x000FFFFFFFFFFFFFULL ) | 0x3FF0000000000000ULL;
+  memcpy ( &m, &bits, sizeof ( m ) );
+  e = m > 1.4142135623730951 ? e + 1.0 : e;
+  m = m > 1.4142135623730951 ? m * 0.5 : m;
+
+  f = m - 1.0;
+  s = f / ( 2.0 + f );
+  z = s * s;
+  w = z * z;
+  t1 = w * ( Lg2 + w * ( Lg4 + w * Lg6 ) );
+  t2 = z * ( Lg1 + w * ( Lg3 + w * ( Lg5 + w * Lg7 ) ) );
+  R = t2 + t1;
+  hfsq = 0.5 * f * f;
+  z = e * ln2hi - ( ( hfsq - ( s * ( hfsq + R ) + e * ln2lo ) ) - f );
+  z = x == 0.0 ? -std::numeric_limits<double>::infinity ( ) : z;
+  return z;
+}
+//****************************************************************************80
+
+static inline double cumnor_simd_terms ( double x )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    CUMNOR_SIMD_TERMS evaluates the rational approximation of CUMNOR that
+//    applies to X.
+//
+//  Discussion:
+//
+//    For |X| <= 0.66291 the result is T, with the normal CDF 0.5 + T.
+//    Beyond, it is R, with the smaller tail EXP(-X*X/2) * R, where R is the
+//    approximation for 0.66291 < |X| <= sqrt(32) or for |X| > sqrt(32), as
+//    applies.  The numerators and denominators of all three are evaluated,
+//    and the ones that apply are selected before the only division, which
+//    is the slowest operation in vector lanes.  The approximation for
+//    |X| > sqrt(32), a rational function of 1/(X*X) in CUMNOR, is turned
+//    into one of X*X by multiplying through with (X*X)**5; |X| is clamped
+//    at 1.0E+14 there so that the powers do not overflow.
+//
+{
+  const double a[5] = {
+    2.2352520354606839287e00,1.6102823106855587881e02,1.0676894854603709582e03,
+    1.8154981253343561249e04,6.5682337918207449113e-2
+  };
+  const double b[4] = {
+    4.7202581904688241870e01,9.7609855173777669322e02,1.0260932208618978205e04,
+    4.5507789335026729956e04
+  };
+  const double c[9] = {
+    3.9894151208813466764e-1,8.8831497943883759412e00,9.3506656132177855979e01,
+    5.9727027639480026226e02,2.4945375852903726711e03,6.8481904505362823326e03,
+    1.1602651437647350124e04,9.8427148383839780218e03,1.0765576773720192317e-8
+  };
+  const double d[8] = {
+    2.2266688044328115691e01,2.3538790178262499861e02,1.5193775994075548050e03,
+    6.4855582982667607550e03,1.8615571640885098091e04,3.4900952721145977266e04,
+    3.8912003286093271411e04,1.9685429676859990727e04
+  };
+  const double p[6] = {
+    2.1589853405795699e-1,1.274011611602473639e-1,2.2235277870649807e-2,
+    1.421619193227893466e-3,2.9112874951168792e-5,2.307344176494017303e-2
+  };
+  const double q[5] = {
+    1.28426009614491121e00,4.68238212480865118e-1,6.59881378689285515e-2,
+    3.78239633202758244e-3,7.29751555083966205e-5
+  };
+  const double sqrpi = 3.9894228040143267794e-1;
+  const double root32 = 5.656854248e0;
+  const double thrsh = 0.66291e0;
+  const double eps = std::numeric_limits<double>::epsilon ( ) * 0.5;
+  double d1,d2,d3,n1,n2,n3,xden,xnum,xsq,y,z;
+//
+//  |X| <= 0.66291
+//
+  y = x < 0.0 ? -x : x;
+  xsq = y > eps ? x * x : 0.0;
+  xnum = a[4] * xsq;
+  xden = xsq;
+  xnum = ( xnum + a[0] ) * xsq;
+  xden = ( xden + b[0] ) * xsq;
+  xnum = ( xnum + a[1] ) * xsq;
+  xden = ( xden + b[1] ) * xsq;
+  xnum = ( xnum + a[2] ) * xsq;
+  xden = ( xden + b[2] ) * xsq;
+  n1 = x * ( xnum + a[3] );
+  d1 = xden + b[3];
+//
+//  0.66291 < |X| <= sqrt(32)
+//
+  xnum = c[8] * y;
+  xden = y;
+  xnum = ( xnum + c[0] ) * y;
+  xden = ( xden + d[0] ) * y;
+  xnum = ( xnum + c[1] ) * y;
+  xden = ( xden + d[1] ) * y;
+  xnum = ( xnum + c[2] ) * y;
+  xden = ( xden + d[2] ) * y;
+  xnum = ( xnum + c[3] ) * y;
+  xden = ( xden + d[3] ) * y;
+  xnum = ( xnum + c[4] ) * y;
+  xden = ( xden + d[4] ) * y;
+  xnum = ( xnum + c[5] ) * y;
+  xden = ( xden + d[5] ) * y;
+  xnum = ( xnum + c[6] ) * y;
+  xden = ( xden + d[6] ) * y;
+  n2 = xnum + c[7];
+  d2 = xden + d[7];
+//
+//  |X| > sqrt(32)
+//
+  y = y > 1.0e14 ? 1.0e14 : y;
+  z = y * y;
+  xnum = p[4] * z;
+  xden = q[4] * z;
+  xnum = ( xnum + p[3] ) * z;
+  xden = ( xden + q[3] ) * z;
+  xnum = ( xnum + p[2] ) * z;
+  xden = ( xden + q[2] ) * z;
+  xnum = ( xnum + p[1] ) * z;
+  xden = ( xden + q[1] ) * z;
+  xnum = ( xnum + p[0] ) * z;
+  xden = ( xden + q[0] ) * z;
+  xnum = xnum + p[5];
+  xden = ( xden + 1.0 ) * z;
+  n3 = sqrpi * xden - xnum;
+  d3 = xden * y;
+
+  n2 = y > root32 ? n3 : n2;
+  d2 = y > root32 ? d3 : d2;
+  n1 = y <= thrsh ? n1 : n2;
+  d1 = y <= thrsh ? d1 : d2;
+  return n1 / d1;
+}
+//****************************************************************************80
+
+static inline void cumnor_simd ( double x, double *result, double *ccum )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    CUMNOR_SIMD is the branch-free form of CUMNOR.
+//
+//  Discussion:
+//
+//    The results agree with CUMNOR to a few units in the last place; the
+//    exponential is SIMD_EXP_SPLIT rather than the library one.
+//
+{
+  const double thrsh = 0.66291e0;
+  const double min = std::numeric_limits<double>::min ( );
+  double ccum1,ccum23,del,r,res1,res23,t,xc,xsq,y;
+
+  r = cumnor_simd_terms ( x );
+  res1 = 0.5 + r;
+  ccum1 = 0.5 - r;
+  y = x < 0.0 ? -x : x;
+//
+//  Common exponential factor of the two tail branches.  Beyond |X| = 40
+//  the factor underflows, so X is clamped there.
+//
+  xc = y > 40.0 ? 40.0 : y;
+  xsq = simd_trunc ( xc * 16.0 ) / 16.0;
+  del = ( xc - xsq ) * ( xc + xsq );
+  res23 = simd_exp_split ( -( xsq * xsq * 0.5 ), -( del * 0.5 ) ) * r;
+  ccum23 = 1.0 - res23;
+  t = res23;
+  res23 = x > 0.0 ? ccum23 : res23;
+  ccum23 = x > 0.0 ? t : ccum23;
+
+  res1 = y <= thrsh ? res1 : res23;
+  ccum1 = y <= thrsh ? ccum1 : ccum23;
+  res1 = res1 < min ? 0.0 : res1;
+  ccum1 = ccum1 < min ? 0.0 : ccum1;
+  *result = x != x ? x : res1;
+  *ccum = x != x ? x : ccum1;
+}
+//****************************************************************************80
+
+static inline void cumnor_log_simd ( double x, double *lcum, double *lccum )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    CUMNOR_LOG_SIMD is the branch-free form of CUMNOR_LOG in cdf.hpp.
+//
+//  Discussion:
+//
+//    Beyond |X| = 0.66291 the smaller tail is formed as a log,
+//    -X*X/2 + LOG(R), from the same rational approximations as
+//    CUMNOR_SIMD, so it does not underflow, and the larger one as
+//    LOG(1-S) with S the smaller tail, with the rounding of 1-S put back
+//    to first order as in LOG1P.  X*X/2 is split as in CUMNOR so that its
+//    rounding error is not magnified; beyond |X| = 1.0E+14 the split is
+//    not needed, and -X*X/2 is used as it is, so that the log of the tail
+//    overflows to -infinity where that of CUMNOR_LOG does.  The central
+//    and tail arguments are selected before the logs are taken, so that
+//    each lane needs two logs and one exponential.
+//
+{
+  const double thrsh = 0.66291e0;
+  bool central;
+  double del,l1,l2,r,sm,u,xc,xsq,y;
+
+  r = cumnor_simd_terms ( x );
+  y = x < 0.0 ? -x : x;
+  central = y <= thrsh;
+  xc = y > 1.0e14 ? 1.0e14 : y;
+  xsq = simd_trunc ( xc * 16.0 ) / 16.0;
+  del = ( xc - xsq ) * ( xc + xsq );
+  xsq = - ( xsq * xsq * 0.5 ) - del * 0.5;
+  xsq = y > 1.0e14 ? - ( y * y * 0.5 ) : xsq;
+//
+//  L1 is the log of the central CDF or of the smaller tail, L2 that of
+//  the central complement or of the larger tail.
+//
+  l1 = simd_log ( central ? 0.5 + r : r );
+  l1 = central ? l1 : l1 + xsq;
+  sm = simd_exp ( l1 );
+  u = 1.0 - sm;
+  l2 = simd_log ( central ? 0.5 - r : u );
+  l2 = central ? l2 : ( u == 1.0 ? - sm : l2 + ( ( 1.0 - u ) - sm ) / u );
+
+  *lcum = x != x ? x : ( central || x < 0.0 ? l1 : l2 );
+  *lccum = x != x ? x : ( central || x < 0.0 ? l2 : l1 );
+}
+//****************************************************************************80
+
+static inline double stvaln_simd ( double p )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    STVALN_SIMD is the branch-free form of STVALN.
+//
+{
+  const double xden[5] = {
+    0.993484626060e-1,0.588581570495e0,0.531103462366e0,0.103537752850e0,
+    0.38560700634e-2
+  };
+  const double xnum[5] = {
+    -0.322232431088e0,-1.000000000000e0,-0.342242088547e0,-0.204231210245e-1,
+    -0.453642210148e-4
+  };
+  double den,num,y,z;
+
+  z = p <= 0.5 ? p : 1.0 - p;
+  y = __builtin_sqrt ( -( 2.0 * simd_log ( z ) ) );
+  num = (((xnum[4]*y+xnum[3])*y+xnum[2])*y+xnum[1])*y+xnum[0];
+  den = (((xden[4]*y+xden[3])*y+xden[2])*y+xden[1])*y+xden[0];
+  y = y + num / den;
+  return p <= 0.5 ? -y : y;
+}
+//****************************************************************************80
+
+static inline void cumnor_batch_kernel ( const double *x, size_t n, double *p,
+  double *q )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    CUMNOR_BATCH_KERNEL applies CUMNOR_SIMD to an array.
+//
+{
+# pragma omp simd
+  for ( size_t i = 0; i < n; i++ )
+  {
+    double cum,ccum;
+    cumnor_simd ( x[i], &cum, &ccum );
+    p[i] = cum;
+    q[i] = ccum;
+  }
+}
+//****************************************************************************80
+
+static inline void cumnor_log_batch_kernel ( const double *x, size_t n,
+  double *lp, double *lq )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    CUMNOR_LOG_BATCH_KERNEL applies CUMNOR_LOG_SIMD to an array.
+//
+{
+# pragma omp simd
+  for ( size_t i = 0; i < n; i++ )
+  {
+    double lcum,lccum;
+    cumnor_log_simd ( x[i], &lcum, &lccum );
+    lp[i] = lcum;
+    lq[i] = lccum;
+  }
+}
+//****************************************************************************80
+
+static inline void cumnor_batch_f_kernel ( const float *x, size_t n, float *p,
+  float *q )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    CUMNOR_BATCH_F_KERNEL applies the single precision CUMNOR of cdf.hpp
+//    to an array.
+//
+{
+# pragma omp simd
+  for ( size_t i = 0; i < n; i++ )
+  {
+    float cum,ccum;
+    cdf::detail::cumnor ( x[i], cum, ccum );
+    p[i] = cum;
+    q[i] = ccum;
+  }
+}
+//****************************************************************************80
+
+static inline void dinvnr_batch_kernel ( const double *p, const double *q,
+  size_t n, double *x )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    DINVNR_BATCH_KERNEL applies the Newton iteration of DINVNR to an array.
+//
+//  Discussion:
+//
+//    The array is processed in blocks.  Every lane of a block takes the
+//    same Newton steps as DINVNR; a lane that has converged keeps its
+//    value, and the block is finished when all of its lanes have
+//    converged or the iteration limit is reached.  A lane that fails to
+//    converge returns its starting value, as DINVNR does.
+//
+{
+  const int block = 64;
+  const int maxit = 100;
+  const double eps = 1.0e-13;
+  const double r2pi = 0.3989422804014326e0;
+  double done[block],pp[block],sgn[block],strtx[block],xcur[block];
+
+  for ( size_t i0 = 0; i0 < n; i0 += block )
+  {
+    int m = ( n - i0 < ( size_t ) block ) ? ( int ) ( n - i0 ) : block;
+    const double *pb = p + i0;
+    const double *qb = q + i0;
+
+# pragma omp simd
+    for ( int i = 0; i < m; i++ )
+    {
+      pp[i] = pb[i] <= qb[i] ? pb[i] : qb[i];
+      sgn[i] = pb[i] <= qb[i] ? 1.0 : -1.0;
+      strtx[i] = stvaln_simd ( pp[i] );
+      xcur[i] = strtx[i];
+      done[i] = 0.0;
+    }
+
+    for ( int it = 1; it <= maxit; it++ )
+    {
+      int active = 0;
+# pragma omp simd reduction(+:active)
+      for ( int i = 0; i < m; i++ )
+      {
+        double cum,ccum,dx,xn;
+        cumnor_simd ( xcur[i], &cum, &ccum );
+        dx = ( cum - pp[i] ) / ( r2pi * simd_exp ( -0.5 * xcur[i] * xcur[i] ) );
+        xn = xcur[i] - dx;
+        xcur[i] = done[i] != 0.0 ? xcur[i] : xn;
+        done[i] = ( done[i] != 0.0 || __builtin_fabs ( dx / xn ) < eps )
+          ? 1.0 : 0.0;
+        active += done[i] != 0.0 ? 0 : 1;
+      }
+      if ( active == 0 )
+      {
+        break;
+      }
+    }
+
+# pragma omp simd
+    for ( int i = 0; i < m; i++ )
+    {
+      double xi = done[i] != 0.0 ? xcur[i] : strtx[i];
+      xi = pp[i] == 0.0 ? -std::numeric_limits<double>::infinity ( ) : xi;
+      x[i0+i] = sgn[i] * xi;
+    }
+  }
+}
+
+# endif
@@ -5,7 +5,8 @@ using namespace std;
 
 //****************************************************************************80
 
-void cumpoi ( double *s, double *xlam, double *cum, double *ccum )
+void cumpoi ( double *s, double *xlam, double *cum, double *ccum,
+  const int *ind )
 
 //****************************************************************************80
 //
@@ -34,11 +35,14 @@ void cumpoi ( double *s, double *xlam, double *cum, double *ccum )
 //    Output, double *CUM, *CCUM, the Poisson density CDF and
 //    complementary CDF.
 //
+//    Input, const int *IND, the accuracy request passed to GAMMA_INC,
+//    or NULL for that of this thread.
+//
 {
-  static double chi,df;
+  double chi,df;
 
   df = 2.0e0*(*s+1.0e0);
   chi = 2.0e0**xlam;
-  cumchi(&chi,&df,ccum,cum);
+  cumchi(&chi,&df,ccum,cum,ind);
   return;
 }
@@ -30,14 +30,14 @@ void cumt ( double *t, double *df, double *cum, double *ccum )
 //    complementary CDF.
 //
 {
-  static double a;
-  static double dfptt;
-  static double K2 = 0.5e0;
-  static double oma;
-  static double T1;
-  static double tt;
-  static double xx;
-  static double yy;
+  double a;
+  double dfptt;
+  double K2 = 0.5e0;
+  double oma;
+  double T1;
+  double tt;
+  double xx;
+  double yy;
 
   tt = (*t) * (*t);
   dfptt = ( *df ) + tt;
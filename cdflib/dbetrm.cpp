@@ -31,7 +31,7 @@ double dbetrm ( double *a, double *b )
 //    Output, double DBETRM, the Sterling remainder.
 //
 {
-  static double dbetrm,T1,T2,T3;
+  double dbetrm,T1,T2,T3;
 //
 //     Try to sum from smallest to largest
 //
@@ -25,13 +25,13 @@ double dexpm1 ( double *x )
 //    Output, double DEXPM1, the value of exp(X)-1.
 //
 {
-  static double p1 = .914041914819518e-09;
-  static double p2 = .238082361044469e-01;
-  static double q1 = -.499999999085958e+00;
-  static double q2 = .107141568980644e+00;
-  static double q3 = -.119041179760821e-01;
-  static double q4 = .595130811860248e-03;
-  static double dexpm1;
+  double p1 = .914041914819518e-09;
+  double p2 = .238082361044469e-01;
+  double q1 = -.499999999085958e+00;
+  double q2 = .107141568980644e+00;
+  double q3 = -.119041179760821e-01;
+  double q4 = .595130811860248e-03;
+  double dexpm1;
   double w;
 
   if ( fabs(*x) <= 0.15e0 )
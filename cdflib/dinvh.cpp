@@ -0,0 +1,215 @@
+# include <iomanip>
+# include <cmath>
+using namespace std;
+# include "cdflib.hpp"
+
+//****************************************************************************80
+
+void dinvh ( dinvh_state *state, int *status, double *x, double *fx,
+  double *dfx, double *d2fx, unsigned long *qleft, unsigned long *qhi )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    DINVH finds the zero of an increasing function from its derivatives.
+//
+//  Discussion:
+//
+//    This is a safeguarded Halley iteration for inverting a cumulative
+//    distribution whose density is known.  The values of F seen so far
+//    bracket the zero.  A Halley (or, if D2FX is 0, Newton) step is taken
+//    when it stays inside the bracket and at least halves the previous
+//    step once the zero is bracketed; otherwise the bracket is bisected,
+//    geometrically if it spans more than a factor of 4.  Until both sides
+//    are known, the search steps away from the start by doubling.  When
+//    SMALL is not negative, a step that would cross 0 is taken in LOG(X)
+//    instead.
+//
+//    From a good starting value, with F on the log scale (see DLNRES),
+//    the iteration typically needs 2 to 4 evaluations of F, where DINVR
+//    needs 15 to 30.
+//
+//  Parameters:
+//
+//    Input/output, dinvh_state *STATE, the search state, set up by DSTINH.
+//
+//    Input/output, int *STATUS.  Set STATUS to 0 and X to a starting
+//    value to begin.  While DINVH returns STATUS = 1, evaluate F at X
+//    and call again.  STATUS = 0 on return means that X is the zero.
+//    STATUS = -1 means that there is no zero between SMALL and BIG.
+//
+//    Input/output, double *X, the point at which F is to be evaluated.
+//
+//    Input, double *FX, *DFX, *D2FX, F(X) and its first and second
+//    derivatives.  F must be increasing, so DFX should be positive;
+//    a value of DFX that is not, or is not finite, makes DINVH bisect.
+//
+//    Output, unsigned long *QLEFT, *QHI, are only defined if STATUS is -1.
+//    QLEFT is true if the search ended at SMALL and false if it ended at
+//    BIG.  QHI is true if 0 < F(X) there.
+//
+{
+  double dx;
+  double h;
+  double hi;
+  double lo;
+  double tol;
+  double xnew;
+  int ok;
+
+  if ( *status == 0 )
+  {
+    *x = fifdmin1 ( fifdmax1 ( *x, state->small ), state->big );
+    cdf_eval_count = cdf_eval_count + 1;
+    *status = 1;
+    return;
+  }
+
+  if ( *fx == 0.0e0 )
+  {
+    *status = 0;
+    return;
+  }
+  if ( *fx < 0.0e0 )
+  {
+    state->xlo = *x;
+    state->qxlo = 1;
+  }
+  else
+  {
+    state->xhi = *x;
+    state->qxhi = 1;
+  }
+  lo = state->xlo;
+  hi = state->xhi;
+  tol = fifdmax1 ( state->abstol, state->reltol * fabs ( *x ) );
+//
+//  A bracket that excludes 0 is judged by the relative tolerance alone,
+//  so that zeros far below ABSTOL are still found to full accuracy.
+//
+  if ( state->qxlo && state->qxhi && ( 0.0e0 < lo || hi < 0.0e0 ) )
+  {
+    tol = state->reltol * fifdmin1 ( fabs ( lo ), fabs ( hi ) );
+  }
+
+  if ( state->qxlo && state->qxhi && hi - lo <= tol )
+  {
+    *x = 0.5e0 * ( lo + hi );
+    *status = 0;
+    return;
+  }
+//
+//  Halley step, accepted if it is safe.
+//
+  ok = 0;
+  xnew = *x;
+  if ( 0.0e0 < *dfx && *dfx <= dpmpar_huge )
+  {
+    dx = - *fx / *dfx;
+    h = 1.0e0 + 0.5e0 * dx * *d2fx / *dfx;
+    if ( 0.5e0 < h && h < 2.0e0 )
+    {
+      dx = dx / h;
+    }
+    xnew = *x + dx;
+    if ( fabs ( dx ) <= state->reltol * fabs ( xnew ) && lo <= xnew && xnew <= hi )
+    {
+      *x = xnew;
+      *status = 0;
+      return;
+    }
+//
+//  For a positive X, a step through 0 is taken on the log scale of X
+//  instead, where a power-law tail near 0 is linear.
+//
+    if ( 0.0e0 <= state->small && 0.0e0 < *x && xnew <= 0.0e0 )
+    {
+      h = fifdmax1 ( - *fx / ( *x * *dfx ), -600.0e0 );
+      xnew = *x * exp ( h );
+      dx = xnew - *x;
+    }
+    ok = ( lo < xnew && xnew < hi );
+    if ( state->qxlo && state->qxhi && state->step < 2.0e0 * fabs ( dx ) )
+    {
+      ok = 0;
+    }
+//
+//  A step past a nonzero search bound goes to the bound, so that a zero
+//  outside the range is reported at once.
+//
+    if ( !state->qxhi && hi <= xnew && state->big != 0.0e0 &&
+      tol < state->big - *x )
+    {
+      xnew = state->big;
+      ok = 1;
+    }
+    if ( !state->qxlo && xnew <= lo && state->small != 0.0e0 &&
+      tol < *x - state->small )
+    {
+      xnew = state->small;
+      ok = 1;
+    }
+  }
+//
+//  Otherwise bisect, or step outwards.
+//
+  if ( !ok )
+  {
+    if ( state->qxlo && state->qxhi )
+    {
+      if ( 0.0e0 <= lo && 4.0e0 * lo < hi )
+      {
+        xnew = sqrt ( fifdmax1 ( lo, dpmpar_tiny ) ) * sqrt ( hi );
+      }
+      else
+      {
+        xnew = 0.5e0 * ( lo + hi );
+      }
+    }
+    else if ( *fx < 0.0e0 )
+    {
+      if ( state->big - *x <= tol )
+      {
+        *status = -1;
+        *qleft = 0;
+        *qhi = 0;
+        return;
+      }
+      dx = fifdmax1 ( fabs ( *x ), 1.0e0 );
+      if ( state->big - *x < 2.0e0 * dx )
+      {
+        xnew = *x + 0.5e0 * ( state->big - *x );
+      }
+      else
+      {
+        xnew = *x + dx;
+      }
+    }
+    else
+    {
+      if ( *x - state->small <= tol )
+      {
+        *status = -1;
+        *qleft = 1;
+        *qhi = 1;
+        return;
+      }
+      dx = fifdmax1 ( fabs ( *x ), 1.0e0 );
+      if ( *x - state->small < 2.0e0 * dx )
+      {
+        xnew = *x - 0.5e0 * ( *x - state->small );
+      }
+      else
+      {
+        xnew = *x - dx;
+      }
+    }
+  }
+
+  state->step = fabs ( xnew - *x );
+  *x = xnew;
+  cdf_eval_count = cdf_eval_count + 1;
+  *status = 1;
+  return;
+}
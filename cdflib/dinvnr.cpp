@@ -1,7 +1,7 @@
 # include <iomanip>
 # include <cmath>
 using namespace std;
-# include "cdflib.hpp"
+# include "cdf.hpp"
 
 //****************************************************************************80
 
@@ -21,6 +21,10 @@ double dinvnr ( double *p, double *q )
 //    The rational function on page 95 of Kennedy and Gentle is used as a start
 //    value for the Newton method of finding roots.
 //
+//    P = 0 gives -infinity and Q = 0 gives +infinity.
+//
+//    The computation is the inline CDF::DETAIL::DINVNR of cdf.hpp.
+//
 //  Reference:
 //
 //    Kennedy and Gentle,
@@ -37,57 +41,5 @@ double dinvnr ( double *p, double *q )
 //    Normal CDF has the value P.
 //
 {
-# define maxit 100
-# define eps (1.0e-13)
-# define r2pi 0.3989422804014326e0
-# define nhalf (-0.5e0)
-# define dennor(x) (r2pi*exp(nhalf*(x)*(x)))
-
-  static double dinvnr,strtx,xcur,cum,ccum,pp,dx;
-  static int i;
-  static unsigned long qporq;
-
-//
-//     FIND MINIMUM OF P AND Q
-//
-    qporq = *p <= *q;
-    if(!qporq) goto S10;
-    pp = *p;
-    goto S20;
-S10:
-    pp = *q;
-S20:
-//
-//     INITIALIZATION STEP
-//
-    strtx = stvaln(&pp);
-    xcur = strtx;
-//
-//     NEWTON INTERATIONS
-//
-    for ( i = 1; i <= maxit; i++ )
-    {
-        cumnor(&xcur,&cum,&ccum);
-        dx = (cum-pp)/dennor(xcur);
-        xcur -= dx;
-        if(fabs(dx/xcur) < eps) goto S40;
-    }
-    dinvnr = strtx;
-//
-//     IF WE GET HERE, NEWTON HAS FAILED
-//
-    if(!qporq) dinvnr = -dinvnr;
-    return dinvnr;
-S40:
-//
-//     IF WE GET HERE, NEWTON HAS SUCCEDED
-//
-    dinvnr = xcur;
-    if(!qporq) dinvnr = -dinvnr;
-    return dinvnr;
-# undef maxit
-# undef eps
-# undef r2pi
-# undef nhalf
-# undef dennor
+  return cdf::detail::dinvnr ( *p, *q );
 }
@@ -0,0 +1,52 @@
+# include <iomanip>
+# include <cmath>
+using namespace std;
+# include "cdflib.hpp"
+# include "cumnor_simd.hpp"
+
+//****************************************************************************80
+
+void dinvnr_batch ( const double *p, const double *q, size_t n, double *x )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    DINVNR_BATCH computes the inverse of the normal distribution for an
+//    array.
+//
+//  Discussion:
+//
+//    Each X is found as in DINVNR, by Newton's method from the starting
+//    value of STVALN, with the iterations for a block of values running
+//    side by side in vector registers.  AVX-512 or AVX2 is used when the
+//    processor has them.  P = 0 gives -infinity and Q = 0 gives +infinity.
+//
+//  Parameters:
+//
+//    Input, const double *P, *Q, the probabilities and complementary
+//    probabilities.
+//
+//    Input, size_t N, the number of values.
+//
+//    Output, double *X, the arguments for which the Normal CDF has the
+//    values P.  It may not overlap P or Q.
+//
+{
+  int level = simd_level ( );
+
+# if defined ( CDFLIB_HAVE_SIMD )
+  if ( level == 2 )
+  {
+    dinvnr_batch_avx512 ( p, q, n, x );
+    return;
+  }
+  if ( level == 1 )
+  {
+    dinvnr_batch_avx2 ( p, q, n, x );
+    return;
+  }
+# endif
+  (void) level;
+  dinvnr_batch_kernel ( p, q, n, x );
+}
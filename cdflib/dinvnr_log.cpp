@@ -0,0 +1,86 @@
+# include <iomanip>
+# include <cmath>
+using namespace std;
+# include "cdflib.hpp"
+
+//****************************************************************************80
+
+double dinvnr_log ( double *lp, double *lq )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    DINVNR_LOG inverts the normal CDF given the logs of the tails.
+//
+//  Discussion:
+//
+//    The result X satisfies LOG(CUMNOR(X)) = LP, or equivalently
+//    LOG(1-CUMNOR(X)) = LQ; the smaller of the two is used, and the
+//    other only has to identify the tail.  A tail probability of 1.0E-300
+//    is about 37 standard deviations, and the log of the tail lets the
+//    number of standard deviations go well beyond that.
+//
+//    If the smaller tail is above EXP(-600), DINVNR inverts it.  Below,
+//    Newton's method solves DLANOR(Z) = LT, where LT is the log of the
+//    small tail, from the leading terms of the asymptotic expansion.
+//
+//  Parameters:
+//
+//    Input, double *LP, *LQ, the logs of the lower and upper tail
+//    probabilities.  They should satisfy EXP(LP) + EXP(LQ) = 1.
+//
+//    Output, double DINVNR_LOG, the normal deviate.
+//
+{
+# define dlsqpi 0.91893853320467274177e0
+
+  double dz;
+  int i;
+  double lt;
+  double p;
+  double q;
+  double z;
+
+  lt = fmin ( *lp, *lq );
+  if ( lt == 0.0e0 )
+  {
+    return 0.0e0;
+  }
+  if ( -600.0e0 < lt )
+  {
+    p = exp ( lt );
+    q = 0.5e0 + ( 0.5e0 - p );
+    z = - dinvnr ( &p, &q );
+  }
+  else
+  {
+//
+//  Z*Z = -2*LT - 2*LOG(Z) - LOG(2*PI) to leading order.
+//
+    z = sqrt ( -2.0e0 * lt );
+    for ( i = 0; i < 2; i++ )
+    {
+      z = sqrt ( -2.0e0 * ( lt + dlsqpi + log ( z ) ) );
+    }
+//
+//  The derivative of DLANOR(Z) is -PHI(Z)/Q(Z).
+//
+    for ( i = 0; i < 10; i++ )
+    {
+      p = dlanor ( &z );
+      dz = ( p - lt ) / exp ( -dlsqpi - 0.5e0 * z * z - p );
+      z = z + dz;
+      if ( fabs ( dz ) <= 1.0e-15 * z )
+      {
+        break;
+      }
+    }
+  }
+  if ( *lp < *lq )
+  {
+    z = - z;
+  }
+  return z;
+# undef dlsqpi
+}
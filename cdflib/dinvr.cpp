@@ -20,6 +20,10 @@ void dinvr ( int *status, double *x, double *fx,
 //    invokes ZROR to perform the zero finding.  STINVR must have been
 //    called before this routine in order to set its parameters.
 //
+//    This form keeps its search state in per-thread storage, so only one
+//    search can be in progress on each thread.  Use the form that takes
+//    an explicit state to run several searches at once.
+//
 //  Reference:
 //
 //    J C P Bus and T J Dekker,
@@ -55,5 +59,36 @@ void dinvr ( int *status, double *x, double *fx,
 //    if F(X) < Y.
 //
 {
-  E0000(0,status,x,fx,qleft,qhi,NULL,NULL,NULL,NULL,NULL,NULL,NULL);
+  E0000(NULL,0,status,x,fx,qleft,qhi,NULL,NULL,NULL,NULL,NULL,NULL,NULL);
+  if ( *status == 1 )
+  {
+    cdf_eval_count = cdf_eval_count + 1;
+  }
+}
+//****************************************************************************80
+
+void dinvr ( dinvr_state *state, int *status, double *x, double *fx,
+  unsigned long *qleft, unsigned long *qhi )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    DINVR bounds the zero of the function and invokes DZROR, keeping
+//    the search in caller-owned storage.
+//
+//  Parameters:
+//
+//    Input/output, dinvr_state *STATE, the search state, set up by DSTINV
+//    with the same STATE.  It must not be modified while the search is in
+//    progress.
+//
+//    The remaining parameters are as for the form without STATE.
+//
+{
+  E0000(state,0,status,x,fx,qleft,qhi,NULL,NULL,NULL,NULL,NULL,NULL,NULL);
+  if ( *status == 1 )
+  {
+    cdf_eval_count = cdf_eval_count + 1;
+  }
 }
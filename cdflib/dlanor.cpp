@@ -1,7 +1,7 @@
 # include <iomanip>
 # include <cmath>
 using namespace std;
-# include "cdflib.hpp"
+# include "cdf.hpp"
 
 //****************************************************************************80
 
@@ -20,6 +20,8 @@ double dlanor ( double *x )
 //
 //    The relative error at X = 5 is about 0.5D-5.
 //
+//    The computation is the inline CDF::DETAIL::DLANOR of cdf.hpp.
+//
 //  Reference:
 //
 //    Milton Abramowitz and Irene Stegun,
@@ -35,26 +37,5 @@ double dlanor ( double *x )
 //    Normal CDF.
 //
 {
-# define dlsqpi 0.91893853320467274177e0
-
-  static double coef[12] = {
-    -1.0e0,3.0e0,-15.0e0,105.0e0,-945.0e0,10395.0e0,-135135.0e0,2027025.0e0,
-    -34459425.0e0,654729075.0e0,-13749310575.e0,316234143225.0e0
-  };
-  static int K1 = 12;
-  static double dlanor,approx,correc,xx,xx2,T2;
-
-  xx = fabs(*x);
-  if ( xx < 5.0e0 )
-  {
-    ftnstop(" Argument too small in DLANOR");
-  }
-  approx = -dlsqpi-0.5e0*xx*xx-log(xx);
-  xx2 = xx*xx;
-  T2 = 1.0e0/xx2;
-  correc = eval_pol ( coef, &K1, &T2 ) / xx2;
-  correc = alnrel ( &correc );
-  dlanor = approx+correc;
-  return dlanor;
-# undef dlsqpi
+  return cdf::detail::dlanor ( *x );
 }
@@ -0,0 +1,66 @@
+# include <iomanip>
+# include <cmath>
+using namespace std;
+# include "cdflib.hpp"
+
+//****************************************************************************80
+
+void dlnres ( double *v, double *target, unsigned long qincr, double *fx,
+  double *dfx, double *d2fx )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    DLNRES moves a DINVH residual onto the log scale.
+//
+//  Discussion:
+//
+//    DINVH converges slowly on the residual V - TARGET far in a tail,
+//    where V behaves like a power or an exponential of X.  On the log
+//    scale the same tail is nearly linear, so Halley steps stay accurate
+//    down to the smallest probabilities.
+//
+//    The residual R = V - TARGET if V increases with X, and
+//    R = TARGET - V if it decreases; either way R increases.  DLNRES
+//    replaces R by LOG(V) - LOG(TARGET), or its negative, with the same
+//    sign.  If V is 0, FX is set to -1 or 1, and DFX to 0, which makes
+//    DINVH step or bisect.
+//
+//  Parameters:
+//
+//    Input, double *V, the tail probability at X.
+//
+//    Input, double *TARGET, the probability to be matched, positive.
+//
+//    Input, unsigned long QINCR, is true if V increases with X.
+//
+//    Output, double *FX, the residual on the log scale.
+//
+//    Input/output, double *DFX, *D2FX.  On input, the first and second
+//    derivatives of R.  On output, those of FX.
+//
+{
+  double d;
+
+  if ( *v <= 0.0e0 )
+  {
+    *fx = qincr ? -1.0e0 : 1.0e0;
+    *dfx = 0.0e0;
+    *d2fx = 0.0e0;
+    return;
+  }
+  *fx = log ( *v ) - log ( *target );
+  d = *dfx / *v;
+  if ( qincr )
+  {
+    *d2fx = *d2fx / *v - d * d;
+  }
+  else
+  {
+    *fx = - *fx;
+    *d2fx = *d2fx / *v + d * d;
+  }
+  *dfx = d;
+  return;
+}
@@ -37,12 +37,12 @@ double dpmpar ( int *i )
 //     MADE AS PART OF CONVERTING BRATIO TO DOUBLE PRECISION
 //
 {
-  static int K1 = 4;
-  static int K2 = 8;
-  static int K3 = 9;
-  static int K4 = 10;
-  static double value,b,binv,bm1,one,w,z;
-  static int emax,emin,ibeta,m;
+  int K1 = 4;
+  int K2 = 8;
+  int K3 = 9;
+  int K4 = 10;
+  double value,b,binv,bm1,one,w,z;
+  int emax,emin,ibeta,m;
 
     if(*i > 1) goto S10;
     b = ipmpar(&K1);
@@ -71,3 +71,27 @@ S20:
     value = w*z*b*b;
     return value;
 }
+# if defined ( CDFLIB_RUNTIME_MACHINE )
+//****************************************************************************80
+
+static double dpmpar_value ( int i )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    DPMPAR_VALUE calls DPMPAR with a value argument.
+//
+//  Discussion:
+//
+//    It initializes the machine constants DPMPAR_EPS, DPMPAR_TINY and
+//    DPMPAR_HUGE when they are not known at compile time.
+//
+{
+  return dpmpar ( &i );
+}
+
+const double dpmpar_eps = dpmpar_value ( 1 );
+const double dpmpar_tiny = dpmpar_value ( 2 );
+const double dpmpar_huge = dpmpar_value ( 3 );
+# endif
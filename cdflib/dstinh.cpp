@@ -0,0 +1,41 @@
+# include <iomanip>
+# include <cmath>
+using namespace std;
+# include "cdflib.hpp"
+
+//****************************************************************************80
+
+void dstinh ( dinvh_state *state, double *zsmall, double *zbig,
+  double *zabsto, double *zrelto )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    DSTINH sets the parameters of a DINVH search.
+//
+//  Parameters:
+//
+//    Output, dinvh_state *STATE, the search state to initialize.
+//
+//    Input, double *ZSMALL, *ZBIG, the range in which the zero is sought.
+//
+//    Input, double *ZABSTO, *ZRELTO, the absolute and relative
+//    tolerances.  The search stops when the Newton step is smaller than
+//    ZRELTO * |X|, or when the bracket is narrower than
+//    max ( ZABSTO, ZRELTO * |X| ); ZABSTO is ignored once the bracket
+//    excludes 0.
+//
+{
+  state->small = *zsmall;
+  state->big = *zbig;
+  state->abstol = *zabsto;
+  state->reltol = *zrelto;
+  state->xlo = *zsmall;
+  state->xhi = *zbig;
+  state->step = *zbig - *zsmall;
+  state->qxlo = 0;
+  state->qxhi = 0;
+  cdf_eval_count = 0;
+  return;
+}
@@ -73,7 +73,36 @@ void dstinv ( double *zsmall, double *zbig, double *zabsst,
 //     to find the zero of the function F(X)-Y. This is routine
 //     QRZERO.
 //
+//    This form keeps its search state in per-thread storage, so only one
+//    search can be in progress on each thread.  Use the form that takes
+//    an explicit state to run several searches at once.
+//
 {
-  E0000(1,NULL,NULL,NULL,NULL,NULL,zabsst,zabsto,zbig,zrelst,zrelto,zsmall,
+  E0000(NULL,1,NULL,NULL,NULL,NULL,NULL,zabsst,zabsto,zbig,zrelst,zrelto,zsmall,
     zstpmu);
+  cdf_eval_count = 0;
+}
+//****************************************************************************80
+
+void dstinv ( dinvr_state *state, double *zsmall, double *zbig,
+  double *zabsst, double *zrelst, double *zstpmu, double *zabsto,
+  double *zrelto )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    DSTINV sets the parameters of a DINVR search held in caller-owned
+//    storage.
+//
+//  Parameters:
+//
+//    Output, dinvr_state *STATE, the search state to initialize.
+//
+//    The remaining parameters are as for the form without STATE.
+//
+{
+  E0000(state,1,NULL,NULL,NULL,NULL,NULL,zabsst,zabsto,zbig,zrelst,zrelto,
+    zsmall,zstpmu);
+  cdf_eval_count = 0;
 }
@@ -43,7 +43,7 @@ double dstrem ( double *z )
 # define hln2pi 0.91893853320467274178e0
 # define ncoef 10
 
-  static double coef[ncoef] = {
+  static const double coef[ncoef] = {
     0.0e0,0.0833333333333333333333333333333e0,
     -0.00277777777777777777777777777778e0,0.000793650793650793650793650793651e0,
     -0.000595238095238095238095238095238e0,
@@ -51,8 +51,8 @@ double dstrem ( double *z )
     0.00641025641025641025641025641026e0,-0.0295506535947712418300653594771e0,
     0.179644372368830573164938490016e0
   };
-  static int K1 = 10;
-  static double dstrem,sterl,T2;
+  int K1 = 10;
+  double dstrem,sterl,T2;
 //
 //    For information, here are the next 11 coefficients of the
 //    remainder term in Sterling's formula
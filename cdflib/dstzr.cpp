@@ -54,6 +54,33 @@ void dstzr ( double *zxlo, double *zxhi, double *zabstl, double *zreltl )
 //     Mathematical Software, Volume 1, no. 4 page 330
 //     (Dec. '75) is employed to find the zero of F(X)-Y.
 //
+//    This form keeps its search state in per-thread storage, so only one
+//    search can be in progress on each thread.  Use the form that takes
+//    an explicit state to run several searches at once.
+//
+{
+  E0001(NULL,1,NULL,NULL,NULL,NULL,NULL,NULL,NULL,zabstl,zreltl,zxhi,zxlo);
+  cdf_eval_count = 0;
+}
+//****************************************************************************80
+
+void dstzr ( dzror_state *state, double *zxlo, double *zxhi,
+  double *zabstl, double *zreltl )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    DSTZR sets the parameters of a DZROR search held in caller-owned
+//    storage.
+//
+//  Parameters:
+//
+//    Output, dzror_state *STATE, the search state to initialize.
+//
+//    The remaining parameters are as for the form without STATE.
+//
 {
-  E0001(1,NULL,NULL,NULL,NULL,NULL,NULL,NULL,zabstl,zreltl,zxhi,zxlo);
+  E0001(state,1,NULL,NULL,NULL,NULL,NULL,NULL,NULL,zabstl,zreltl,zxhi,zxlo);
+  cdf_eval_count = 0;
 }
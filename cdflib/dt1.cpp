@@ -31,18 +31,18 @@ double dt1 ( double *p, double *q, double *df )
 //    the T density CDF with DF degrees of freedom has value P.
 //
 {
-  static double coef[4][5] = {
+  static const double coef[4][5] = {
     {1.0e0,1.0e0,0.0e0,0.0e0,0.0e0},{3.0e0,16.0e0,5.0e0,0.0e0,0.0e0},{-15.0e0,17.0e0,
     19.0e0,3.0e0,0.0e0},{-945.0e0,-1920.0e0,1482.0e0,776.0e0,79.0e0}
   };
-  static double denom[4] = {
+  static const double denom[4] = {
     4.0e0,96.0e0,384.0e0,92160.0e0
   };
-  static int ideg[4] = {
+  static const int ideg[4] = {
     2,3,4,5
   };
-  static double dt1,denpow,sum,term,x,xp,xx;
-  static int i;
+  double dt1,denpow,sum,term,x,xp,xx;
+  int i;
 
     x = fabs(dinvnr(p,q));
     xx = x*x;
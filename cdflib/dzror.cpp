@@ -66,6 +66,41 @@ void dzror ( int *status, double *x, double *fx, double *xlo,
 //                    QHI is LOGICAL
 //
 //
+//    This form keeps its search state in per-thread storage, so only one
+//    search can be in progress on each thread.  Use the form that takes
+//    an explicit state to run several searches at once.
+//
+{
+  E0001(NULL,0,status,x,fx,xlo,xhi,qleft,qhi,NULL,NULL,NULL,NULL);
+  if ( *status == 1 )
+  {
+    cdf_eval_count = cdf_eval_count + 1;
+  }
+}
+//****************************************************************************80
+
+void dzror ( dzror_state *state, int *status, double *x, double *fx,
+  double *xlo, double *xhi, unsigned long *qleft, unsigned long *qhi )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    DZROR seeks a zero of a function, keeping the search in caller-owned
+//    storage.
+//
+//  Parameters:
+//
+//    Input/output, dzror_state *STATE, the search state, set up by DSTZR
+//    with the same STATE.  It must not be modified while the search is in
+//    progress.
+//
+//    The remaining parameters are as for the form without STATE.
+//
 {
-  E0001(0,status,x,fx,xlo,xhi,qleft,qhi,NULL,NULL,NULL,NULL);
+  E0001(state,0,status,x,fx,xlo,xhi,qleft,qhi,NULL,NULL,NULL,NULL);
+  if ( *status == 1 )
+  {
+    cdf_eval_count = cdf_eval_count + 1;
+  }
 }
@@ -20,33 +20,33 @@ double error_f ( double *x )
 //    Output, double ERROR_F, the value of the error function at X.
 //
 {
-  static double c = .564189583547756e0;
-  static double a[5] = {
+  double c = .564189583547756e0;
+  static const double a[5] = {
     .771058495001320e-04,-.133733772997339e-02,.323076579225834e-01,
     .479137145607681e-01,.128379167095513e+00
   };
-  static double b[3] = {
+  static const double b[3] = {
     .301048631703895e-02,.538971687740286e-01,.375795757275549e+00
   };
-  static double p[8] = {
+  static const double p[8] = {
     -1.36864857382717e-07,5.64195517478974e-01,7.21175825088309e+00,
     4.31622272220567e+01,1.52989285046940e+02,3.39320816734344e+02,
     4.51918953711873e+02,3.00459261020162e+02
   };
-  static double q[8] = {
+  static const double q[8] = {
     1.00000000000000e+00,1.27827273196294e+01,7.70001529352295e+01,
     2.77585444743988e+02,6.38980264465631e+02,9.31354094850610e+02,
     7.90950925327898e+02,3.00459260956983e+02
   };
-  static double r[5] = {
+  static const double r[5] = {
     2.10144126479064e+00,2.62370141675169e+01,2.13688200555087e+01,
     4.65807828718470e+00,2.82094791773523e-01
   };
-  static double s[4] = {
+  static const double s[4] = {
     9.41537750555460e+01,1.87114811799590e+02,9.90191814623914e+01,
     1.80124575948747e+01
   };
-  static double erf1,ax,bot,t,top,x2;
+  double erf1,ax,bot,t,top,x2;
 
     ax = fabs(*x);
     if(ax > 0.5e0) goto S10;
@@ -19,7 +19,7 @@ double esum ( int *mu, double *x )
 //    Output, double ESUM, the value of exp ( MU + X ).
 //
 {
-  static double esum,w;
+  double esum,w;
 
     if(*x > 0.0e0) goto S10;
     if(*mu < 0) goto S20;
@@ -2,7 +2,7 @@
 
 //****************************************************************************80
 
-double eval_pol ( double a[], int *n, double *x )
+double eval_pol ( const double a[], const int *n, double *x )
 
 //****************************************************************************80
 //
@@ -30,8 +30,8 @@ double eval_pol ( double a[], int *n, double *x )
 //    Output, double EVAL_POL, the value of the polynomial at X.
 //
 {
-  static double devlpl,term;
-  static int i;
+  double devlpl,term;
+  int i;
 
   term = a[*n-1];
   for ( i = *n-1-1; i >= 0; i-- )
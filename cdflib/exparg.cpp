@@ -31,11 +31,11 @@ double exparg ( int *l )
 //    Output, double EXPARG, the desired value.
 //
 {
-  static int K1 = 4;
-  static int K2 = 9;
-  static int K3 = 10;
-  static double exparg,lnb;
-  static int b,m;
+  int K1 = 4;
+  int K2 = 9;
+  int K3 = 10;
+  double exparg,lnb;
+  int b,m;
 
     b = ipmpar(&K1);
     if(b != 2) goto S10;
@@ -61,3 +61,26 @@ S50:
     exparg = 0.99999e0*((double)m*lnb);
     return exparg;
 }
+# if defined ( CDFLIB_RUNTIME_MACHINE )
+//****************************************************************************80
+
+static double exparg_value ( int l )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    EXPARG_VALUE calls EXPARG with a value argument.
+//
+//  Discussion:
+//
+//    It initializes the machine constants EXPARG_MAX and EXPARG_MIN when
+//    they are not known at compile time.
+//
+{
+  return exparg ( &l );
+}
+
+const double exparg_max = exparg_value ( 0 );
+const double exparg_min = exparg_value ( 1 );
+# endif
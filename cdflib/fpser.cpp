@@ -35,14 +35,13 @@ double fpser ( double *a, double *b, double *x, double *eps )
 //    Output, double FPSER, the value of IX(A,B)(X).
 //
 {
-  static int K1 = 1;
-  static double fpser,an,c,s,t,tol;
+  double fpser,an,c,s,t,tol;
 
     fpser = 1.0e0;
     if(*a <= 1.e-3**eps) goto S10;
     fpser = 0.0e0;
     t = *a*log(*x);
-    if(t < exparg(&K1)) return fpser;
+    if(t < exparg_min) return fpser;
     fpser = exp(t);
 S10:
 //
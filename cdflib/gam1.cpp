@@ -20,23 +20,23 @@ double gam1 ( double *a )
 //    Output, double GAM1, the value of 1 / GAMMA ( A + 1 ) - 1.
 //
 {
-  static double s1 = .273076135303957e+00;
-  static double s2 = .559398236957378e-01;
-  static double p[7] = {
+  double s1 = .273076135303957e+00;
+  double s2 = .559398236957378e-01;
+  static const double p[7] = {
     .577215664901533e+00,-.409078193005776e+00,-.230975380857675e+00,
     .597275330452234e-01,.766968181649490e-02,-.514889771323592e-02,
     .589597428611429e-03
   };
-  static double q[5] = {
+  static const double q[5] = {
     .100000000000000e+01,.427569613095214e+00,.158451672430138e+00,
     .261132021441447e-01,.423244297896961e-02
   };
-  static double r[9] = {
+  static const double r[9] = {
     -.422784335098468e+00,-.771330383816272e+00,-.244757765222226e+00,
     .118378989872749e+00,.930357293360349e-03,-.118290993445146e-01,
     .223047661158249e-02,.266505979058923e-03,-.132674909766242e-03
   };
-  static double gam1,bot,d,t,top,w,T1;
+  double gam1,bot,d,t,top,w,T1;
 
     t = *a;
     d = *a-0.5e0;
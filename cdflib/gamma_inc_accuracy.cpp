@@ -0,0 +1,61 @@
+# include <iomanip>
+# include <cmath>
+using namespace std;
+# include "cdflib.hpp"
+
+thread_local int gamma_inc_thread_ind = 0;
+
+//****************************************************************************80
+
+int gamma_inc_accuracy ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    GAMMA_INC_ACCURACY returns the accuracy request of this thread.
+//
+//  Discussion:
+//
+//    CUMGAM, CUMCHI, CUMPOI and the PREPARED* gamma classes pass this
+//    value to GAMMA_INC as IND, unless the caller gives one explicitly.
+//    The CDF* routines that evaluate these distributions use it as well.
+//    Every thread starts at 0, full accuracy.
+//
+//  Parameters:
+//
+//    Output, int GAMMA_INC_ACCURACY, the value of IND: 0, 1 or 2 for
+//    about 14, 6 or 3 significant digits.
+//
+{
+  return gamma_inc_thread_ind;
+}
+//****************************************************************************80
+
+void gamma_inc_set_accuracy ( int ind )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    GAMMA_INC_SET_ACCURACY sets the accuracy request of this thread.
+//
+//  Discussion:
+//
+//    The setting is per thread, so worker threads must set it themselves.
+//    GAMMA_INC_IND and GAMMA_INC_IND_NSIGMA choose the value from a
+//    required relative error.
+//
+//  Parameters:
+//
+//    Input, int IND, 0, 1 or 2 for about 14, 6 or 3 significant digits.
+//    Other values are taken as 2, as by GAMMA_INC.
+//
+{
+  if ( ind != 0 && ind != 1 )
+  {
+    ind = 2;
+  }
+  gamma_inc_thread_ind = ind;
+  return;
+}
@@ -0,0 +1,192 @@
+# include <iomanip>
+# include <cmath>
+using namespace std;
+# include "cdflib.hpp"
+# include "gamma_inc_kernel.hpp"
+
+//****************************************************************************80
+
+void gamma_inc_batch ( const double *a, const double *x, size_t n,
+  double *ans, double *qans, int *ind )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    GAMMA_INC_BATCH evaluates P(A,X) and Q(A,X) for arrays of arguments.
+//
+//  Discussion:
+//
+//    The results are the same as those of N calls to GAMMA_INC, whose
+//    algorithms it shares (gamma_inc_kernel.hpp).  The machine constant
+//    and the accuracy settings are looked up once, and each pair is first
+//    assigned to the algorithm GAMMA_INC would use (series, finite sum,
+//    Taylor series, continued fraction, asymptotic or Temme expansion).
+//    The pairs are then evaluated one algorithm at a time, so that each
+//    group runs as a tight loop over the same code.
+//
+//    Where GAMMA_INC would set ANS to 2 and leave QANS unchanged,
+//    GAMMA_INC_BATCH sets both ANS(I) and QANS(I) to 2.
+//
+//  Parameters:
+//
+//    Input, const double *A, *X, the N pairs of arguments.
+//
+//    Input, size_t N, the number of pairs.
+//
+//    Output, double *ANS, *QANS, the values of P(A,X) and Q(A,X).
+//
+//    Input, int *IND, the accuracy request, as for GAMMA_INC.
+//
+{
+  double acc;
+  int b;
+  size_t count[GI_COUNT];
+  double e;
+  size_t i;
+  size_t *idx;
+  int iop;
+  size_t k;
+  unsigned char *kind;
+  double *r;
+  size_t start[GI_COUNT];
+  double tol;
+
+  if ( n == 0 )
+  {
+    return;
+  }
+
+  e = dpmpar_eps;
+  iop = *ind + 1;
+  if ( iop != 1 && iop != 2 )
+  {
+    iop = 3;
+  }
+  acc = fifdmax1 ( gi_acc0[iop-1], e );
+  tol = fifdmax1 ( 5.0e0 * e, acc );
+
+  kind = new unsigned char[n];
+  r = new double[n];
+  idx = new size_t[n];
+//
+//  Classify, then sort the indices by algorithm.
+//
+  for ( b = 0; b < GI_COUNT; b++ )
+  {
+    count[b] = 0;
+  }
+  for ( i = 0; i < n; i++ )
+  {
+    kind[i] = ( unsigned char ) gamma_inc_branch ( a[i], x[i], iop, e, NULL,
+      &r[i] );
+    count[kind[i]] += 1;
+  }
+  start[0] = 0;
+  for ( b = 1; b < GI_COUNT; b++ )
+  {
+    start[b] = start[b-1] + count[b-1];
+  }
+  for ( i = 0; i < n; i++ )
+  {
+    idx[start[kind[i]]] = i;
+    start[kind[i]] += 1;
+  }
+//
+//  Evaluate each group.
+//
+  k = 0;
+  for ( b = 0; b < GI_COUNT; b++ )
+  {
+    size_t kend = k + count[b];
+
+    switch ( b )
+    {
+    case GI_ERROR:
+      for ( ; k < kend; k++ )
+      {
+        ans[idx[k]] = 2.0e0;
+        qans[idx[k]] = 2.0e0;
+      }
+      break;
+    case GI_ZERO:
+      for ( ; k < kend; k++ )
+      {
+        ans[idx[k]] = 0.0e0;
+        qans[idx[k]] = 1.0e0;
+      }
+      break;
+    case GI_ONE:
+      for ( ; k < kend; k++ )
+      {
+        ans[idx[k]] = 1.0e0;
+        qans[idx[k]] = 0.0e0;
+      }
+      break;
+    case GI_HALF:
+      for ( ; k < kend; k++ )
+      {
+        i = idx[k];
+        gamma_inc_half ( x[i], &ans[i], &qans[i] );
+      }
+      break;
+    case GI_SERIES:
+      for ( ; k < kend; k++ )
+      {
+        i = idx[k];
+        gamma_inc_series ( a[i], x[i], acc, NULL, &ans[i], &qans[i] );
+      }
+      break;
+    case GI_FINITE:
+      for ( ; k < kend; k++ )
+      {
+        i = idx[k];
+        gamma_inc_finite ( a[i], x[i], &ans[i], &qans[i] );
+      }
+      break;
+    case GI_TAYLOR:
+      for ( ; k < kend; k++ )
+      {
+        i = idx[k];
+        gamma_inc_taylor ( a[i], x[i], r[i], acc, &ans[i], &qans[i] );
+      }
+      break;
+    case GI_ASYMP:
+      for ( ; k < kend; k++ )
+      {
+        i = idx[k];
+        gamma_inc_asymp ( a[i], x[i], r[i], acc, &ans[i], &qans[i] );
+      }
+      break;
+    case GI_CFRAC:
+      for ( ; k < kend; k++ )
+      {
+        i = idx[k];
+        gamma_inc_cfrac ( a[i], x[i], r[i], tol, &ans[i], &qans[i] );
+      }
+      break;
+    case GI_TEMME:
+      for ( ; k < kend; k++ )
+      {
+        i = idx[k];
+        gamma_inc_temme ( a[i], x[i], r[i], iop, e, &ans[i], &qans[i] );
+        qans[i] = ( ans[i] == 2.0e0 ) ? 2.0e0 : qans[i];
+      }
+      break;
+    case GI_TEMME1:
+      for ( ; k < kend; k++ )
+      {
+        i = idx[k];
+        gamma_inc_temme1 ( a[i], x[i], r[i], iop, e, &ans[i], &qans[i] );
+        qans[i] = ( ans[i] == 2.0e0 ) ? 2.0e0 : qans[i];
+      }
+      break;
+    }
+  }
+
+  delete [] idx;
+  delete [] kind;
+  delete [] r;
+
+  return;
+}
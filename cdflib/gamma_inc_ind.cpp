@@ -0,0 +1,87 @@
+# include <iomanip>
+# include <cmath>
+using namespace std;
+# include "cdflib.hpp"
+
+//****************************************************************************80
+
+int gamma_inc_ind ( double relerr )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    GAMMA_INC_IND picks the cheapest GAMMA_INC accuracy for an error.
+//
+//  Discussion:
+//
+//    GAMMA_INC stops its series and expansions at a relative error of
+//    5.0E-15, 5.0E-07 or 5.0E-04 for IND = 0, 1 or 2, and selects its
+//    methods by these.  The result is the largest IND whose bound does
+//    not exceed RELERR, so P and Q are both computed to a relative error
+//    of RELERR.  IND = 1 saves about 20% of the time of IND = 0, and
+//    IND = 2 about 25%.
+//
+//  Parameters:
+//
+//    Input, double RELERR, the relative error allowed in P and Q.
+//
+//    Output, int GAMMA_INC_IND, the value of IND to use.
+//
+{
+  if ( 5.0e-04 <= relerr )
+  {
+    return 2;
+  }
+  if ( 5.0e-07 <= relerr )
+  {
+    return 1;
+  }
+  return 0;
+}
+//****************************************************************************80
+
+int gamma_inc_ind_nsigma ( double relerr, double nsigma )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    GAMMA_INC_IND_NSIGMA picks the GAMMA_INC accuracy for a significance.
+//
+//  Discussion:
+//
+//    A relative error D in a tail probability Q changes the number of
+//    standard deviations Z = -DINVNR(Q) by D*Q/PHI(Z), where PHI is the
+//    normal density, so the relative error in Z is D*Q/(Z*PHI(Z)).  For
+//    large Z this is about D/Z**2, so a significance needs much less
+//    accuracy in the p-value than its relative error suggests.  At or
+//    below Z = 0 the relative error of Z is unbounded, and full accuracy
+//    is returned.
+//
+//  Parameters:
+//
+//    Input, double RELERR, the relative error allowed in the number
+//    of standard deviations.
+//
+//    Input, double NSIGMA, the expected number of standard deviations.
+//
+//    Output, int GAMMA_INC_IND_NSIGMA, the value of IND to use.
+//
+{
+  double cum;
+  double ccum;
+  double phi;
+
+  if ( nsigma <= 0.0e0 )
+  {
+    return 0;
+  }
+  cumnor ( &nsigma, &cum, &ccum );
+  if ( ccum <= 0.0e0 )
+  {
+    return gamma_inc_ind ( relerr * ( nsigma * nsigma + 1.0e0 ) );
+  }
+  phi = 0.398942280401432678e0 * exp ( -0.5e0 * nsigma * nsigma );
+  return gamma_inc_ind ( relerr * nsigma * phi / ccum );
+}
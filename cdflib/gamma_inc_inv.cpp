@@ -61,40 +61,37 @@ void gamma_inc_inv ( double *a, double *x, double *x0, double *p, double *q,
 //        exceedingly close to X and A is extremely large (say A .GE. 1.E20).
 //
 {
-  static double a0 = 3.31125922108741e0;
-  static double a1 = 11.6616720288968e0;
-  static double a2 = 4.28342155967104e0;
-  static double a3 = .213623493715853e0;
-  static double b1 = 6.61053765625462e0;
-  static double b2 = 6.40691597760039e0;
-  static double b3 = 1.27364489782223e0;
-  static double b4 = .036117081018842e0;
-  static double c = .577215664901533e0;
-  static double ln10 = 2.302585e0;
-  static double tol = 1.e-5;
-  static double amin[2] = {
+  double a0 = 3.31125922108741e0;
+  double a1 = 11.6616720288968e0;
+  double a2 = 4.28342155967104e0;
+  double a3 = .213623493715853e0;
+  double b1 = 6.61053765625462e0;
+  double b2 = 6.40691597760039e0;
+  double b3 = 1.27364489782223e0;
+  double b4 = .036117081018842e0;
+  double c = .577215664901533e0;
+  double ln10 = 2.302585e0;
+  double tol = 1.e-5;
+  static const double amin[2] = {
     500.0e0,100.0e0
   };
-  static double bmin[2] = {
+  static const double bmin[2] = {
     1.e-28,1.e-13
   };
-  static double dmin[2] = {
+  static const double dmin[2] = {
     1.e-06,1.e-04
   };
-  static double emin[2] = {
+  static const double emin[2] = {
     2.e-03,6.e-03
   };
-  static double eps0[2] = {
+  static const double eps0[2] = {
     1.e-10,1.e-08
   };
-  static int K1 = 1;
-  static int K2 = 2;
-  static int K3 = 3;
-  static int K8 = 0;
-  static double am1,amax,ap1,ap2,ap3,apn,b,c1,c2,c3,c4,c5,d,e,e2,eps,g,h,pn,qg,qn,
+  int K8 = 0;
+  double am1,amax,ap1,ap2,ap3,apn,b = 0.0e0,c1,c2,c3,c4,c5,d,e,e2,eps,g,h,pn,qg,qn,
     r,rta,s,s2,sum,t,u,w,xmax,xmin,xn,y,z;
-  static int iop;
-  static double T4,T5,T6,T7,T9;
+  int iop;
+  double T4,T5,T6,T7,T9;
 
 //
 //  E, XMIN, AND XMAX ARE MACHINE DEPENDENT CONSTANTS.
@@ -102,9 +99,9 @@ void gamma_inc_inv ( double *a, double *x, double *x0, double *p, double *q,
 //            XMIN IS THE SMALLEST POSITIVE NUMBER AND XMAX IS THE
 //            LARGEST POSITIVE NUMBER.
 //
-    e = dpmpar(&K1);
-    xmin = dpmpar(&K2);
-    xmax = dpmpar(&K3);
+    e = dpmpar_eps;
+    xmin = dpmpar_tiny;
+    xmax = dpmpar_huge;
     *x = 0.0e0;
     if(*a <= 0.0e0) goto S300;
     t = *p+*q-1.e0;
@@ -0,0 +1,642 @@
+# ifndef GAMMA_INC_KERNEL_HPP
+# define GAMMA_INC_KERNEL_HPP
+//
+//  The algorithms of GAMMA_INC, one routine each, shared by GAMMA_INC and
+//  GAMMA_INC_BATCH so that the two cannot drift apart.  GAMMA_INC_BRANCH
+//  picks the algorithm for a pair (A,X), and GAMMA_INC runs it at once,
+//  while GAMMA_INC_BATCH first sorts an array of pairs by algorithm.
+//  The constants are those of Morris's GAMMA_INC.
+//
+# include <cmath>
+# include "cdflib.hpp"
+
+//
+//  Algorithms of GAMMA_INC, in the order in which GAMMA_INC_BATCH runs them.
+//
+enum
+{
+  GI_ERROR,
+  GI_ZERO,
+  GI_ONE,
+  GI_HALF,
+  GI_SERIES,
+  GI_FINITE,
+  GI_TAYLOR,
+  GI_ASYMP,
+  GI_CFRAC,
+  GI_TEMME,
+  GI_TEMME1,
+  GI_COUNT
+};
+
+const double gi_alog10 = 2.30258509299405e0;
+const double gi_d10 = -.185185185185185e-02;
+const double gi_d20 = .413359788359788e-02;
+const double gi_d30 = .649434156378601e-03;
+const double gi_d40 = -.861888290916712e-03;
+const double gi_d50 = -.336798553366358e-03;
+const double gi_d60 = .531307936463992e-03;
+const double gi_d70 = .344367606892378e-03;
+const double gi_rt2pin = .398942280401433e0;
+const double gi_rtpi = 1.77245385090552e0;
+const double gi_third = .333333333333333e0;
+const double gi_acc0[3] = {
+  5.e-15,5.e-7,5.e-4
+};
+const double gi_big[3] = {
+  20.0e0,14.0e0,10.0e0
+};
+const double gi_d0[13] = {
+  .833333333333333e-01,-.148148148148148e-01,.115740740740741e-02,
+  .352733686067019e-03,-.178755144032922e-03,.391926317852244e-04,
+  -.218544851067999e-05,-.185406221071516e-05,.829671134095309e-06,
+  -.176659527368261e-06,.670785354340150e-08,.102618097842403e-07,
+  -.438203601845335e-08
+};
+const double gi_d1[12] = {
+  -.347222222222222e-02,.264550264550265e-02,-.990226337448560e-03,
+  .205761316872428e-03,-.401877572016461e-06,-.180985503344900e-04,
+  .764916091608111e-05,-.161209008945634e-05,.464712780280743e-08,
+  .137863344691572e-06,-.575254560351770e-07,.119516285997781e-07
+};
+const double gi_d2[10] = {
+  -.268132716049383e-02,.771604938271605e-03,.200938786008230e-05,
+  -.107366532263652e-03,.529234488291201e-04,-.127606351886187e-04,
+  .342357873409614e-07,.137219573090629e-05,-.629899213838006e-06,
+  .142806142060642e-06
+};
+const double gi_d3[8] = {
+  .229472093621399e-03,-.469189494395256e-03,.267720632062839e-03,
+  -.756180167188398e-04,-.239650511386730e-06,.110826541153473e-04,
+  -.567495282699160e-05,.142309007324359e-05
+};
+const double gi_d4[6] = {
+  .784039221720067e-03,-.299072480303190e-03,-.146384525788434e-05,
+  .664149821546512e-04,-.396836504717943e-04,.113757269706784e-04
+};
+const double gi_d5[4] = {
+  -.697281375836586e-04,.277275324495939e-03,-.199325705161888e-03,
+  .679778047793721e-04
+};
+const double gi_d6[2] = {
+  -.592166437353694e-03,.270878209671804e-03
+};
+const double gi_e00[3] = {
+  .25e-3,.25e-1,.14e0
+};
+const double gi_x00[3] = {
+  31.0e0,17.0e0,9.7e0
+};
+
+//****************************************************************************80
+
+static inline int gamma_inc_branch ( double a, double x, int iop, double e,
+  const gamma_norm *nrm, double *r )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    GAMMA_INC_BRANCH selects the algorithm GAMMA_INC uses for (A,X).
+//
+//  Discussion:
+//
+//    The selection follows the original GAMMA_INC step by step.  For
+//    GI_TAYLOR, GI_ASYMP and GI_CFRAC the common factor R is computed on
+//    the way; for GI_TEMME and GI_TEMME1, R is set to RLOG(X/A).  NRM is
+//    used, as in GAMMA_INC, when it is not NULL and was set for A.
+//
+{
+  double l,rta,s,t,t1,twoa,u,y,z;
+  long m;
+  bool pre;
+
+  if ( a < 0.0e0 || x < 0.0e0 )
+  {
+    return GI_ERROR;
+  }
+  if ( a == 0.0e0 && x == 0.0e0 )
+  {
+    return GI_ERROR;
+  }
+  if ( a * x == 0.0e0 )
+  {
+    return ( x <= a ) ? GI_ZERO : GI_ONE;
+  }
+  pre = ( nrm != NULL && nrm->a == a );
+
+  if ( a < 1.0e0 )
+  {
+    if ( a == 0.5e0 )
+    {
+      return GI_HALF;
+    }
+    if ( x < 1.1e0 )
+    {
+      return GI_SERIES;
+    }
+    t1 = a * log ( x ) - x;
+    u = a * exp ( t1 );
+    if ( u == 0.0e0 )
+    {
+      return GI_ONE;
+    }
+    *r = u * ( 1.0e0 + ( pre ? nrm->gam1 : gam1 ( &a ) ) );
+    return GI_CFRAC;
+  }
+
+  if ( a < gi_big[iop-1] )
+  {
+    if ( a <= x && x < gi_x00[iop-1] )
+    {
+      twoa = a + a;
+      m = fifidint ( twoa );
+      if ( twoa == ( double ) m )
+      {
+        return GI_FINITE;
+      }
+    }
+    t1 = a * log ( x ) - x;
+    *r = exp ( t1 ) / ( pre ? nrm->gamma_x : gamma_x ( &a ) );
+  }
+  else
+  {
+    l = x / a;
+    if ( l == 0.0e0 )
+    {
+      return GI_ZERO;
+    }
+    s = 0.5e0 + ( 0.5e0 - l );
+    z = rlog ( &l );
+    if ( z >= 700.0e0 / a )
+    {
+      if ( fabs ( s ) <= 2.0e0 * e )
+      {
+        return GI_ERROR;
+      }
+      return ( x <= a ) ? GI_ZERO : GI_ONE;
+    }
+    y = a * z;
+    rta = pre ? nrm->rta : sqrt ( a );
+    if ( fabs ( s ) <= gi_e00[iop-1] / rta )
+    {
+      *r = z;
+      return GI_TEMME1;
+    }
+    if ( fabs ( s ) <= 0.4e0 )
+    {
+      *r = z;
+      return GI_TEMME;
+    }
+    if ( pre )
+    {
+      t1 = nrm->stirling;
+    }
+    else
+    {
+      t = pow ( 1.0e0 / a, 2.0 );
+      t1 = ( ( ( 0.75e0 * t - 1.0e0 ) * t + 3.5e0 ) * t - 105.0e0 )
+        / ( a * 1260.0e0 );
+    }
+    t1 -= y;
+    *r = gi_rt2pin * rta * exp ( t1 );
+  }
+
+  if ( *r == 0.0e0 )
+  {
+    return ( x <= a ) ? GI_ZERO : GI_ONE;
+  }
+  if ( x <= fifdmax1 ( a, gi_alog10 ) )
+  {
+    return GI_TAYLOR;
+  }
+  if ( x < gi_x00[iop-1] )
+  {
+    return GI_CFRAC;
+  }
+  return GI_ASYMP;
+}
+//****************************************************************************80
+
+static inline void gamma_inc_series ( double a, double x, double acc,
+  const gamma_norm *nrm, double *ans, double *qans )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    GAMMA_INC_SERIES sums the Taylor series for P(A,X)/X**A, A < 1.
+//
+{
+  double an,c,g,h,j,l,sum,t,tol,w,z;
+
+  an = 3.0e0;
+  c = x;
+  sum = x / ( a + 3.0e0 );
+  tol = 3.0e0 * acc / ( a + 1.0e0 );
+  do
+  {
+    an += 1.0e0;
+    c = -( c * ( x / an ) );
+    t = c / ( a + an );
+    sum += t;
+  } while ( fabs ( t ) > tol );
+  j = a * x * ( ( sum / 6.0e0 - 0.5e0 / ( a + 2.0e0 ) ) * x
+    + 1.0e0 / ( a + 1.0e0 ) );
+  z = a * log ( x );
+  h = ( nrm != NULL && nrm->a == a ) ? nrm->gam1 : gam1 ( &a );
+  g = 1.0e0 + h;
+
+  if ( ( x < 0.25e0 && z <= -.13394e0 ) ||
+       ( 0.25e0 <= x && x / 2.59e0 <= a ) )
+  {
+    w = exp ( z );
+    *ans = w * g * ( 0.5e0 + ( 0.5e0 - j ) );
+    *qans = 0.5e0 + ( 0.5e0 - *ans );
+    return;
+  }
+  l = rexp ( &z );
+  w = 0.5e0 + ( 0.5e0 + l );
+  *qans = ( w * j - l ) * g - h;
+  if ( *qans < 0.0e0 )
+  {
+    *ans = 1.0e0;
+    *qans = 0.0e0;
+    return;
+  }
+  *ans = 0.5e0 + ( 0.5e0 - *qans );
+  return;
+}
+//****************************************************************************80
+
+static inline void gamma_inc_half ( double x, double *ans, double *qans )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    GAMMA_INC_HALF evaluates P(1/2,X) and Q(1/2,X) from the error function.
+//
+{
+  int K2 = 0;
+  double T6;
+
+  T6 = sqrt ( x );
+  if ( x < 0.25e0 )
+  {
+    *ans = error_f ( &T6 );
+    *qans = 0.5e0 + ( 0.5e0 - *ans );
+    return;
+  }
+  *qans = error_fc ( &K2, &T6 );
+  *ans = 0.5e0 + ( 0.5e0 - *qans );
+  return;
+}
+//****************************************************************************80
+
+static inline void gamma_inc_finite ( double a, double x, double *ans,
+  double *qans )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    GAMMA_INC_FINITE sums the finite series for Q(A,X), 2*A an integer.
+//
+{
+  int K2 = 0;
+  double c,rtx,sum,t;
+  long i,n;
+
+  i = fifidint ( a + a ) / 2;
+  if ( a == ( double ) i )
+  {
+    sum = exp ( -x );
+    t = sum;
+    n = 1;
+    c = 0.0e0;
+  }
+  else
+  {
+    rtx = sqrt ( x );
+    sum = error_fc ( &K2, &rtx );
+    t = exp ( -x ) / ( gi_rtpi * rtx );
+    n = 0;
+    c = -0.5e0;
+  }
+  while ( n != i )
+  {
+    n += 1;
+    c += 1.0e0;
+    t = x * t / c;
+    sum += t;
+  }
+  *qans = sum;
+  *ans = 0.5e0 + ( 0.5e0 - *qans );
+  return;
+}
+//****************************************************************************80
+
+static inline void gamma_inc_taylor ( double a, double x, double r, double acc,
+  double *ans, double *qans )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    GAMMA_INC_TAYLOR sums the Taylor series for P(A,X)/R.
+//
+{
+  double apn,sum,t,tol;
+  double wk[20];
+  int m,max,n;
+
+  apn = a + 1.0e0;
+  t = x / apn;
+  wk[0] = t;
+  for ( n = 2; n <= 20; n++ )
+  {
+    apn += 1.0e0;
+    t *= ( x / apn );
+    if ( t <= 1.e-3 )
+    {
+      break;
+    }
+    wk[n-1] = t;
+  }
+  if ( 20 < n )
+  {
+    n = 20;
+  }
+  sum = t;
+  tol = 0.5e0 * acc;
+  do
+  {
+    apn += 1.0e0;
+    t *= ( x / apn );
+    sum += t;
+  } while ( t > tol );
+  max = n - 1;
+  for ( m = 1; m <= max; m++ )
+  {
+    n -= 1;
+    sum += wk[n-1];
+  }
+  *ans = r / a * ( 1.0e0 + sum );
+  *qans = 0.5e0 + ( 0.5e0 - *ans );
+  return;
+}
+//****************************************************************************80
+
+static inline void gamma_inc_asymp ( double a, double x, double r, double acc,
+  double *ans, double *qans )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    GAMMA_INC_ASYMP sums the asymptotic expansion for Q(A,X)/R.
+//
+{
+  double amn,sum,t;
+  double wk[20];
+  int m,max,n;
+
+  amn = a - 1.0e0;
+  t = amn / x;
+  wk[0] = t;
+  for ( n = 2; n <= 20; n++ )
+  {
+    amn -= 1.0e0;
+    t *= ( amn / x );
+    if ( fabs ( t ) <= 1.e-3 )
+    {
+      break;
+    }
+    wk[n-1] = t;
+  }
+  if ( 20 < n )
+  {
+    n = 20;
+  }
+  sum = t;
+  while ( fabs ( t ) > acc )
+  {
+    amn -= 1.0e0;
+    t *= ( amn / x );
+    sum += t;
+  }
+  max = n - 1;
+  for ( m = 1; m <= max; m++ )
+  {
+    n -= 1;
+    sum += wk[n-1];
+  }
+  *qans = r / x * ( 1.0e0 + sum );
+  *ans = 0.5e0 + ( 0.5e0 - *qans );
+  return;
+}
+//****************************************************************************80
+
+static inline void gamma_inc_cfrac ( double a, double x, double r, double tol,
+  double *ans, double *qans )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    GAMMA_INC_CFRAC evaluates the continued fraction for Q(A,X)/R.
+//
+{
+  double a2n,a2nm1,am0,an0,b2n,b2nm1,c,cma;
+
+  a2nm1 = a2n = 1.0e0;
+  b2nm1 = x;
+  b2n = x + ( 1.0e0 - a );
+  c = 1.0e0;
+  do
+  {
+    a2nm1 = x * a2n + c * a2nm1;
+    b2nm1 = x * b2n + c * b2nm1;
+    am0 = a2nm1 / b2nm1;
+    c += 1.0e0;
+    cma = c - a;
+    a2n = a2nm1 + cma * a2n;
+    b2n = b2nm1 + cma * b2n;
+    an0 = a2n / b2n;
+  } while ( fabs ( an0 - am0 ) >= tol * an0 );
+  *qans = r * an0;
+  *ans = 0.5e0 + ( 0.5e0 - *qans );
+  return;
+}
+//****************************************************************************80
+
+static inline void gamma_inc_temme ( double a, double x, double z, int iop,
+  double e, double *ans, double *qans )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    GAMMA_INC_TEMME evaluates the general Temme expansion, A >= BIG.
+//
+//  Discussion:
+//
+//    Z is RLOG(X/A), as left by GAMMA_INC_BRANCH.  When the result is
+//    indeterminate, ANS is set to 2 and QANS is left alone, as in
+//    GAMMA_INC.
+//
+{
+  int K1 = 1;
+  double c,c0,c1,c2,c3,c4,c5,c6,l,rta,s,t,T3,u,w,y;
+  const double *d0 = gi_d0;
+  const double *d1 = gi_d1;
+  const double *d2 = gi_d2;
+  const double *d3 = gi_d3;
+  const double *d4 = gi_d4;
+  const double *d5 = gi_d5;
+  const double *d6 = gi_d6;
+
+  l = x / a;
+  s = 0.5e0 + ( 0.5e0 - l );
+  y = a * z;
+  rta = sqrt ( a );
+  if ( fabs ( s ) <= 2.0e0 * e && a * e * e > 3.28e-3 )
+  {
+    *ans = 2.0e0;
+    return;
+  }
+  c = exp ( -y );
+  T3 = sqrt ( y );
+  w = 0.5e0 * error_fc ( &K1, &T3 );
+  u = 1.0e0 / a;
+  z = sqrt ( z + z );
+  if ( l < 1.0e0 )
+  {
+    z = -z;
+  }
+  if ( iop == 1 && fabs ( s ) <= 1.e-3 )
+  {
+    c0 = ((((((d0[6]*z+d0[5])*z+d0[4])*z+d0[3])*z+d0[2])*z+d0[1])*z+d0[0])*z-
+      gi_third;
+    c1 = (((((d1[5]*z+d1[4])*z+d1[3])*z+d1[2])*z+d1[1])*z+d1[0])*z+gi_d10;
+    c2 = ((((d2[4]*z+d2[3])*z+d2[2])*z+d2[1])*z+d2[0])*z+gi_d20;
+    c3 = (((d3[3]*z+d3[2])*z+d3[1])*z+d3[0])*z+gi_d30;
+    c4 = (d4[1]*z+d4[0])*z+gi_d40;
+    c5 = (d5[1]*z+d5[0])*z+gi_d50;
+    c6 = d6[0]*z+gi_d60;
+    t = ((((((gi_d70*u+c6)*u+c5)*u+c4)*u+c3)*u+c2)*u+c1)*u+c0;
+  }
+  else if ( iop == 1 )
+  {
+    c0 = ((((((((((((d0[12]*z+d0[11])*z+d0[10])*z+d0[9])*z+d0[8])*z+d0[7])*z+d0[
+      6])*z+d0[5])*z+d0[4])*z+d0[3])*z+d0[2])*z+d0[1])*z+d0[0])*z-gi_third;
+    c1 = (((((((((((d1[11]*z+d1[10])*z+d1[9])*z+d1[8])*z+d1[7])*z+d1[6])*z+d1[5]
+      )*z+d1[4])*z+d1[3])*z+d1[2])*z+d1[1])*z+d1[0])*z+gi_d10;
+    c2 = (((((((((d2[9]*z+d2[8])*z+d2[7])*z+d2[6])*z+d2[5])*z+d2[4])*z+d2[3])*z+
+      d2[2])*z+d2[1])*z+d2[0])*z+gi_d20;
+    c3 = (((((((d3[7]*z+d3[6])*z+d3[5])*z+d3[4])*z+d3[3])*z+d3[2])*z+d3[1])*z+
+      d3[0])*z+gi_d30;
+    c4 = (((((d4[5]*z+d4[4])*z+d4[3])*z+d4[2])*z+d4[1])*z+d4[0])*z+gi_d40;
+    c5 = (((d5[3]*z+d5[2])*z+d5[1])*z+d5[0])*z+gi_d50;
+    c6 = (d6[1]*z+d6[0])*z+gi_d60;
+    t = ((((((gi_d70*u+c6)*u+c5)*u+c4)*u+c3)*u+c2)*u+c1)*u+c0;
+  }
+  else if ( iop == 2 )
+  {
+    c0 = (((((d0[5]*z+d0[4])*z+d0[3])*z+d0[2])*z+d0[1])*z+d0[0])*z-gi_third;
+    c1 = (((d1[3]*z+d1[2])*z+d1[1])*z+d1[0])*z+gi_d10;
+    c2 = d2[0]*z+gi_d20;
+    t = (c2*u+c1)*u+c0;
+  }
+  else
+  {
+    t = ((d0[2]*z+d0[1])*z+d0[0])*z-gi_third;
+  }
+  if ( l < 1.0e0 )
+  {
+    *ans = c * ( w - gi_rt2pin * t / rta );
+    *qans = 0.5e0 + ( 0.5e0 - *ans );
+    return;
+  }
+  *qans = c * ( w + gi_rt2pin * t / rta );
+  *ans = 0.5e0 + ( 0.5e0 - *qans );
+  return;
+}
+//****************************************************************************80
+
+static inline void gamma_inc_temme1 ( double a, double x, double z, int iop,
+  double e, double *ans, double *qans )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    GAMMA_INC_TEMME1 evaluates the Temme expansion for X/A near 1.
+//
+//  Discussion:
+//
+//    Z is RLOG(X/A), as left by GAMMA_INC_BRANCH.  When the result is
+//    indeterminate, ANS is set to 2 and QANS is left alone, as in
+//    GAMMA_INC.
+//
+{
+  double c,c0,c1,c2,c3,c4,c5,c6,l,rta,t,u,w,y;
+  const double *d0 = gi_d0;
+  const double *d1 = gi_d1;
+  const double *d2 = gi_d2;
+  const double *d3 = gi_d3;
+  const double *d4 = gi_d4;
+  const double *d5 = gi_d5;
+  const double *d6 = gi_d6;
+
+  l = x / a;
+  y = a * z;
+  rta = sqrt ( a );
+  if ( a * e * e > 3.28e-3 )
+  {
+    *ans = 2.0e0;
+    return;
+  }
+  c = 0.5e0 + ( 0.5e0 - y );
+  w = ( 0.5e0 - sqrt ( y ) * ( 0.5e0 + ( 0.5e0 - y / 3.0e0 ) ) / gi_rtpi ) / c;
+  u = 1.0e0 / a;
+  z = sqrt ( z + z );
+  if ( l < 1.0e0 )
+  {
+    z = -z;
+  }
+  if ( iop == 1 )
+  {
+    c0 = ((((((d0[6]*z+d0[5])*z+d0[4])*z+d0[3])*z+d0[2])*z+d0[1])*z+d0[0])*z-
+      gi_third;
+    c1 = (((((d1[5]*z+d1[4])*z+d1[3])*z+d1[2])*z+d1[1])*z+d1[0])*z+gi_d10;
+    c2 = ((((d2[4]*z+d2[3])*z+d2[2])*z+d2[1])*z+d2[0])*z+gi_d20;
+    c3 = (((d3[3]*z+d3[2])*z+d3[1])*z+d3[0])*z+gi_d30;
+    c4 = (d4[1]*z+d4[0])*z+gi_d40;
+    c5 = (d5[1]*z+d5[0])*z+gi_d50;
+    c6 = d6[0]*z+gi_d60;
+    t = ((((((gi_d70*u+c6)*u+c5)*u+c4)*u+c3)*u+c2)*u+c1)*u+c0;
+  }
+  else if ( iop == 2 )
+  {
+    c0 = (d0[1]*z+d0[0])*z-gi_third;
+    c1 = d1[0]*z+gi_d10;
+    t = (gi_d20*u+c1)*u+c0;
+  }
+  else
+  {
+    t = d0[0]*z-gi_third;
+  }
+  if ( l < 1.0e0 )
+  {
+    *ans = c * ( w - gi_rt2pin * t / rta );
+    *qans = 0.5e0 + ( 0.5e0 - *ans );
+    return;
+  }
+  *qans = c * ( w + gi_rt2pin * t / rta );
+  *ans = 0.5e0 + ( 0.5e0 - *qans );
+  return;
+}
+
+# endif
@@ -0,0 +1,137 @@
+# include <iomanip>
+# include <cmath>
+using namespace std;
+# include "cdflib.hpp"
+
+//****************************************************************************80
+
+void gamma_inc_log ( double *a, double *x, double *lans, double *lqans,
+  int *ind )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    GAMMA_INC_LOG evaluates the logs of the incomplete gamma ratios.
+//
+//  Discussion:
+//
+//    GAMMA_INC loses a tail probability once it falls below the smallest
+//    positive number.  If both of its results are above 1.0E-250, their
+//    logs are returned.  Otherwise the log of the small tail is computed
+//    as the log of
+//
+//      R = X**A * EXP(-X) / GAMMA(A),
+//
+//    from GAMMA_LPDF, which keeps the Stirling form for large A, plus the
+//    log of a factor that never underflows: the series
+//
+//      P(A,X) = R/A * sum ( 0 <= N ) X**N / ((A+1)*...*(A+N))
+//
+//    for the lower tail, which is small only if X < A, and Legendre's
+//    continued fraction for Q(A,X)/R, evaluated by Lentz's method, for
+//    the upper tail, which is small only if A+1 < X.  The log of the
+//    other tail is then minus the small one.
+//
+//  Parameters:
+//
+//    Input, double *A, *X, the arguments of the incomplete gamma ratio.
+//    Both should be nonnegative, and not both 0.
+//
+//    Output, double *LANS, *LQANS, the logs of P(A,X) and Q(A,X).
+//    If GAMMA_INC reports an error, LANS is set to 2.
+//
+//    Input, int *IND, the accuracy request, as for GAMMA_INC.
+//
+{
+# define cut (1.0e-250)
+# define maxit 10000000
+
+  double an;
+  double b;
+  double c;
+  double d;
+  double del;
+  double eps;
+  double h;
+  int i;
+  double lr;
+  gamma_pdf_norm nrm;
+  double p;
+  double q;
+  double sum;
+  double t;
+
+  gamma_inc ( a, x, &p, &q, ind );
+  if ( p == 2.0e0 )
+  {
+    *lans = 2.0e0;
+    return;
+  }
+  if ( cut <= p && cut <= q )
+  {
+    *lans = log ( p );
+    *lqans = log ( q );
+    return;
+  }
+  if ( *x <= 0.0e0 || *a <= 0.0e0 )
+  {
+    *lans = log ( p );
+    *lqans = log ( q );
+    return;
+  }
+  eps = fifdmax1 ( dpmpar_eps, ( *ind == 0 ) ? 0.0e0 : 1.0e-7 );
+  gamma_pdf_init ( a, &nrm );
+  lr = gamma_lpdf ( x, &nrm ) + log ( *x );
+
+  if ( p < q )
+  {
+    sum = 1.0e0;
+    t = 1.0e0;
+    for ( i = 1; i <= maxit; i++ )
+    {
+      t = t * *x / ( *a + ( double ) i );
+      sum = sum + t;
+      if ( t <= eps * sum )
+      {
+        break;
+      }
+    }
+    *lans = lr + log ( sum / *a );
+    *lqans = - exp ( *lans );
+  }
+  else
+  {
+    b = *x + 1.0e0 - *a;
+    c = 1.0e0 / dpmpar_tiny;
+    d = 1.0e0 / b;
+    h = d;
+    for ( i = 1; i <= maxit; i++ )
+    {
+      an = - ( double ) i * ( ( double ) i - *a );
+      b = b + 2.0e0;
+      d = an * d + b;
+      if ( fabs ( d ) < dpmpar_tiny )
+      {
+        d = dpmpar_tiny;
+      }
+      c = b + an / c;
+      if ( fabs ( c ) < dpmpar_tiny )
+      {
+        c = dpmpar_tiny;
+      }
+      d = 1.0e0 / d;
+      del = d * c;
+      h = h * del;
+      if ( fabs ( del - 1.0e0 ) <= eps )
+      {
+        break;
+      }
+    }
+    *lqans = lr + log ( h );
+    *lans = - exp ( *lqans );
+  }
+  return;
+# undef cut
+# undef maxit
+}
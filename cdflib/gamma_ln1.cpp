@@ -20,31 +20,31 @@ double gamma_ln1 ( double *a )
 //    Output, double GAMMA_LN1, the value of ln ( Gamma ( 1 + A ) ).
 //
 {
-  static double p0 = .577215664901533e+00;
-  static double p1 = .844203922187225e+00;
-  static double p2 = -.168860593646662e+00;
-  static double p3 = -.780427615533591e+00;
-  static double p4 = -.402055799310489e+00;
-  static double p5 = -.673562214325671e-01;
-  static double p6 = -.271935708322958e-02;
-  static double q1 = .288743195473681e+01;
-  static double q2 = .312755088914843e+01;
-  static double q3 = .156875193295039e+01;
-  static double q4 = .361951990101499e+00;
-  static double q5 = .325038868253937e-01;
-  static double q6 = .667465618796164e-03;
-  static double r0 = .422784335098467e+00;
-  static double r1 = .848044614534529e+00;
-  static double r2 = .565221050691933e+00;
-  static double r3 = .156513060486551e+00;
-  static double r4 = .170502484022650e-01;
-  static double r5 = .497958207639485e-03;
-  static double s1 = .124313399877507e+01;
-  static double s2 = .548042109832463e+00;
-  static double s3 = .101552187439830e+00;
-  static double s4 = .713309612391000e-02;
-  static double s5 = .116165475989616e-03;
-  static double gamln1,w,x;
+  double p0 = .577215664901533e+00;
+  double p1 = .844203922187225e+00;
+  double p2 = -.168860593646662e+00;
+  double p3 = -.780427615533591e+00;
+  double p4 = -.402055799310489e+00;
+  double p5 = -.673562214325671e-01;
+  double p6 = -.271935708322958e-02;
+  double q1 = .288743195473681e+01;
+  double q2 = .312755088914843e+01;
+  double q3 = .156875193295039e+01;
+  double q4 = .361951990101499e+00;
+  double q5 = .325038868253937e-01;
+  double q6 = .667465618796164e-03;
+  double r0 = .422784335098467e+00;
+  double r1 = .848044614534529e+00;
+  double r2 = .565221050691933e+00;
+  double r3 = .156513060486551e+00;
+  double r4 = .170502484022650e-01;
+  double r5 = .497958207639485e-03;
+  double s1 = .124313399877507e+01;
+  double s2 = .548042109832463e+00;
+  double s3 = .101552187439830e+00;
+  double s4 = .713309612391000e-02;
+  double s5 = .116165475989616e-03;
+  double gamln1,w,x;
 
     if(*a >= 0.6e0) goto S10;
     w = ((((((p6**a+p5)**a+p4)**a+p3)**a+p2)**a+p1)**a+p0)/((((((q6**a+q5)**a+
@@ -35,16 +35,16 @@ double gamma_log ( double *a )
 //    Output, double GAMMA_LOG, the value of ln ( Gamma ( A ) ).
 //
 {
-  static double c0 = .833333333333333e-01;
-  static double c1 = -.277777777760991e-02;
-  static double c2 = .793650666825390e-03;
-  static double c3 = -.595202931351870e-03;
-  static double c4 = .837308034031215e-03;
-  static double c5 = -.165322962780713e-02;
-  static double d = .418938533204673e0;
-  static double gamln,t,w;
-  static int i,n;
-  static double T1;
+  double c0 = .833333333333333e-01;
+  double c1 = -.277777777760991e-02;
+  double c2 = .793650666825390e-03;
+  double c3 = -.595202931351870e-03;
+  double c4 = .837308034031215e-03;
+  double c5 = -.165322962780713e-02;
+  double d = .418938533204673e0;
+  double gamln,t,w;
+  int i,n;
+  double T1;
 
     if(*a > 0.8e0) goto S10;
     gamln = gamma_ln1 ( a ) - log ( *a );
@@ -0,0 +1,58 @@
+# include <iomanip>
+# include <cmath>
+using namespace std;
+# include "cdflib.hpp"
+
+//****************************************************************************80
+
+double gamma_lpdf ( double *x, const gamma_pdf_norm *nrm )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    GAMMA_LPDF evaluates the log of the gamma density.
+//
+//  Discussion:
+//
+//    The density is X**(A-1) * exp(-X) / GAMMA(A), for X >= 0.  Outside
+//    its support, the log density is -infinity.  At X = 0 it is +infinity
+//    if A < 1.
+//
+//  Parameters:
+//
+//    Input, double *X, the argument.
+//
+//    Input, const gamma_pdf_norm *NRM, the normalizer for the shape A,
+//    set by GAMMA_PDF_INIT.
+//
+//    Output, double GAMMA_LPDF, the log of the density at X.
+//
+{
+  double a;
+  double u;
+
+  a = nrm->a;
+  if ( *x < 0.0e0 || dpmpar_huge < *x )
+  {
+    return - numeric_limits<double>::infinity ( );
+  }
+  if ( *x == 0.0e0 )
+  {
+    if ( a < 1.0e0 )
+    {
+      return numeric_limits<double>::infinity ( );
+    }
+    if ( a == 1.0e0 )
+    {
+      return nrm->lnc;
+    }
+    return - numeric_limits<double>::infinity ( );
+  }
+  if ( !nrm->big )
+  {
+    return ( a - 1.0e0 ) * log ( *x ) - *x + nrm->lnc;
+  }
+  u = *x / a;
+  return nrm->lnc - a * rlog ( &u ) - log ( *x );
+}
@@ -0,0 +1,59 @@
+# include <iomanip>
+# include <cmath>
+using namespace std;
+# include "cdflib.hpp"
+
+//****************************************************************************80
+
+void gamma_norm_init ( double *a, gamma_norm *nrm )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    GAMMA_NORM_INIT computes the parts of GAMMA_INC that depend on A only.
+//
+//  Discussion:
+//
+//    Depending on A, GAMMA_INC needs GAM1(A) (A < 1), GAMMA_X(A)
+//    (1 <= A < 20), or SQRT(A) and the Stirling correction of the
+//    Temme expansion (10 <= A).  Only those are computed; they are
+//    evaluated exactly as GAMMA_INC would, so that passing NRM to
+//    GAMMA_INC for this A does not change its results.
+//
+//  Parameters:
+//
+//    Input, double *A, the first argument of the incomplete gamma ratio.
+//
+//    Output, gamma_norm *NRM, the precomputed parts.
+//
+{
+  double t;
+
+  nrm->a = *a;
+  nrm->gam1 = 0.0e0;
+  nrm->gamma_x = 1.0e0;
+  nrm->rta = 0.0e0;
+  nrm->stirling = 0.0e0;
+
+  if ( *a <= 0.0e0 )
+  {
+    return;
+  }
+  if ( *a < 1.0e0 )
+  {
+    nrm->gam1 = gam1 ( a );
+  }
+  if ( 1.0e0 <= *a && *a < 20.0e0 )
+  {
+    nrm->gamma_x = gamma_x ( a );
+  }
+  if ( 10.0e0 <= *a )
+  {
+    nrm->rta = sqrt ( *a );
+    t = pow ( 1.0e0 / *a, 2.0 );
+    nrm->stirling = ( ( ( 0.75e0 * t - 1.0e0 ) * t + 3.5e0 ) * t - 105.0e0 )
+      / ( *a * 1260.0e0 );
+  }
+  return;
+}
@@ -0,0 +1,49 @@
+# include <iomanip>
+# include <cmath>
+using namespace std;
+# include "cdflib.hpp"
+
+//****************************************************************************80
+
+void gamma_pdf_init ( double *a, gamma_pdf_norm *nrm )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    GAMMA_PDF_INIT sets up the log-normalizer of the gamma density.
+//
+//  Discussion:
+//
+//    For A < 20 the normalizer is -LN(GAMMA(A)).  For larger A, GAMMA_LPDF
+//    evaluates the density in the form used by RCOMP, exp(-A*RLOG(X/A))
+//    times the Stirling factor SQRT(A/(2*PI))*exp(correction), which does
+//    not lose accuracy to cancellation near the mode; the normalizer is
+//    then the log of the Stirling factor.
+//
+//  Parameters:
+//
+//    Input, double *A, the shape parameter, positive.
+//
+//    Output, gamma_pdf_norm *NRM, the normalizer, for GAMMA_LPDF.
+//
+{
+  double rt2pin = .398942280401433e0;
+  double t;
+
+  nrm->a = *a;
+  if ( *a < 20.0e0 )
+  {
+    nrm->big = 0;
+    nrm->lnc = - gamma_log ( a );
+  }
+  else
+  {
+    nrm->big = 1;
+    t = pow ( 1.0e0 / *a, 2.0 );
+    nrm->lnc = log ( rt2pin ) + 0.5e0 * log ( *a )
+      + ( ( ( 0.75e0 * t - 1.0e0 ) * t + 3.5e0 ) * t - 105.0e0 )
+      / ( *a * 1260.0e0 );
+  }
+  return;
+}
@@ -26,8 +26,8 @@ void gamma_rat1 ( double *a, double *x, double *r, double *p, double *q,
 //    Input, double *EPS, the tolerance.
 //
 {
-  static int K2 = 0;
-  static double a2n,a2nm1,am0,an,an0,b2n,b2nm1,c,cma,g,h,j,l,sum,t,tol,w,z,T1,T3;
+  int K2 = 0;
+  double a2n,a2nm1,am0,an,an0,b2n,b2nm1,c,cma,g,h,j,l,sum,t,tol,w,z,T1,T3;
 
     if(*a**x == 0.0e0) goto S120;
     if(*a == 0.5e0) goto S100;
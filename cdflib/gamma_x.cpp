@@ -31,25 +31,23 @@ double gamma_x ( double *a )
 //    Output, double GAMMA_X, the value of the Gamma function.
 //
 {
-  static double d = .41893853320467274178e0;
-  static double pi = 3.1415926535898e0;
-  static double r1 = .820756370353826e-03;
-  static double r2 = -.595156336428591e-03;
-  static double r3 = .793650663183693e-03;
-  static double r4 = -.277777777770481e-02;
-  static double r5 = .833333333333333e-01;
-  static double p[7] = {
+  double d = .41893853320467274178e0;
+  double pi = 3.1415926535898e0;
+  double r1 = .820756370353826e-03;
+  double r2 = -.595156336428591e-03;
+  double r3 = .793650663183693e-03;
+  double r4 = -.277777777770481e-02;
+  double r5 = .833333333333333e-01;
+  static const double p[7] = {
     .539637273585445e-03,.261939260042690e-02,.204493667594920e-01,
     .730981088720487e-01,.279648642639792e+00,.553413866010467e+00,1.0e0
   };
-  static double q[7] = {
+  static const double q[7] = {
     -.832979206704073e-03,.470059485860584e-02,.225211131035340e-01,
     -.170458969313360e+00,-.567902761974940e-01,.113062953091122e+01,1.0e0
   };
-  static int K2 = 3;
-  static int K3 = 0;
-  static double Xgamm,bot,g,lnx,s,t,top,w,x,z;
-  static int i,j,m,n,T1;
+  double Xgamm,bot,g,lnx,s = 1.0e0,t,top,w,x,z;
+  int i,j,m,n,T1;
 
     Xgamm = 0.0e0;
     x = *a;
@@ -98,7 +96,7 @@ S70:
 //     CODE MAY BE OMITTED IF DESIRED.
 //
     if(fabs(t) >= 1.e-30) goto S80;
-    if(fabs(t)*dpmpar(&K2) <= 1.0001e0) return Xgamm;
+    if(fabs(t)*dpmpar_huge <= 1.0001e0) return Xgamm;
     Xgamm = 1.0e0/t;
     return Xgamm;
 S80:
@@ -153,7 +151,7 @@ S120:
     g = d+g+(z-0.5e0)*(lnx-1.e0);
     w = g;
     t = g-w;
-    if(w > 0.99999e0*exparg(&K3)) return Xgamm;
+    if(w > 0.99999e0*exparg_max) return Xgamm;
     Xgamm = exp(w)*(1.0e0+t);
     if(*a < 0.0e0) Xgamm = 1.0e0/(Xgamm*s)/x;
     return Xgamm;
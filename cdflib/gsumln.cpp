@@ -25,7 +25,7 @@ double gsumln ( double *a, double *b )
 //    Output, double GSUMLN, the value of ln(Gamma(A+B)).
 //
 {
-  static double gsumln,x,T1,T2;
+  double gsumln,x,T1,T2;
 
     x = *a+*b-2.e0;
     if(x > 0.25e0) goto S10;
@@ -65,8 +65,8 @@ int ipmpar ( int *i )
 //    Output, int IPMPAR, the value of the desired constant.
 //
 {
-  static int imach[11];
-  static int ipmpar;
+  int imach[11];
+  int ipmpar;
 //     MACHINE CONSTANTS FOR AMDAHL MACHINES.
 //
 //   imach[1] = 2;
@@ -422,3 +422,25 @@ int ipmpar ( int *i )
     ipmpar = imach[*i];
     return ipmpar;
 }
+# if defined ( CDFLIB_RUNTIME_MACHINE )
+//****************************************************************************80
+
+static int ipmpar_value ( int i )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    IPMPAR_VALUE calls IPMPAR with a value argument.
+//
+//  Discussion:
+//
+//    It initializes the machine constant IPMPAR_INT_MAX when it is not
+//    known at compile time.
+//
+{
+  return ipmpar ( &i );
+}
+
+extern const int ipmpar_int_max = ipmpar_value ( 3 );
+# endif
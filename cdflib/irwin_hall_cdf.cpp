@@ -0,0 +1,370 @@
+# include <iomanip>
+# include <cmath>
+using namespace std;
+# include "cdflib.hpp"
+
+static double irwin_hall_exact ( double y, int n );
+static double irwin_hall_saddle ( double y, int n );
+static void irwin_hall_cgf ( double t, double k[5] );
+
+//****************************************************************************80
+
+void irwin_hall_cdf ( double *x, int *n, double *cum, double *ccum )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    IRWIN_HALL_CDF evaluates the CDF of a sum of uniform variables.
+//
+//  Discussion:
+//
+//    CUM is the probability that the sum of N independent uniform
+//    variables on [0,1] does not exceed X.  It is the Edgington
+//    combination of N p-values whose sum is X.
+//
+//    The textbook formula
+//
+//      CUM = sum ( 0 <= J <= X ) (-1)^J C(N,J) (X-J)^N / N!
+//
+//    loses all accuracy to cancellation once N exceeds a few dozen.
+//    Instead, the smaller tail is evaluated with the recursion
+//
+//      F(N,Y) = ( Y * F(N-1,Y) + (N-Y) * F(N-1,Y-1) ) / N,
+//
+//    all of whose terms are positive for 0 <= Y <= N, so that the result
+//    has a relative error of a few times N units in the last place.  It
+//    costs of order N * min ( X, N - X ) operations.  When this exceeds
+//    2*10^6, which only happens for N above 2000, an Edgeworth series is
+//    used near the mean and a second order saddle point approximation
+//    further out, at a constant cost.  Their relative error there is
+//    below 10^-9 and decreases like 1/N^2.
+//
+//    The recursion is thus the expensive branch: near the mean it takes
+//    about half a millisecond at N = 1000 and up to a few milliseconds
+//    just below the switch.  The switch is not lower because the
+//    approximations are not accurate enough there: their largest
+//    relative error is 5*10^-7 at N = 500, 4*10^-8 at N = 1000 and
+//    6*10^-10 at N = 2000.  An Edgington combination makes one call, for
+//    which this is negligible; a caller that evaluates the CDF many times
+//    for N in the thousands pays it on every call.
+//
+//  Reference:
+//
+//    Henry Daniels,
+//    Tail probability approximations,
+//    International Statistical Review,
+//    Volume 55, 1987, pages 37-48.
+//
+//    Robert Lugannani, Stephen Rice,
+//    Saddle point approximation for the distribution of the sum of
+//    independent random variables,
+//    Advances in Applied Probability,
+//    Volume 12, 1980, pages 475-490.
+//
+//  Parameters:
+//
+//    Input, double *X, the value of the sum.
+//
+//    Input, int *N, the number of uniform variables.
+//
+//    Output, double *CUM, *CCUM, the CDF and complementary CDF.
+//
+{
+  double half;
+  double tail;
+  double y;
+
+  if ( *n <= 0 )
+  {
+    *cum = ( 0.0 <= *x ) ? 1.0 : 0.0;
+    *ccum = 1.0 - *cum;
+    return;
+  }
+  if ( *x <= 0.0 )
+  {
+    *cum = 0.0;
+    *ccum = 1.0;
+    return;
+  }
+  if ( ( double ) *n <= *x )
+  {
+    *cum = 1.0;
+    *ccum = 0.0;
+    return;
+  }
+
+  half = 0.5 * ( double ) *n;
+  y = ( *x <= half ) ? *x : ( double ) *n - *x;
+
+  if ( ( double ) *n * y <= 2.0E+06 )
+  {
+    tail = irwin_hall_exact ( y, *n );
+  }
+  else
+  {
+    tail = irwin_hall_saddle ( y, *n );
+  }
+
+  if ( *x <= half )
+  {
+    *cum = tail;
+    *ccum = 0.5 + ( 0.5 - tail );
+  }
+  else
+  {
+    *ccum = tail;
+    *cum = 0.5 + ( 0.5 - tail );
+  }
+  return;
+}
+//****************************************************************************80
+
+static double irwin_hall_exact ( double y, int n )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    IRWIN_HALL_EXACT evaluates the Irwin-Hall CDF by recursion on N.
+//
+//  Discussion:
+//
+//    F[M] holds F(K,Y-M) for M = 0, ..., MMAX, and F(K,Y-M-1) = 0
+//    beyond the last entry.  Entries with K <= Y-M are 1 and stay so.
+//    F[0] is the largest entry; when it gets small, all entries are
+//    scaled up by a power of two to keep the deep lower tail from
+//    underflowing before the end.  Trailing entries that fall below
+//    10^-80 of F[0] can no longer affect it and are dropped.
+//
+//  Parameters:
+//
+//    Input, double Y, the value of the sum, with 0 < Y <= N/2.
+//
+//    Input, int N, the number of uniform variables.
+//
+//    Output, double IRWIN_HALL_EXACT, the CDF.
+//
+{
+  double *f;
+  int k;
+  int m;
+  int m0;
+  int mmax;
+  double rk;
+  int scale;
+  double value;
+  double ym;
+
+  mmax = ( int ) y;
+  f = new double[mmax+2];
+  for ( m = 0; m <= mmax; m++ )
+  {
+    f[m] = 1.0;
+  }
+  f[mmax+1] = 0.0;
+  scale = 0;
+
+  for ( k = 1; k <= n; k++ )
+  {
+    rk = 1.0 / ( double ) k;
+    m0 = ( ( double ) k <= y ) ? ( int ) ( y - ( double ) k ) + 1 : 0;
+    for ( m = m0; m <= mmax; m++ )
+    {
+      ym = y - ( double ) m;
+      f[m] = ( ym * f[m] + ( ( double ) k - ym ) * f[m+1] ) * rk;
+    }
+    if ( f[0] < 1.0E-200 )
+    {
+      for ( m = 0; m <= mmax; m++ )
+      {
+        f[m] = ldexp ( f[m], 600 );
+      }
+      scale = scale + 600;
+    }
+    while ( 0 < mmax && f[mmax] < 1.0E-280 )
+    {
+      f[mmax] = 0.0;
+      mmax = mmax - 1;
+    }
+  }
+  value = ldexp ( f[0], -scale );
+
+  delete [] f;
+  return value;
+}
+//****************************************************************************80
+
+static void irwin_hall_cgf ( double t, double k[5] )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    IRWIN_HALL_CGF evaluates the cumulant generating function of U(0,1).
+//
+//  Discussion:
+//
+//    K(T) = log ( ( exp(T) - 1 ) / T ).  With H = 1 / ( exp(T) - 1 ),
+//
+//      K'(T)    = 1 + H - 1/T,
+//      K''(T)   = - H (1+H) + 1/T^2,
+//      K'''(T)  = H (1+H) (1+2H) - 2/T^3,
+//      K''''(T) = - H (1+H) (1+6H+6H^2) + 6/T^4.
+//
+//    For |T| < 0.1 the power series about 0 are used instead.
+//
+//  Parameters:
+//
+//    Input, double T, the argument.
+//
+//    Output, double K[5], K(T) and its first four derivatives.
+//
+{
+  double h;
+  double h1;
+  double t2;
+
+  t2 = t * t;
+  if ( fabs ( t ) < 0.1 )
+  {
+    k[0] = t * ( 0.5 + t * ( 1.0 / 24.0 + t2 * ( -1.0 / 2880.0
+      + t2 * ( 1.0 / 181440.0 - t2 / 9676800.0 ) ) ) );
+    k[1] = 0.5 + t * ( 1.0 / 12.0 + t2 * ( -1.0 / 720.0
+      + t2 * ( 1.0 / 30240.0 - t2 / 1209600.0 ) ) );
+    k[2] = 1.0 / 12.0 + t2 * ( -1.0 / 240.0
+      + t2 * ( 1.0 / 6048.0 - t2 / 172800.0 ) );
+    k[3] = t * ( -1.0 / 120.0 + t2 * ( 1.0 / 1512.0 - t2 / 28800.0 ) );
+    k[4] = -1.0 / 120.0 + t2 * ( 1.0 / 504.0 - t2 / 5760.0 );
+    return;
+  }
+  h = 1.0 / expm1 ( t );
+  h1 = exp ( t ) * h;
+  k[0] = -log ( h * t );
+  k[1] = h1 - 1.0 / t;
+  k[2] = - h * h1 + 1.0 / t2;
+  k[3] = h * h1 * ( 1.0 + 2.0 * h ) - 2.0 / ( t2 * t );
+  k[4] = - h * h1 * ( 1.0 + 6.0 * h * h1 ) + 6.0 / ( t2 * t2 );
+  return;
+}
+//****************************************************************************80
+
+static double irwin_hall_saddle ( double y, int n )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    IRWIN_HALL_SADDLE approximates the Irwin-Hall CDF for large N.
+//
+//  Discussion:
+//
+//    Within two standard deviations of the mean N/2, the Edgeworth series
+//    in the standardized cumulants L4 = -6/(5N), L6 = 48/(7N^2) is used,
+//
+//      PHI(Z) - phi(Z) * ( L4/24 He3(Z) + L6/720 He5(Z) + L4^2/1152 He7(Z) ).
+//
+//    Further out, the saddle point T solves N * K'(T) = Y, and with
+//
+//      W = sign(T) * sqrt ( 2 * ( T * Y - N * K(T) ) ),
+//      U = T * sqrt ( N * K''(T) ),
+//
+//    the CDF is PHI(W) + phi(W) * ( 1/W - 1/U - C ), where C is the
+//    second order correction of Daniels in the standardized cumulants
+//    L3 and L4 at T.
+//
+//  Reference:
+//
+//    Henry Daniels,
+//    Tail probability approximations,
+//    International Statistical Review,
+//    Volume 55, 1987, pages 37-48.
+//
+//  Parameters:
+//
+//    Input, double Y, the value of the sum, with 0 < Y <= N/2.
+//
+//    Input, int N, the number of uniform variables.
+//
+//    Output, double IRWIN_HALL_SADDLE, the CDF.
+//
+{
+  double c;
+  double ccum;
+  double cum;
+  double hi;
+  int it;
+  double k[5];
+  double l3;
+  double l4;
+  double l6;
+  double lo;
+  double mean;
+  double pdf;
+  double rn;
+  double t;
+  double tnew;
+  double u;
+  double w;
+  double z;
+  double z2;
+
+  rn = ( double ) n;
+  mean = y / rn;
+  z = ( y - 0.5 * rn ) / sqrt ( rn / 12.0 );
+
+  if ( -2.0 <= z )
+  {
+    l4 = -1.2 / rn;
+    l6 = 48.0 / ( 7.0 * rn * rn );
+    z2 = z * z;
+    cumnor ( &z, &cum, &ccum );
+    pdf = exp ( -0.5 * z2 ) / sqrt ( 2.0 * M_PI );
+    return cum - pdf * z * ( l4 / 24.0 * ( z2 - 3.0 )
+      + l6 / 720.0 * ( ( z2 - 10.0 ) * z2 + 15.0 )
+      + l4 * l4 / 1152.0 * ( ( ( z2 - 21.0 ) * z2 + 105.0 ) * z2 - 105.0 ) );
+  }
+//
+//  Solve K'(T) = Y/N for T < 0 by safeguarded Newton iteration.
+//  K' increases from 0 to 1/2 on (-Inf,0), and K'(-1/MEAN) < MEAN.
+//
+  lo = -1.0 / mean;
+  hi = 0.0;
+  t = ( mean < 0.25 ) ? 1.0 - 1.0 / mean : 12.0 * ( mean - 0.5 );
+
+  for ( it = 0; it < 100; it++ )
+  {
+    irwin_hall_cgf ( t, k );
+    if ( k[1] < mean )
+    {
+      lo = t;
+    }
+    else
+    {
+      hi = t;
+    }
+    tnew = t - ( k[1] - mean ) / k[2];
+    if ( tnew <= lo || hi <= tnew )
+    {
+      tnew = 0.5 * ( lo + hi );
+    }
+    if ( fabs ( tnew - t ) <= 1.0E-15 * fabs ( t ) )
+    {
+      t = tnew;
+      break;
+    }
+    t = tnew;
+  }
+  irwin_hall_cgf ( t, k );
+
+  w = -sqrt ( fmax ( 2.0 * ( t * y - rn * k[0] ), 0.0 ) );
+  u = t * sqrt ( rn * k[2] );
+  l3 = k[3] / ( sqrt ( rn ) * k[2] * sqrt ( k[2] ) );
+  l4 = k[4] / ( rn * k[2] * k[2] );
+  c = ( l4 / 8.0 - 5.0 * l3 * l3 / 24.0 ) / u - l3 / ( 2.0 * u * u )
+    - 1.0 / ( u * u * u ) + 1.0 / ( w * w * w );
+
+  cumnor ( &w, &cum, &ccum );
+  pdf = exp ( -0.5 * w * w ) / sqrt ( 2.0 * M_PI );
+  return cum + pdf * ( 1.0 / w - 1.0 / u - c );
+}
@@ -0,0 +1,84 @@
+//****************************************************************************80
+
+void irwin_hall_cdf_values ( int *n_data, int *n, double *x, double *fx )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    IRWIN_HALL_CDF_VALUES returns some values of the Irwin-Hall CDF.
+//
+//  Discussion:
+//
+//    FX is the probability that the sum of N independent uniform
+//    variables on [0,1] does not exceed X.  The values were computed
+//    in exact rational arithmetic from
+//
+//      FX = sum ( 0 <= J <= X ) (-1)^J C(N,J) (X-J)^N / N!
+//
+//    and rounded to double precision.
+//
+//  Parameters:
+//
+//    Input/output, int *N_DATA.  The user sets N_DATA to 0 before the
+//    first call.  On each call, the routine increments N_DATA by 1, and
+//    returns the corresponding data; when there is no more data, the
+//    output value of N_DATA will be 0 again.
+//
+//    Output, int *N, the number of uniform variables.
+//
+//    Output, double *X, the argument of the function.
+//
+//    Output, double *FX, the value of the function.
+//
+{
+# define N_MAX 26
+
+  double fx_vec[N_MAX] = {
+    2.604166666666667E-04, 3.534667968750000E-01, 2.755731922398589E-07,
+    2.945186785877907E-01, 7.054813214122093E-01, 4.309898205829711E-13,
+    2.206783440063577E-01, 2.918201760308479E-30, 7.004911601512189E-03,
+    4.035272916251907E-01, 1.068665287290898E-58, 2.506562300983024E-04,
+    3.647048635959120E-01, 1.138862181631566E-37, 7.116322441942330E-03,
+    5.408877823027259E-180, 2.071309558718461E-08, 1.366824327576532E-01,
+    4.249339451493205E-123, 9.712081681077290E-04, 3.180565373755391E-304,
+    2.109228274893053E-134, 4.512630726932194E-01, 1.050495077852100E-67,
+    2.658486082697989E-04, 3.645191189448479E-01 };
+  int n_vec[N_MAX] = {
+    5, 5, 10, 10, 10, 20,
+    20, 50, 50, 50, 100, 100,
+    100, 200, 200, 1000, 1000, 1000,
+    2000, 2000, 5000, 5000, 5000, 10000,
+    10000, 10000 };
+  double x_vec[N_MAX] = {
+    0.5, 2.25, 1.0, 4.5, 5.5,
+    2.0, 9.0, 5.0, 20.0, 24.5,
+    10.0, 40.0, 49.0, 50.0, 90.0,
+    250.0, 450.0, 490.0, 700.0, 960.0,
+    1750.0, 2000.0, 2497.5, 4500.0, 4900.0,
+    4990.0 };
+
+  if ( *n_data < 0 )
+  {
+    *n_data = 0;
+  }
+
+  *n_data = *n_data + 1;
+
+  if ( N_MAX < *n_data )
+  {
+    *n_data = 0;
+    *n = 0;
+    *x = 0.0E+00;
+    *fx = 0.0E+00;
+  }
+  else
+  {
+    *n = n_vec[*n_data-1];
+    *x = x_vec[*n_data-1];
+    *fx = fx_vec[*n_data-1];
+  }
+
+  return;
+# undef N_MAX
+}
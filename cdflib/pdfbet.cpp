@@ -0,0 +1,114 @@
+# include <iomanip>
+# include <cmath>
+using namespace std;
+# include "cdflib.hpp"
+
+//****************************************************************************80
+
+double logpdfbet ( double *x, double *y, double *a, double *b )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    LOGPDFBET evaluates the log of the beta density.
+//
+//  Parameters:
+//
+//    Input, double *X, *Y, the argument and 1 - X.
+//
+//    Input, double *A, *B, the parameters, positive.
+//
+//    Output, double LOGPDFBET, the log of the density.
+//
+{
+  beta_pdf_norm nrm;
+
+  beta_pdf_init ( a, b, &nrm );
+  return beta_lpdf ( x, y, &nrm );
+}
+//****************************************************************************80
+
+double pdfbet ( double *x, double *y, double *a, double *b )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    PDFBET evaluates the beta density.
+//
+//  Parameters:
+//
+//    The parameters are as for LOGPDFBET.
+//
+//    Output, double PDFBET, the density.
+//
+{
+  return exp ( logpdfbet ( x, y, a, b ) );
+}
+//****************************************************************************80
+
+void logpdfbet_batch ( const double *x, const double *y, size_t n, double *a, double *b, double *fx )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    LOGPDFBET_BATCH evaluates the log of the beta density
+//    for an array.
+//
+//  Discussion:
+//
+//    The normalizer is computed once, by BETA_PDF_INIT.
+//
+//  Parameters:
+//
+//    Input, const double *X, *Y, the arguments and 1 - X.
+//
+//    Input, size_t N, the number of values.
+//
+//    Input, double *A, *B, the parameters, positive.
+//
+//    Output, double *FX, the log of the density at each value.
+//
+{
+  beta_pdf_norm nrm;
+  double xi;
+  double yi;
+  size_t i;
+
+  beta_pdf_init ( a, b, &nrm );
+  for ( i = 0; i < n; i++ )
+  {
+    xi = x[i];
+    yi = y[i];
+    fx[i] = beta_lpdf ( &xi, &yi, &nrm );
+  }
+  return;
+}
+//****************************************************************************80
+
+void pdfbet_batch ( const double *x, const double *y, size_t n, double *a, double *b, double *fx )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    PDFBET_BATCH evaluates the beta density for an array.
+//
+//  Parameters:
+//
+//    The parameters are as for LOGPDFBET_BATCH.
+//
+//    Output, double *FX, the density at each value.
+//
+{
+  size_t i;
+
+  logpdfbet_batch ( x, y, n, a, b, fx );
+  for ( i = 0; i < n; i++ )
+  {
+    fx[i] = exp ( fx[i] );
+  }
+  return;
+}
@@ -0,0 +1,126 @@
+# include <iomanip>
+# include <cmath>
+using namespace std;
+# include "cdflib.hpp"
+
+//****************************************************************************80
+
+double logpdfbin ( double *s, double *xn, double *pr, double *ompr )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    LOGPDFBIN evaluates the log of the binomial density.
+//
+//  Discussion:
+//
+//    The probability of S successes is the beta density of parameters
+//    S+1 and XN-S+1 at PR, divided by XN+1.
+//
+//  Parameters:
+//
+//    Input, double *S, the number of successes, an integer between 0
+//    and XN.
+//
+//    Input, double *XN, the number of trials.
+//
+//    Input, double *PR, *OMPR, the probability of success in each trial,
+//    and 1 - PR.
+//
+//    Output, double LOGPDFBIN, the log of the density.
+//
+{
+  double a;
+  double b;
+  beta_pdf_norm nrm;
+
+  if ( *s < 0.0e0 || *xn < *s )
+  {
+    return - numeric_limits<double>::infinity ( );
+  }
+  a = *s + 1.0e0;
+  b = *xn - *s + 1.0e0;
+  beta_pdf_init ( &a, &b, &nrm );
+  return beta_lpdf ( pr, ompr, &nrm ) - log ( *xn + 1.0e0 );
+}
+//****************************************************************************80
+
+double pdfbin ( double *s, double *xn, double *pr, double *ompr )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    PDFBIN evaluates the binomial density.
+//
+//  Parameters:
+//
+//    The parameters are as for LOGPDFBIN.
+//
+//    Output, double PDFBIN, the density.
+//
+{
+  return exp ( logpdfbin ( s, xn, pr, ompr ) );
+}
+//****************************************************************************80
+
+void logpdfbin_batch ( const double *s, size_t n, double *xn, double *pr, double *ompr, double *fx )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    LOGPDFBIN_BATCH evaluates the log of the binomial density
+//    for an array.
+//
+//  Parameters:
+//
+//    Input, const double *S, the numbers of successes.
+//
+//    Input, size_t N, the number of values.
+//
+//    Input, double *XN, the number of trials.
+//
+//    Input, double *PR, *OMPR, the probability of success in each trial,
+//    and 1 - PR.
+//
+//    Output, double *FX, the log of the density at each value.
+//
+{
+  double si;
+  size_t i;
+
+  for ( i = 0; i < n; i++ )
+  {
+    si = s[i];
+    fx[i] = logpdfbin ( &si, xn, pr, ompr );
+  }
+  return;
+}
+//****************************************************************************80
+
+void pdfbin_batch ( const double *s, size_t n, double *xn, double *pr, double *ompr, double *fx )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    PDFBIN_BATCH evaluates the binomial density for an array.
+//
+//  Parameters:
+//
+//    The parameters are as for LOGPDFBIN_BATCH.
+//
+//    Output, double *FX, the density at each value.
+//
+{
+  size_t i;
+
+  logpdfbin_batch ( s, n, xn, pr, ompr, fx );
+  for ( i = 0; i < n; i++ )
+  {
+    fx[i] = exp ( fx[i] );
+  }
+  return;
+}
@@ -0,0 +1,124 @@
+# include <iomanip>
+# include <cmath>
+using namespace std;
+# include "cdflib.hpp"
+
+//****************************************************************************80
+
+double logpdfchi ( double *x, double *df )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    LOGPDFCHI evaluates the log of the chi-square density.
+//
+//  Discussion:
+//
+//    This is the gamma density of shape DF/2 at X/2, divided by 2.
+//
+//  Parameters:
+//
+//    Input, double *X, the argument.
+//
+//    Input, double *DF, the degrees of freedom, positive.
+//
+//    Output, double LOGPDFCHI, the log of the density.
+//
+{
+  double a;
+  double ln2 = .693147180559945309e0;
+  gamma_pdf_norm nrm;
+  double xx;
+
+  a = 0.5e0 * *df;
+  gamma_pdf_init ( &a, &nrm );
+  xx = 0.5e0 * *x;
+  return gamma_lpdf ( &xx, &nrm ) - ln2;
+}
+//****************************************************************************80
+
+double pdfchi ( double *x, double *df )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    PDFCHI evaluates the chi-square density.
+//
+//  Parameters:
+//
+//    The parameters are as for LOGPDFCHI.
+//
+//    Output, double PDFCHI, the density.
+//
+{
+  return exp ( logpdfchi ( x, df ) );
+}
+//****************************************************************************80
+
+void logpdfchi_batch ( const double *x, size_t n, double *df, double *fx )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    LOGPDFCHI_BATCH evaluates the log of the chi-square density
+//    for an array.
+//
+//  Discussion:
+//
+//    The normalizer is computed once, by GAMMA_PDF_INIT.
+//
+//  Parameters:
+//
+//    Input, const double *X, the arguments.
+//
+//    Input, size_t N, the number of values.
+//
+//    Input, double *DF, the degrees of freedom, positive.
+//
+//    Output, double *FX, the log of the density at each value.
+//
+{
+  double a;
+  double ln2 = .693147180559945309e0;
+  gamma_pdf_norm nrm;
+  double xx;
+  size_t i;
+
+  a = 0.5e0 * *df;
+  gamma_pdf_init ( &a, &nrm );
+  for ( i = 0; i < n; i++ )
+  {
+    xx = 0.5e0 * x[i];
+    fx[i] = gamma_lpdf ( &xx, &nrm ) - ln2;
+  }
+  return;
+}
+//****************************************************************************80
+
+void pdfchi_batch ( const double *x, size_t n, double *df, double *fx )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    PDFCHI_BATCH evaluates the chi-square density for an array.
+//
+//  Parameters:
+//
+//    The parameters are as for LOGPDFCHI_BATCH.
+//
+//    Output, double *FX, the density at each value.
+//
+{
+  size_t i;
+
+  logpdfchi_batch ( x, n, df, fx );
+  for ( i = 0; i < n; i++ )
+  {
+    fx[i] = exp ( fx[i] );
+  }
+  return;
+}
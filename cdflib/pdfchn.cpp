@@ -0,0 +1,190 @@
+# include <iomanip>
+# include <cmath>
+using namespace std;
+# include "cdflib.hpp"
+
+//****************************************************************************80
+
+double logpdfchn ( double *x, double *df, double *pnonc )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    LOGPDFCHN evaluates the log of the noncentral chi-square density.
+//
+//  Discussion:
+//
+//    The density is the Poisson mixture, with mean PNONC/2, of the
+//    chi-square densities with DF+2*I degrees of freedom.  As in CUMCHN,
+//    the sum starts from its largest term and runs outwards; the terms
+//    follow from each other by a ratio, and the sum stops when a term no
+//    longer changes it.  If PNONC <= 1.0D-10, the central density is
+//    returned.  The largest term is at about SQRT(PNONC*X/4), so PNONC*X
+//    should be below about 1.0D+18.
+//
+//  Parameters:
+//
+//    Input, double *X, the argument.
+//
+//    Input, double *DF, the degrees of freedom, positive.
+//
+//    Input, double *PNONC, the noncentrality parameter, nonnegative.
+//
+//    Output, double LOGPDFCHN, the log of the density.
+//
+{
+  double a;
+  double dg;
+  double eps = 1.0e-17;
+  int i;
+  int icent;
+  double lterm;
+  gamma_pdf_norm nrm;
+  double r;
+  double sum;
+  double term;
+  double xnonc;
+  double xx;
+  double T1;
+
+  if ( *pnonc <= 1.0e-10 )
+  {
+    return logpdfchi ( x, df );
+  }
+  xnonc = 0.5e0 * *pnonc;
+  if ( *x <= 0.0e0 )
+  {
+    return - xnonc + logpdfchi ( x, df );
+  }
+  if ( dpmpar_huge < *x )
+  {
+    return - numeric_limits<double>::infinity ( );
+  }
+//
+//  The ratio of term I+1 to term I is R/((I+1)*(DF+2*I)), with
+//  R = XNONC*X.  The largest term is where this ratio passes 1.
+//
+  r = xnonc * *x;
+  dg = ( *df + 2.0e0 ) * ( *df + 2.0e0 ) - 8.0e0 * ( *df - r );
+  icent = 0;
+  if ( 0.0e0 < dg )
+  {
+    icent = ( int ) fifdmax1 ( 0.0e0,
+      ( sqrt ( dg ) - ( *df + 2.0e0 ) ) / 4.0e0 );
+  }
+  T1 = ( double ) ( icent + 1 );
+  a = 0.5e0 * *df + ( double ) icent;
+  gamma_pdf_init ( &a, &nrm );
+  xx = 0.5e0 * *x;
+  lterm = - xnonc + ( double ) icent * log ( xnonc ) - gamma_log ( &T1 )
+    + gamma_lpdf ( &xx, &nrm ) - .693147180559945309e0;
+  if ( !( - dpmpar_huge <= lterm ) )
+  {
+    return - numeric_limits<double>::infinity ( );
+  }
+//
+//  Sum forward, then backward, relative to the largest term.
+//
+  sum = 1.0e0;
+  term = 1.0e0;
+  i = icent;
+  do
+  {
+    term = term * r / ( ( double ) ( i + 1 ) * ( *df + 2.0e0 * ( double ) i ) );
+    sum = sum + term;
+    i = i + 1;
+  } while ( eps * sum < term );
+  term = 1.0e0;
+  i = icent;
+  while ( 0 < i )
+  {
+    term = term * ( double ) i * ( *df + 2.0e0 * ( double ) ( i - 1 ) ) / r;
+    sum = sum + term;
+    i = i - 1;
+    if ( term <= eps * sum )
+    {
+      break;
+    }
+  }
+  return lterm + log ( sum );
+}
+//****************************************************************************80
+
+double pdfchn ( double *x, double *df, double *pnonc )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    PDFCHN evaluates the noncentral chi-square density.
+//
+//  Parameters:
+//
+//    The parameters are as for LOGPDFCHN.
+//
+//    Output, double PDFCHN, the density.
+//
+{
+  return exp ( logpdfchn ( x, df, pnonc ) );
+}
+//****************************************************************************80
+
+void logpdfchn_batch ( const double *x, size_t n, double *df, double *pnonc, double *fx )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    LOGPDFCHN_BATCH evaluates the log of the noncentral chi-square density
+//    for an array.
+//
+//  Parameters:
+//
+//    Input, const double *X, the arguments.
+//
+//    Input, size_t N, the number of values.
+//
+//    Input, double *DF, the degrees of freedom, positive.
+//
+//    Input, double *PNONC, the noncentrality parameter, nonnegative.
+//
+//    Output, double *FX, the log of the density at each value.
+//
+{
+  double xi;
+  size_t i;
+
+  for ( i = 0; i < n; i++ )
+  {
+    xi = x[i];
+    fx[i] = logpdfchn ( &xi, df, pnonc );
+  }
+  return;
+}
+//****************************************************************************80
+
+void pdfchn_batch ( const double *x, size_t n, double *df, double *pnonc, double *fx )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    PDFCHN_BATCH evaluates the noncentral chi-square density for an array.
+//
+//  Parameters:
+//
+//    The parameters are as for LOGPDFCHN_BATCH.
+//
+//    Output, double *FX, the density at each value.
+//
+{
+  size_t i;
+
+  logpdfchn_batch ( x, n, df, pnonc, fx );
+  for ( i = 0; i < n; i++ )
+  {
+    fx[i] = exp ( fx[i] );
+  }
+  return;
+}
@@ -0,0 +1,154 @@
+# include <iomanip>
+# include <cmath>
+using namespace std;
+# include "cdflib.hpp"
+
+//****************************************************************************80
+
+double logpdff ( double *f, double *dfn, double *dfd )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    LOGPDFF evaluates the log of the F density.
+//
+//  Discussion:
+//
+//    With X = DFN*F/(DFN*F+DFD) and Y = 1 - X, this is the beta density
+//    of parameters DFN/2 and DFD/2 at X, times DX/DF = (DFN/DFD)*Y**2.
+//
+//  Parameters:
+//
+//    Input, double *F, the argument.
+//
+//    Input, double *DFN, *DFD, the degrees of freedom of the numerator
+//    and denominator, positive.
+//
+//    Output, double LOGPDFF, the log of the density.
+//
+{
+  double a;
+  double b;
+  double d;
+  double lnr;
+  beta_pdf_norm nrm;
+  double x;
+  double y;
+
+  if ( *f < 0.0e0 )
+  {
+    return - numeric_limits<double>::infinity ( );
+  }
+  d = *dfd + *dfn * *f;
+  if ( dpmpar_huge < d )
+  {
+    return - numeric_limits<double>::infinity ( );
+  }
+  x = *dfn * *f / d;
+  y = *dfd / d;
+  a = 0.5e0 * *dfn;
+  b = 0.5e0 * *dfd;
+  beta_pdf_init ( &a, &b, &nrm );
+  lnr = log ( *dfn / *dfd );
+  return beta_lpdf ( &x, &y, &nrm ) + lnr + 2.0e0 * log ( y );
+}
+//****************************************************************************80
+
+double pdff ( double *f, double *dfn, double *dfd )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    PDFF evaluates the F density.
+//
+//  Parameters:
+//
+//    The parameters are as for LOGPDFF.
+//
+//    Output, double PDFF, the density.
+//
+{
+  return exp ( logpdff ( f, dfn, dfd ) );
+}
+//****************************************************************************80
+
+void logpdff_batch ( const double *f, size_t n, double *dfn, double *dfd, double *fx )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    LOGPDFF_BATCH evaluates the log of the F density
+//    for an array.
+//
+//  Discussion:
+//
+//    The normalizer is computed once, by BETA_PDF_INIT.
+//
+//  Parameters:
+//
+//    Input, const double *F, the arguments.
+//
+//    Input, size_t N, the number of values.
+//
+//    Input, double *DFN, *DFD, the degrees of freedom of the numerator
+//    and denominator, positive.
+//
+//    Output, double *FX, the log of the density at each value.
+//
+{
+  double a;
+  double b;
+  double d;
+  double lnr;
+  beta_pdf_norm nrm;
+  double x;
+  double y;
+  size_t i;
+
+  a = 0.5e0 * *dfn;
+  b = 0.5e0 * *dfd;
+  beta_pdf_init ( &a, &b, &nrm );
+  lnr = log ( *dfn / *dfd );
+  for ( i = 0; i < n; i++ )
+  {
+    d = *dfd + *dfn * f[i];
+    if ( f[i] < 0.0e0 || dpmpar_huge < d )
+    {
+      fx[i] = - numeric_limits<double>::infinity ( );
+      continue;
+    }
+    x = *dfn * f[i] / d;
+    y = *dfd / d;
+    fx[i] = beta_lpdf ( &x, &y, &nrm ) + lnr + 2.0e0 * log ( y );
+  }
+  return;
+}
+//****************************************************************************80
+
+void pdff_batch ( const double *f, size_t n, double *dfn, double *dfd, double *fx )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    PDFF_BATCH evaluates the F density for an array.
+//
+//  Parameters:
+//
+//    The parameters are as for LOGPDFF_BATCH.
+//
+//    Output, double *FX, the density at each value.
+//
+{
+  size_t i;
+
+  logpdff_batch ( f, n, dfn, dfd, fx );
+  for ( i = 0; i < n; i++ )
+  {
+    fx[i] = exp ( fx[i] );
+  }
+  return;
+}
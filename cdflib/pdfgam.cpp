@@ -0,0 +1,114 @@
+# include <iomanip>
+# include <cmath>
+using namespace std;
+# include "cdflib.hpp"
+
+//****************************************************************************80
+
+double logpdfgam ( double *x, double *a )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    LOGPDFGAM evaluates the log of the gamma density.
+//
+//  Parameters:
+//
+//    Input, double *X, the argument.
+//
+//    Input, double *A, the shape parameter, positive.  The scale is 1,
+//    as in CUMGAM.
+//
+//    Output, double LOGPDFGAM, the log of the density.
+//
+{
+  gamma_pdf_norm nrm;
+
+  gamma_pdf_init ( a, &nrm );
+  return gamma_lpdf ( x, &nrm );
+}
+//****************************************************************************80
+
+double pdfgam ( double *x, double *a )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    PDFGAM evaluates the gamma density.
+//
+//  Parameters:
+//
+//    The parameters are as for LOGPDFGAM.
+//
+//    Output, double PDFGAM, the density.
+//
+{
+  return exp ( logpdfgam ( x, a ) );
+}
+//****************************************************************************80
+
+void logpdfgam_batch ( const double *x, size_t n, double *a, double *fx )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    LOGPDFGAM_BATCH evaluates the log of the gamma density
+//    for an array.
+//
+//  Discussion:
+//
+//    The normalizer is computed once, by GAMMA_PDF_INIT.
+//
+//  Parameters:
+//
+//    Input, const double *X, the arguments.
+//
+//    Input, size_t N, the number of values.
+//
+//    Input, double *A, the shape parameter, positive.  The scale is 1,
+//    as in CUMGAM.
+//
+//    Output, double *FX, the log of the density at each value.
+//
+{
+  gamma_pdf_norm nrm;
+  double xi;
+  size_t i;
+
+  gamma_pdf_init ( a, &nrm );
+  for ( i = 0; i < n; i++ )
+  {
+    xi = x[i];
+    fx[i] = gamma_lpdf ( &xi, &nrm );
+  }
+  return;
+}
+//****************************************************************************80
+
+void pdfgam_batch ( const double *x, size_t n, double *a, double *fx )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    PDFGAM_BATCH evaluates the gamma density for an array.
+//
+//  Parameters:
+//
+//    The parameters are as for LOGPDFGAM_BATCH.
+//
+//    Output, double *FX, the density at each value.
+//
+{
+  size_t i;
+
+  logpdfgam_batch ( x, n, a, fx );
+  for ( i = 0; i < n; i++ )
+  {
+    fx[i] = exp ( fx[i] );
+  }
+  return;
+}
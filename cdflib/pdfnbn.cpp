@@ -0,0 +1,126 @@
+# include <iomanip>
+# include <cmath>
+using namespace std;
+# include "cdflib.hpp"
+
+//****************************************************************************80
+
+double logpdfnbn ( double *s, double *xn, double *pr, double *ompr )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    LOGPDFNBN evaluates the log of the negative binomial density.
+//
+//  Discussion:
+//
+//    The probability of S failures is the beta density of parameters
+//    XN and S+1 at PR, times PR/(S+XN).
+//
+//  Parameters:
+//
+//    Input, double *S, the number of failures before the XN-th success,
+//    a nonnegative integer.
+//
+//    Input, double *XN, the number of successes.
+//
+//    Input, double *PR, *OMPR, the probability of success in each trial,
+//    and 1 - PR.
+//
+//    Output, double LOGPDFNBN, the log of the density.
+//
+{
+  double a;
+  double b;
+  beta_pdf_norm nrm;
+
+  if ( *s < 0.0e0 || *pr <= 0.0e0 )
+  {
+    return - numeric_limits<double>::infinity ( );
+  }
+  a = *xn;
+  b = *s + 1.0e0;
+  beta_pdf_init ( &a, &b, &nrm );
+  return beta_lpdf ( pr, ompr, &nrm ) + log ( *pr ) - log ( *s + *xn );
+}
+//****************************************************************************80
+
+double pdfnbn ( double *s, double *xn, double *pr, double *ompr )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    PDFNBN evaluates the negative binomial density.
+//
+//  Parameters:
+//
+//    The parameters are as for LOGPDFNBN.
+//
+//    Output, double PDFNBN, the density.
+//
+{
+  return exp ( logpdfnbn ( s, xn, pr, ompr ) );
+}
+//****************************************************************************80
+
+void logpdfnbn_batch ( const double *s, size_t n, double *xn, double *pr, double *ompr, double *fx )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    LOGPDFNBN_BATCH evaluates the log of the negative binomial density
+//    for an array.
+//
+//  Parameters:
+//
+//    Input, const double *S, the numbers of failures.
+//
+//    Input, size_t N, the number of values.
+//
+//    Input, double *XN, the number of successes.
+//
+//    Input, double *PR, *OMPR, the probability of success in each trial,
+//    and 1 - PR.
+//
+//    Output, double *FX, the log of the density at each value.
+//
+{
+  double si;
+  size_t i;
+
+  for ( i = 0; i < n; i++ )
+  {
+    si = s[i];
+    fx[i] = logpdfnbn ( &si, xn, pr, ompr );
+  }
+  return;
+}
+//****************************************************************************80
+
+void pdfnbn_batch ( const double *s, size_t n, double *xn, double *pr, double *ompr, double *fx )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    PDFNBN_BATCH evaluates the negative binomial density for an array.
+//
+//  Parameters:
+//
+//    The parameters are as for LOGPDFNBN_BATCH.
+//
+//    Output, double *FX, the density at each value.
+//
+{
+  size_t i;
+
+  logpdfnbn_batch ( s, n, xn, pr, ompr, fx );
+  for ( i = 0; i < n; i++ )
+  {
+    fx[i] = exp ( fx[i] );
+  }
+  return;
+}
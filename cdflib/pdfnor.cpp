@@ -0,0 +1,100 @@
+# include <iomanip>
+# include <cmath>
+using namespace std;
+# include "cdflib.hpp"
+
+//****************************************************************************80
+
+double logpdfnor ( double *x )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    LOGPDFNOR evaluates the log of the standard normal density.
+//
+//  Parameters:
+//
+//    Input, double *X, the argument.
+//
+//    Output, double LOGPDFNOR, the log of the density.
+//
+{
+  double ln2pi = .918938533204672742e0;
+
+  return - ln2pi - 0.5e0 * *x * *x;
+}
+//****************************************************************************80
+
+double pdfnor ( double *x )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    PDFNOR evaluates the standard normal density.
+//
+//  Parameters:
+//
+//    The parameters are as for LOGPDFNOR.
+//
+//    Output, double PDFNOR, the density.
+//
+{
+  return exp ( logpdfnor ( x ) );
+}
+//****************************************************************************80
+
+void logpdfnor_batch ( const double *x, size_t n, double *fx )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    LOGPDFNOR_BATCH evaluates the log of the standard normal density
+//    for an array.
+//
+//  Parameters:
+//
+//    Input, const double *X, the arguments.
+//
+//    Input, size_t N, the number of values.
+//
+//    Output, double *FX, the log of the density at each value.
+//
+{
+  double ln2pi = .918938533204672742e0;
+  size_t i;
+
+  for ( i = 0; i < n; i++ )
+  {
+    fx[i] = - ln2pi - 0.5e0 * x[i] * x[i];
+  }
+  return;
+}
+//****************************************************************************80
+
+void pdfnor_batch ( const double *x, size_t n, double *fx )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    PDFNOR_BATCH evaluates the standard normal density for an array.
+//
+//  Parameters:
+//
+//    The parameters are as for LOGPDFNOR_BATCH.
+//
+//    Output, double *FX, the density at each value.
+//
+{
+  size_t i;
+
+  logpdfnor_batch ( x, n, fx );
+  for ( i = 0; i < n; i++ )
+  {
+    fx[i] = exp ( fx[i] );
+  }
+  return;
+}
@@ -0,0 +1,123 @@
+# include <iomanip>
+# include <cmath>
+using namespace std;
+# include "cdflib.hpp"
+
+//****************************************************************************80
+
+double logpdfpoi ( double *s, double *xlam )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    LOGPDFPOI evaluates the log of the Poisson density.
+//
+//  Discussion:
+//
+//    The probability XLAM**S * exp(-XLAM) / S! of S events is, as a
+//    function of XLAM, the gamma density of shape S+1; it is computed
+//    that way, by GAMMA_LPDF.
+//
+//  Parameters:
+//
+//    Input, double *S, the number of events, a nonnegative integer.
+//
+//    Input, double *XLAM, the mean, nonnegative.
+//
+//    Output, double LOGPDFPOI, the log of the density.
+//
+{
+  double a;
+  gamma_pdf_norm nrm;
+
+  if ( *s < 0.0e0 )
+  {
+    return - numeric_limits<double>::infinity ( );
+  }
+  a = *s + 1.0e0;
+  gamma_pdf_init ( &a, &nrm );
+  return gamma_lpdf ( xlam, &nrm );
+}
+//****************************************************************************80
+
+double pdfpoi ( double *s, double *xlam )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    PDFPOI evaluates the Poisson density.
+//
+//  Parameters:
+//
+//    The parameters are as for LOGPDFPOI.
+//
+//    Output, double PDFPOI, the density.
+//
+{
+  return exp ( logpdfpoi ( s, xlam ) );
+}
+//****************************************************************************80
+
+void logpdfpoi_batch ( const double *s, size_t n, double *xlam, double *fx )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    LOGPDFPOI_BATCH evaluates the log of the Poisson density
+//    for an array.
+//
+//  Discussion:
+//
+//    For many values of XLAM and one S, use LOGPDFGAM_BATCH with
+//    shape S+1, which computes the normalizer once.
+//
+//  Parameters:
+//
+//    Input, const double *S, the numbers of events.
+//
+//    Input, size_t N, the number of values.
+//
+//    Input, double *XLAM, the mean, nonnegative.
+//
+//    Output, double *FX, the log of the density at each value.
+//
+{
+  double si;
+  size_t i;
+
+  for ( i = 0; i < n; i++ )
+  {
+    si = s[i];
+    fx[i] = logpdfpoi ( &si, xlam );
+  }
+  return;
+}
+//****************************************************************************80
+
+void pdfpoi_batch ( const double *s, size_t n, double *xlam, double *fx )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    PDFPOI_BATCH evaluates the Poisson density for an array.
+//
+//  Parameters:
+//
+//    The parameters are as for LOGPDFPOI_BATCH.
+//
+//    Output, double *FX, the density at each value.
+//
+{
+  size_t i;
+
+  logpdfpoi_batch ( s, n, xlam, fx );
+  for ( i = 0; i < n; i++ )
+  {
+    fx[i] = exp ( fx[i] );
+  }
+  return;
+}
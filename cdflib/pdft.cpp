@@ -0,0 +1,140 @@
+# include <iomanip>
+# include <cmath>
+using namespace std;
+# include "cdflib.hpp"
+
+//****************************************************************************80
+
+double logpdft ( double *t, double *df )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    LOGPDFT evaluates the log of the Student t density.
+//
+//  Discussion:
+//
+//    The density is (1+T*T/DF)**(-(DF+1)/2) / (SQRT(DF)*BETA(DF/2,1/2)).
+//
+//  Parameters:
+//
+//    Input, double *T, the argument.
+//
+//    Input, double *DF, the degrees of freedom, positive.
+//
+//    Output, double LOGPDFT, the log of the density.
+//
+{
+  double half = 0.5e0;
+  double hdf;
+  double lnc;
+  double w;
+
+  hdf = 0.5e0 * *df;
+  lnc = - ( beta_log ( &hdf, &half ) + 0.5e0 * log ( *df ) );
+  w = *t * *t / *df;
+  if ( w <= 1.0e16 )
+  {
+    w = alnrel ( &w );
+  }
+  else
+  {
+    w = 2.0e0 * log ( fabs ( *t ) ) - log ( *df );
+  }
+  return lnc - ( hdf + 0.5e0 ) * w;
+}
+//****************************************************************************80
+
+double pdft ( double *t, double *df )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    PDFT evaluates the Student t density.
+//
+//  Parameters:
+//
+//    The parameters are as for LOGPDFT.
+//
+//    Output, double PDFT, the density.
+//
+{
+  return exp ( logpdft ( t, df ) );
+}
+//****************************************************************************80
+
+void logpdft_batch ( const double *t, size_t n, double *df, double *fx )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    LOGPDFT_BATCH evaluates the log of the Student t density
+//    for an array.
+//
+//  Discussion:
+//
+//    The normalizer is computed once.
+//
+//  Parameters:
+//
+//    Input, const double *T, the arguments.
+//
+//    Input, size_t N, the number of values.
+//
+//    Input, double *DF, the degrees of freedom, positive.
+//
+//    Output, double *FX, the log of the density at each value.
+//
+{
+  double half = 0.5e0;
+  double hdf;
+  double lnc;
+  double w;
+  size_t i;
+
+  hdf = 0.5e0 * *df;
+  lnc = - ( beta_log ( &hdf, &half ) + 0.5e0 * log ( *df ) );
+  for ( i = 0; i < n; i++ )
+  {
+    w = t[i] * t[i] / *df;
+    if ( w <= 1.0e16 )
+    {
+      w = alnrel ( &w );
+    }
+    else
+    {
+      w = 2.0e0 * log ( fabs ( t[i] ) ) - log ( *df );
+    }
+    fx[i] = lnc - ( hdf + 0.5e0 ) * w;
+  }
+  return;
+}
+//****************************************************************************80
+
+void pdft_batch ( const double *t, size_t n, double *df, double *fx )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    PDFT_BATCH evaluates the Student t density for an array.
+//
+//  Parameters:
+//
+//    The parameters are as for LOGPDFT_BATCH.
+//
+//    Output, double *FX, the density at each value.
+//
+{
+  size_t i;
+
+  logpdft_batch ( t, n, df, fx );
+  for ( i = 0; i < n; i++ )
+  {
+    fx[i] = exp ( fx[i] );
+  }
+  return;
+}
@@ -0,0 +1,72 @@
+# include <iomanip>
+# include <cmath>
+using namespace std;
+# include "cdflib.hpp"
+
+//****************************************************************************80
+
+PreparedChi2::PreparedChi2 ( double df ) : gam ( df * 0.5 )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    PREPAREDCHI2 sets up the chi-square distribution with DF degrees
+//    of freedom, a gamma distribution of shape DF/2.
+//
+//  Parameters:
+//
+//    Input, double DF, the degrees of freedom.
+//
+{
+}
+//****************************************************************************80
+
+void PreparedChi2::eval ( double x, double *cum, double *ccum ) const
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    PREPAREDCHI2::EVAL evaluates the cumulative chi-square distribution.
+//
+//  Discussion:
+//
+//    The result is that of CUMCHI ( X, DF ).
+//
+//  Parameters:
+//
+//    Input, double X, the upper limit of integration.
+//
+//    Output, double *CUM, *CCUM, the CDF and its complement.
+//
+{
+  gam.eval ( x * 0.5, cum, ccum );
+  return;
+}
+//****************************************************************************80
+
+double PreparedChi2::cdf ( double x ) const
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    PREPAREDCHI2::CDF returns the CDF at X.
+//
+{
+  return gam.cdf ( x * 0.5 );
+}
+//****************************************************************************80
+
+double PreparedChi2::sf ( double x ) const
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    PREPAREDCHI2::SF returns the complementary CDF at X.
+//
+{
+  return gam.sf ( x * 0.5 );
+}
@@ -0,0 +1,103 @@
+# include <iomanip>
+# include <cmath>
+using namespace std;
+# include "cdflib.hpp"
+
+//****************************************************************************80
+
+PreparedT::PreparedT ( double df ) : bet ( 0.5e0 * df, 0.5e0 )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    PREPAREDT sets up the Student's T distribution with DF degrees
+//    of freedom.
+//
+//  Parameters:
+//
+//    Input, double DF, the degrees of freedom.
+//
+{
+  this->df = df;
+}
+//****************************************************************************80
+
+void PreparedT::eval ( double t, double *cum, double *ccum ) const
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    PREPAREDT::EVAL evaluates the cumulative T distribution.
+//
+//  Discussion:
+//
+//    The result is that of CUMT ( T, DF ).
+//
+//  Parameters:
+//
+//    Input, double T, the upper limit of integration.
+//
+//    Output, double *CUM, *CCUM, the CDF and its complement.
+//
+{
+  double a;
+  double dfptt;
+  double oma;
+  double tt;
+  double xx;
+  double yy;
+
+  tt = t * t;
+  dfptt = df + tt;
+  xx = df / dfptt;
+  yy = tt / dfptt;
+  bet.eval ( xx, yy, &a, &oma );
+
+  if ( t <= 0.0e0 )
+  {
+    *cum = 0.5e0 * a;
+    *ccum = oma + ( *cum );
+  }
+  else
+  {
+    *ccum = 0.5e0 * a;
+    *cum = oma + ( *ccum );
+  }
+  return;
+}
+//****************************************************************************80
+
+double PreparedT::cdf ( double t ) const
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    PREPAREDT::CDF returns the CDF at T.
+//
+{
+  double ccum;
+  double cum;
+
+  eval ( t, &cum, &ccum );
+  return cum;
+}
+//****************************************************************************80
+
+double PreparedT::sf ( double t ) const
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    PREPAREDT::SF returns the complementary CDF at T.
+//
+{
+  double ccum;
+  double cum;
+
+  eval ( t, &cum, &ccum );
+  return ccum;
+}
@@ -34,29 +34,27 @@ double psi ( double *xx )
 //    is assigned the value 0 when the psi function is undefined.
 //
 {
-  static double dx0 = 1.461632144968362341262659542325721325e0;
-  static double piov4 = .785398163397448e0;
-  static double p1[7] = {
+  double dx0 = 1.461632144968362341262659542325721325e0;
+  double piov4 = .785398163397448e0;
+  static const double p1[7] = {
     .895385022981970e-02,.477762828042627e+01,.142441585084029e+03,
     .118645200713425e+04,.363351846806499e+04,.413810161269013e+04,
     .130560269827897e+04
   };
-  static double p2[4] = {
+  static const double p2[4] = {
     -.212940445131011e+01,-.701677227766759e+01,-.448616543918019e+01,
     -.648157123766197e+00
   };
-  static double q1[6] = {
+  static const double q1[6] = {
     .448452573429826e+02,.520752771467162e+03,.221000799247830e+04,
     .364127349079381e+04,.190831076596300e+04,.691091682714533e-05
   };
-  static double q2[4] = {
+  static const double q2[4] = {
     .322703493791143e+02,.892920700481861e+02,.546117738103215e+02,
     .777788548522962e+01
   };
-  static int K1 = 3;
-  static int K2 = 1;
-  static double psi,aug,den,sgn,upper,w,x,xmax1,xmx0,xsmall,z;
-  static int i,m,n,nq;
+  double psi,aug,den,sgn,upper,w,x,xmax1,xmx0,xsmall,z;
+  int i,m,n,nq;
 //
 //     MACHINE DEPENDENT CONSTANTS ...
 //        XMAX1  = THE SMALLEST POSITIVE FLOATING POINT CONSTANT
@@ -67,8 +65,8 @@ double psi ( double *xx )
 //        XSMALL = ABSOLUTE ARGUMENT BELOW WHICH PI*COTAN(PI*X)
 //                 MAY BE REPRESENTED BY 1/X.
 //
-    xmax1 = ipmpar(&K1);
-    xmax1 = fifdmin1(xmax1,1.0e0/dpmpar(&K2));
+    xmax1 = ipmpar_int_max;
+    xmax1 = fifdmin1(xmax1,1.0e0/dpmpar_eps);
     xsmall = 1.e-9;
     x = *xx;
     aug = 0.0e0;
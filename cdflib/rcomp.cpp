@@ -24,8 +24,8 @@ double rcomp ( double *a, double *x )
 //    RT2PIN = 1/SQRT(2*PI)
 //
 {
-  static double rt2pin = .398942280401433e0;
-  static double rcomp,t,t1,u;
+  double rt2pin = .398942280401433e0;
+  double rcomp,t,t1,u;
     rcomp = 0.0e0;
     if(*a >= 20.0e0) goto S20;
     t = *a*log(*x)-*x;
@@ -21,14 +21,14 @@ double rlog ( double *x )
 //    Output, double RLOG, the value of the function.
 //
 {
-  static double a = .566749439387324e-01;
-  static double b = .456512608815524e-01;
-  static double p0 = .333333333333333e+00;
-  static double p1 = -.224696413112536e+00;
-  static double p2 = .620886815375787e-02;
-  static double q1 = -.127408923933623e+01;
-  static double q2 = .354508718369557e+00;
-  static double rlog,r,t,u,w,w1;
+  double a = .566749439387324e-01;
+  double b = .456512608815524e-01;
+  double p0 = .333333333333333e+00;
+  double p1 = -.224696413112536e+00;
+  double p2 = .620886815375787e-02;
+  double q1 = -.127408923933623e+01;
+  double q2 = .354508718369557e+00;
+  double rlog,r,t,u,w,w1;
 
     if(*x < 0.61e0 || *x > 1.57e0) goto S40;
     if(*x < 0.82e0) goto S10;
@@ -0,0 +1,44 @@
+# include <cstddef>
+# include <cmath>
+using namespace std;
+# include "cumnor_simd.hpp"
+//
+//  The batch kernels, compiled for AVX2 by the Makefile.
+//
+# if defined ( CDFLIB_HAVE_SIMD )
+
+//****************************************************************************80
+
+void cumnor_batch_avx2 ( const double *x, size_t n, double *p, double *q )
+
+//****************************************************************************80
+{
+  cumnor_batch_kernel ( x, n, p, q );
+}
+//****************************************************************************80
+
+void cumnor_batch_f_avx2 ( const float *x, size_t n, float *p, float *q )
+
+//****************************************************************************80
+{
+  cumnor_batch_f_kernel ( x, n, p, q );
+}
+//****************************************************************************80
+
+void cumnor_log_batch_avx2 ( const double *x, size_t n, double *lp, double *lq )
+
+//****************************************************************************80
+{
+  cumnor_log_batch_kernel ( x, n, lp, lq );
+}
+//****************************************************************************80
+
+void dinvnr_batch_avx2 ( const double *p, const double *q, size_t n,
+  double *x )
+
+//****************************************************************************80
+{
+  dinvnr_batch_kernel ( p, q, n, x );
+}
+
+# endif
@@ -0,0 +1,87 @@
+# include <iomanip>
+# include <cstdlib>
+# include <cstring>
+using namespace std;
+# include "cdflib.hpp"
+
+static int simd_probe ( );
+
+//****************************************************************************80
+
+int simd_level ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    SIMD_LEVEL reports the widest vector instruction set to use.
+//
+//  Discussion:
+//
+//    The answer comes from the processor, but can be lowered by setting
+//    the environment variable CDFLIB_SIMD to "avx2" or "none", which is
+//    useful for testing the narrower versions of the batch routines.
+//
+//    The answer is worked out on the first call and kept, since the batch
+//    routines ask for it on every call.  The initialization of the local
+//    static is thread safe.
+//
+//  Parameters:
+//
+//    Output, int SIMD_LEVEL:
+//    0, no wide vector instructions, use the baseline build;
+//    1, AVX2 and FMA;
+//    2, AVX-512F and AVX-512DQ, besides AVX2 and FMA.
+//
+{
+  static const int level = simd_probe ( );
+
+  return level;
+}
+//****************************************************************************80
+
+static int simd_probe ( )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    SIMD_PROBE queries the processor and the environment for SIMD_LEVEL.
+//
+//  Parameters:
+//
+//    Output, int SIMD_PROBE, the level, as for SIMD_LEVEL.
+//
+{
+  const char *env;
+  int level = 0;
+
+# if defined ( __GNUC__ ) && ( defined ( __x86_64__ ) || defined ( __i386__ ) )
+  if ( __builtin_cpu_supports ( "avx2" ) && __builtin_cpu_supports ( "fma" ) )
+  {
+    level = 1;
+  }
+//
+//  The AVX-512 build also uses DQ and FMA instructions.
+//
+  if ( level == 1 && __builtin_cpu_supports ( "avx512f" )
+    && __builtin_cpu_supports ( "avx512dq" ) )
+  {
+    level = 2;
+  }
+# endif
+
+  env = getenv ( "CDFLIB_SIMD" );
+  if ( env != NULL )
+  {
+    if ( strcmp ( env, "none" ) == 0 )
+    {
+      level = 0;
+    }
+    else if ( strcmp ( env, "avx2" ) == 0 && level > 1 )
+    {
+      level = 1;
+    }
+  }
+  return level;
+}
@@ -0,0 +1,82 @@
+# include <iomanip>
+# include <cmath>
+using namespace std;
+# include "cdflib.hpp"
+
+//****************************************************************************80
+
+double stvalf ( double *dfn, double *dfd, double *p, double *q )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    STVALF provides starting values for the inverse of the F distribution.
+//
+//  Discussion:
+//
+//    The routine returns an approximation to F such that P = CUMF(F).
+//    Paulson's approximation treats the cube roots of the two chi-square
+//    variables as normal; solving it for F^(1/3) gives a quadratic.
+//    Where the quadratic has no positive root, which happens far in the
+//    tails when a number of degrees of freedom is small, the leading
+//    term of the tail expansion of the density is used instead.
+//
+//    Since X = DFN F / ( DFD + DFN F ) has the Beta ( DFN/2, DFD/2 )
+//    distribution, this also gives starting values for the inverse of
+//    the incomplete beta ratio.
+//
+//  Reference:
+//
+//    Edward Paulson,
+//    An approximate normalization of the analysis of variance distribution,
+//    Annals of Mathematical Statistics,
+//    Volume 13, 1942, pages 233-235.
+//
+//  Parameters:
+//
+//    Input, double *DFN, *DFD, the degrees of freedom, positive.
+//
+//    Input, double *P, *Q, the probabilities, with P + Q = 1.
+//
+//    Output, double STVALF, the approximate value of F.
+//
+{
+  double a1;
+  double a2;
+  double den;
+  double hn;
+  double hd;
+  double lnb;
+  double rad;
+  double u;
+  double z;
+
+  z = dinvnr ( p, q );
+  a1 = 2.0e0 / ( 9.0e0 * *dfn );
+  a2 = 2.0e0 / ( 9.0e0 * *dfd );
+  den = ( 1.0e0 - a2 ) * ( 1.0e0 - a2 ) - z * z * a2;
+  rad = ( 1.0e0 - a1 ) * ( 1.0e0 - a1 ) * a2 + ( 1.0e0 - a2 ) * ( 1.0e0 - a2 ) * a1
+    - z * z * a1 * a2;
+
+  if ( 0.0e0 < den && 0.0e0 <= rad )
+  {
+    u = ( ( 1.0e0 - a1 ) * ( 1.0e0 - a2 ) + z * sqrt ( rad ) ) / den;
+    if ( 0.0e0 < u )
+    {
+      return u * u * u;
+    }
+  }
+//
+//  CUMF(F) is about (DFN F/DFD)^(DFN/2) / (DFN/2 B) for small F,
+//  and 1 - CUMF(F) is about (DFD/(DFN F))^(DFD/2) / (DFD/2 B) for large F.
+//
+  hn = 0.5e0 * *dfn;
+  hd = 0.5e0 * *dfd;
+  lnb = beta_log ( &hn, &hd );
+  if ( z < 0.0e0 )
+  {
+    return *dfd / *dfn * exp ( ( log ( *p * hn ) + lnb ) / hn );
+  }
+  return *dfd / *dfn * exp ( - ( log ( *q * hd ) + lnb ) / hd );
+}
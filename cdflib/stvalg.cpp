@@ -0,0 +1,73 @@
+# include <iomanip>
+# include <cmath>
+using namespace std;
+# include "cdflib.hpp"
+
+//****************************************************************************80
+
+double stvalg ( double *a, double *p, double *q )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    STVALG provides starting values for the inverse of the incomplete
+//    gamma ratio.
+//
+//  Discussion:
+//
+//    The routine returns an approximation to X such that P = P(A,X),
+//    Q = Q(A,X).  For A > 1 this is the Wilson-Hilferty approximation,
+//    or where that is not positive, the leading term of the series for
+//    small X.  For A <= 1 it is the approximation of Press et al.
+//
+//  Reference:
+//
+//    Edwin Wilson, Margaret Hilferty,
+//    The distribution of chi-square,
+//    Proceedings of the National Academy of Sciences,
+//    Volume 17, 1931, pages 684-688.
+//
+//    William Press, Saul Teukolsky, William Vetterling, Brian Flannery,
+//    Numerical Recipes: The Art of Scientific Computing,
+//    Third Edition, Cambridge University Press, 2007, section 6.2.1.
+//
+//  Parameters:
+//
+//    Input, double *A, the shape parameter, positive.
+//
+//    Input, double *P, *Q, the probabilities, with P + Q = 1.
+//
+//    Output, double STVALG, the approximate value of X.
+//
+{
+  double ap1;
+  double t;
+  double x;
+  double z;
+
+  if ( *a <= 1.0e0 )
+  {
+    t = 1.0e0 - *a * ( 0.253e0 + *a * 0.12e0 );
+    if ( *p < t )
+    {
+      x = pow ( *p / t, 1.0e0 / *a );
+    }
+    else
+    {
+      x = 1.0e0 - log ( *q / ( 1.0e0 - t ) );
+    }
+    return x;
+  }
+
+  z = dinvnr ( p, q );
+  t = 1.0e0 / ( 9.0e0 * *a );
+  x = 1.0e0 - t + z * sqrt ( t );
+  x = *a * x * x * x;
+  if ( x <= 0.0e0 )
+  {
+    ap1 = *a + 1.0e0;
+    x = exp ( ( log ( *p ) + gamma_log ( &ap1 ) ) / *a );
+  }
+  return x;
+}
@@ -30,7 +30,7 @@ void timestamp ( )
 {
 # define TIME_SIZE 40
 
-  static char time_buffer[TIME_SIZE];
+  char time_buffer[TIME_SIZE];
   const struct tm *tm;
   size_t len;
   time_t now;
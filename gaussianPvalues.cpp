@@ -1,39 +1,40 @@
 #include <iostream>
 #include <iomanip>
+#include <string>
 #include <math.h>
-#include <gsl/gsl_math.h>
-#include <gsl/gsl_cdf.h>
 
 using namespace std;
 
+#include "pvalue/pvalue.h"
+
+const char * const methodLabel[PV_GAU_METHODS] = {
+    "ignoring uncertainty on Gaussian mean",
+    "prior-pred., Gaussian prior"
+};
+
 int main()
 {
-    double Obs;
-    double gauMean;
-    double uncMean;
-    double gauVar;
-    double gauStD;
-    double pAdjustment;
-    bool excess;
+    struct pvGaussianConfig cfg;
+    struct pvGaussianResult res;
     string bline(72, '-');
 
     cout << '\n' << bline << endl;
     cout << "Observation: ";
-    cin  >> Obs;
+    cin  >> cfg.obs;
     cout << "Gaussian mean: ";
-    cin  >> gauMean;
-    excess = Obs >= gauMean;
+    cin  >> cfg.gauMean;
     cout << "         variance: ";
-    cin  >> gauVar;
-    gauStD = sqrt(gauVar);
+    cin  >> cfg.gauVar;
     cout << "Uncertainty on Gaussian mean: ";
-    cin  >> uncMean;
+    cin  >> cfg.uncMean;
     cout << "P-value adjustment factor: ";
-    cin  >> pAdjustment;
+    cin  >> cfg.pAdjustment;
 
-    cout << "\nGaussian mean: " << gauMean << " +/- " << uncMean << ", standard deviation: " << gauStD << ", observation: " << Obs << endl;
-    cout << "P-value adjustment factor: " << pAdjustment << endl;
-    if (excess) {
+    gaussian_pvalues(&cfg, 1, &res);
+
+    cout << "\nGaussian mean: " << cfg.gauMean << " +/- " << cfg.uncMean << ", standard deviation: " << sqrt(cfg.gauVar) << ", observation: " << cfg.obs << endl;
+    cout << "P-value adjustment factor: " << cfg.pAdjustment << endl;
+    if (res.excess) {
         cout << "Computing the significance of an *excess*." << endl;
     } else {
         cout << "Computing the significance of a *deficit*." << endl;
@@ -41,28 +42,11 @@ int main()
     cout << "\nP-Value      Nsigmas" << endl;
     cout << "---------------------" << endl;
 
-// First ignore uncertainty on Gaussian mean when computing p-value
-    double pVal0, nSig0;
-    if (excess) {
-        pVal0 = gsl_cdf_ugaussian_Q((Obs-gauMean)/gauStD);
-    } else {
-        pVal0 = gsl_cdf_ugaussian_P((Obs-gauMean)/gauStD);
-    }
-    pVal0 *= pAdjustment;
-    nSig0  = gsl_cdf_ugaussian_Qinv(pVal0);
-    cout << setw(11) << left << pVal0 << "  " << setw(8) << left << nSig0 << "  (ignoring uncertainty on Gaussian mean)" << endl;
-
-// Try a Gaussian prior for the Gaussian mean
-    double combStD, pVal1, nSig1;
-    combStD = sqrt( pow(uncMean,2) + pow(gauStD,2) );
-    if (excess) {
-        pVal1 = gsl_cdf_ugaussian_Q((Obs-gauMean)/combStD);
-    } else {
-        pVal1 = gsl_cdf_ugaussian_P((Obs-gauMean)/combStD);
+    for (int k=0; k<PV_GAU_METHODS; k++) {
+        char pStr[32];
+        pvalue_format(res.method[k].lnPval, 6, pStr, sizeof(pStr));
+        cout << setw(11) << left << pStr << "  " << setw(8) << left << res.method[k].nSigma << "  (" << methodLabel[k] << ")" << endl;
     }
-    pVal1 *= pAdjustment;
-    nSig1  = gsl_cdf_ugaussian_Qinv(pVal1);
-    cout << setw(11) << left << pVal1 << "  " << setw(8) << left << nSig1 << "  (prior-pred., Gaussian prior)" << endl;
 
     cout << bline << '\n' << endl;
     return 0;
@@ -2,14 +2,72 @@
 #include <iomanip>
 #include <vector>
 #include <sstream>
+#include <algorithm>
+#include <queue>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <math.h>
 #include <gsl/gsl_cdf.h>
-#include <gsl/gsl_math.h>
-#include <gsl/gsl_sf_gamma.h>
 
 using namespace std;
 
-int main()
+#include "pvalue/pvalue.h"
+
+// Combination methods that can be selected in streaming mode: those that
+// need only one pass over the p-values, and those that need them sorted
+const int sumMethods = PV_FISHER | PV_FISHER2 | PV_TIPPETT | PV_STOUFFER | PV_LOGIT | PV_EDGINGTON;
+const int orderMethods = PV_SIMES | PV_WILKINSON;
+const char * const combLabel[PV_COMB_METHODS] = {
+    "Fisher", "Fisher with nDegF = 100", "Tippett", "Stouffer", "Logit combination, approximate",
+    "Simes", "Edgington"
+};
+
+// Sorted runs of p-values spilled to temporary files by the streaming mode
+// when order statistics are requested, and a buffered reader for each.
+const size_t runSize = 1 << 23;
+struct runReader { FILE * file; vector<double> buf; size_t pos; size_t len; };
+
+void combPrint(const struct pvCombResult * res, int methods);
+void printComb(const struct pvResult * r, const char * label);
+void simesWilkinson(vector<double> & pValues, vector<FILE *> & runs, double numPvalues, int methods);
+int  parseMethods(const char * list);
+int  interactiveMode();
+int  streamMode(FILE * in, int methods);
+
+int main(int argc, char * argv[])
+{
+    if (argc > 1 && (strcmp(argv[1], "-s") == 0 || strcmp(argv[1], "--stream") == 0)) {
+        int methods = sumMethods;
+        const char * fileName = NULL;
+        for (int i=2; i<argc; i++) {
+            if ((strcmp(argv[i], "-m") == 0 || strcmp(argv[i], "--methods") == 0) && i+1 < argc) {
+                methods = parseMethods(argv[++i]);
+                if (methods == 0) {return 1;}
+            } else {
+                fileName = argv[i];
+            }
+        }
+        FILE * in = stdin;
+        if (fileName != NULL && strcmp(fileName, "-") != 0) {
+            in = fopen(fileName, "r");
+            if (in == NULL) {
+                cerr << "pValueCombination: cannot open " << fileName << endl;
+                return 1;
+            }
+        }
+        int ret = streamMode(in, methods);
+        if (in != stdin) {fclose(in);}
+        return ret;
+    } else if (argc > 1) {
+        cerr << "Usage: pValueCombination [-s|--stream [-m method,...] [file]]" << endl;
+        cerr << "Methods: fisher, fisher100, tippett, stouffer, logit, simes, edgington, wilkinson, all" << endl;
+        return 1;
+    }
+    return interactiveMode();
+}
+
+int interactiveMode()
 {
     vector<double> pValues;
     string input;
@@ -26,103 +84,190 @@ int main()
     }
     double numPvalues = pValues.size();
 
-// Sort p-values in place before starting (!!)
+// Sort p-values in place before starting (!!), for Simes's and Wilkinson's
+// methods
     sort(pValues.begin(), pValues.end());
 
+    struct pvCombResult res;
+    combine_pvalues(pValues.empty() ? NULL : &pValues[0], pValues.size(), sumMethods | PV_SIMES, &res);
+
     cout << "   Combinations:    " << endl;
     cout << "P-Value      Nsigmas" << endl;
     cout << "---------------------" << endl;
 
-// Fisher's method
-    double tStat1 = 0;
-    for (vector<double>::const_iterator i = pValues.begin(); i != pValues.end(); ++i) {
-        tStat1 += log(*i);
-    }
-    tStat1 *= -2;
-    double nu = 2*numPvalues;
-    double pComb1 = gsl_cdf_chisq_Q( tStat1, nu);
-    double nSig1 = gsl_cdf_ugaussian_Qinv(pComb1);
-    cout << setw(11) << left << pComb1 << "  " << setw(8) << left << nSig1 << "  (Fisher)" << endl;
-
-// Fisher's method with chisquare distributions with different numbers of degrees of freedom
-    double nDegF2 = 100;
-    double sumDegF = 0;
-    double tStat2 = 0;
-    double chi2Val;
-    for (vector<double>::const_iterator i = pValues.begin(); i != pValues.end(); ++i) {
-        chi2Val = gsl_cdf_chisq_Qinv(*i, nDegF2);
-        tStat2 += chi2Val;
-        sumDegF += nDegF2;
+    combPrint(&res, sumMethods | PV_SIMES);
+
+// Wilkinson's method
+    vector<FILE *> noRuns;
+    simesWilkinson(pValues, noRuns, numPvalues, PV_WILKINSON);
+
+    cout << endl;
+    return 0;
+}
+
+int streamMode(FILE * in, int methods)
+{
+// Reads p-values separated by blanks, commas or newlines until the end of
+// the input, in one pass. The sum-based methods use O(1) memory. Simes and
+// Wilkinson need the sorted p-values; when they are requested the input is
+// sorted in runs of runSize values, spilled to temporary files and merged.
+    struct pvCombSums cs;
+    struct pvCombResult res;
+    vector<double> pValues;
+    vector<FILE *> runs;
+    char line[4096];
+    bool order = (methods & orderMethods) != 0;
+
+    combine_init(&cs, methods);
+    if (order) {pValues.reserve(runSize);}
+
+    while (fgets(line, sizeof(line), in) != NULL) {
+        char * c = line;
+        char * end;
+        for (;;) {
+            while (*c == ' ' || *c == '\t' || *c == ',' || *c == ';' || *c == '\n' || *c == '\r') {c++;}
+            if (*c == '\0' || *c == '#') {break;}
+            double p = strtod(c, &end);
+            if (end == c) {
+                cerr << "pValueCombination: skipping unparsable input: " << c;
+                break;
+            }
+            c = end;
+            combine_add(&cs, p);
+            if (order) {
+                pValues.push_back(p);
+                if (pValues.size() == runSize) {
+                    sort(pValues.begin(), pValues.end());
+                    FILE * run = tmpfile();
+                    if (run == NULL || fwrite(&pValues[0], sizeof(double), pValues.size(), run) != pValues.size()) {
+                        cerr << "pValueCombination: cannot write temporary file" << endl;
+                        return 1;
+                    }
+                    rewind(run);
+                    runs.push_back(run);
+                    pValues.clear();
+                }
+            }
+        }
     }
-    double pComb2 = gsl_cdf_chisq_Q (tStat2, sumDegF);
-    double nSig2 = gsl_cdf_ugaussian_Qinv(pComb2);
-    cout << setw(11) << left << pComb2 << "  " << setw(8) << left << nSig2 << "  (Fisher with nDegF = " << nDegF2 << ")" << endl;
-
-// Tippett's method
-    double tStat3 = *min_element(pValues.begin(), pValues.end());
-    double aval = 1.0;
-    double pComb3 = gsl_cdf_beta_P(tStat3, aval, numPvalues);
-    double nSig3 = gsl_cdf_ugaussian_Qinv(pComb3);
-    cout << setw(11) << left << pComb3 << "  " << setw(8) << left << nSig3 << "  (Tippett)" << endl;
-
-// Stouffer's method
-    double tStat4 = 0;
-    for (vector<double>::const_iterator i = pValues.begin(); i != pValues.end(); ++i) {
-        tStat4 += gsl_cdf_ugaussian_Qinv(*i);
+    if (cs.n == 0) {
+        cerr << "pValueCombination: no p-values read" << endl;
+        return 1;
     }
-    tStat4 /= sqrt(numPvalues);
-    double pComb4 = gsl_cdf_ugaussian_Q(tStat4);
-    double nSig4 = gsl_cdf_ugaussian_Qinv(pComb4);
-    cout << setw(11) << left << pComb4 << "  " << setw(8) << left << nSig4 << "  (Stouffer)" << endl;
-
-// Logit combination
-    double tStat5 = 0, nDegF5 = 5*numPvalues + 4;
-    for (vector<double>::const_iterator i = pValues.begin(); i != pValues.end(); ++i) {
-        tStat5 -= log(*i/(1-*i));
+
+    cout << "   Combinations of " << (long long) cs.n << " p-values:" << endl;
+    cout << "P-Value      Nsigmas" << endl;
+    cout << "---------------------" << endl;
+    combine_sums(&cs, &res);
+    combPrint(&res, methods & sumMethods);
+    if (order) {
+        sort(pValues.begin(), pValues.end());
+        simesWilkinson(pValues, runs, cs.n, methods & orderMethods);
     }
-    tStat5 /= M_PI * sqrt( numPvalues * (nDegF5-2) / (3*nDegF5) );
-    double pComb5 = gsl_cdf_tdist_Q(tStat5, nDegF5);
-    double nSig5 = gsl_cdf_ugaussian_Qinv(pComb5);
-    cout << setw(11) << left << pComb5 << "  " << setw(8) << left << nSig5 << "  (Logit combination, approximate)" << endl;
-
-// Simes's method (here we assume the p-values are already sorted in increasing order)
-    double* const scaledPvalues = new double[pValues.size()];
-    for (int i=0; i<pValues.size(); i++) {
-        scaledPvalues[i] = pValues[i]*(numPvalues/(i+1));
+    cout << endl;
+    return 0;
+}
+
+int parseMethods(const char * list)
+{
+    static const struct { const char * name; int flag; } names[] = {
+        {"fisher", PV_FISHER}, {"fisher100", PV_FISHER2}, {"tippett", PV_TIPPETT}, {"stouffer", PV_STOUFFER},
+        {"logit", PV_LOGIT}, {"simes", PV_SIMES}, {"edgington", PV_EDGINGTON}, {"wilkinson", PV_WILKINSON},
+        {"all", sumMethods | orderMethods}
+    };
+    int methods = 0;
+    string item;
+    stringstream ss(list);
+    while (getline(ss, item, ',')) {
+        int flag = 0;
+        for (size_t k=0; k<sizeof(names)/sizeof(names[0]); k++) {
+            if (item == names[k].name) {flag = names[k].flag;}
+        }
+        if (flag == 0) {
+            cerr << "pValueCombination: unknown method " << item << endl;
+            return 0;
+        }
+        methods |= flag;
     }
-    double pComb6 = *min_element(scaledPvalues, scaledPvalues+pValues.size()-1);
-    double nSig6 = gsl_cdf_ugaussian_Qinv(pComb6);
-    cout << setw(11) << left << pComb6 << "  " << setw(8) << left << nSig6 << "  (Simes)" << endl;
-
-// Edgington's method
-    double pValueSum=0;
-    for (vector<double>::const_iterator i = pValues.begin(); i != pValues.end(); ++i) {
-        pValueSum += *i;
+    return methods;
+}
+
+void printComb(const struct pvResult * r, const char * label)
+{
+    cout << setw(11) << left << r->pVal << "  " << setw(8) << left << r->nSigma << "  (" << label << ")" << endl;
+}
+
+void combPrint(const struct pvCombResult * res, int methods)
+{
+// Prints the combinations selected in methods, in the order of res
+    for (int k=0; k<PV_COMB_METHODS; k++) {
+        if (methods & (1 << k)) {printComb(&res->method[k], combLabel[k]);}
     }
-    int IntPvalueSum = floor(pValueSum);
-    double pComb7=0;
-    double term;
-    int npv=pValues.size();
-    int tsign=1;
-    for (int j=0; j<=IntPvalueSum; j++) {
-        term = npv * log(pValueSum-j) - gsl_sf_lngamma(numPvalues+1.0-j) - gsl_sf_lngamma(1.0+j);
-        term = exp(term);
-        pComb7 += tsign * term;
-        tsign *= -1;
+}
+
+void simesWilkinson(vector<double> & pValues, vector<FILE *> & runs, double numPvalues, int methods)
+{
+// Simes and Wilkinson combinations from the p-values in increasing order.
+// The p-values are pValues (sorted) when runs is empty, and otherwise the
+// merge of the sorted runs and of pValues.
+    vector<runReader> readers;
+    priority_queue< pair<double,size_t>, vector< pair<double,size_t> >, greater< pair<double,size_t> > > heap;
+    size_t next = 0;
+
+    if (!runs.empty()) {
+        const size_t bufSize = 65536;
+        readers.resize(runs.size());
+        for (size_t k=0; k<runs.size(); k++) {
+            readers[k].file = runs[k];
+            readers[k].buf.resize(bufSize);
+            readers[k].len = fread(&readers[k].buf[0], sizeof(double), bufSize, runs[k]);
+            readers[k].pos = 0;
+            if (readers[k].len > 0) {heap.push(make_pair(readers[k].buf[0], k));}
+        }
     }
-    double nSig7 = gsl_cdf_ugaussian_Qinv(pComb7);
-    cout << setw(11) << left << pComb7 << "  " << setw(8) << left << nSig7 << "  (Edgington)" << endl;
 
-// Wilkinson's method (here we assume the p-values are already sorted in increasing order)
-    double tStat8, pComb8, nSig8, r=0;
-    for (vector<double>::const_iterator i = pValues.begin(); i != pValues.end(); ++i) {
-        tStat8 = *i;
+    double pSimes = INFINITY;
+    double r = 0;
+    for (;;) {
+// Next p-value in increasing order
+        double pVal;
+        if (!heap.empty() && (next >= pValues.size() || heap.top().first <= pValues[next])) {
+            size_t k = heap.top().second;
+            runReader & rd = readers[k];
+            pVal = heap.top().first;
+            heap.pop();
+            if (++rd.pos == rd.len) {
+                rd.len = fread(&rd.buf[0], sizeof(double), rd.buf.size(), rd.file);
+                rd.pos = 0;
+            }
+            if (rd.pos < rd.len) {heap.push(make_pair(rd.buf[rd.pos], k));}
+        } else if (next < pValues.size()) {
+            pVal = pValues[next++];
+        } else {
+            break;
+        }
         r++;
-        pComb8 = gsl_cdf_beta_P(tStat8, r, numPvalues-r+1);
-        nSig8 = gsl_cdf_ugaussian_Qinv(pComb8);
-        cout << setw(11) << left << pComb8 << "  " << setw(8) << left << nSig8 << "  (Wilkinson with r=" << r << ")" << endl;
+
+        if (methods & PV_SIMES) {
+            double scaled = pVal*(numPvalues/r);
+            if (scaled < pSimes) {pSimes = scaled;}
+        }
+        if (methods & PV_WILKINSON) {
+            struct pvResult comb;
+            comb.pVal   = wilkinson_pvalue(pVal, r, numPvalues);
+            comb.nSigma = gsl_cdf_ugaussian_Qinv(comb.pVal);
+            ostringstream label;
+            label << "Wilkinson with r=" << r;
+            printComb(&comb, label.str().c_str());
+        }
     }
 
-    cout << endl;
-    return 0;
+    if (methods & PV_SIMES) {
+        struct pvResult comb;
+        comb.pVal   = pSimes;
+        comb.nSigma = gsl_cdf_ugaussian_Qinv(pSimes);
+        printComb(&comb, combLabel[PV_COMB_SIMES]);
+    }
+    for (size_t k=0; k<runs.size(); k++) {fclose(runs[k]);}
+    runs.clear();
 }
@@ -1,54 +1,144 @@
 #include <iostream>
-#include <sstream>
 #include <string>
 #include <iomanip>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <vector>
+#include <thread>
+#include <mutex>
 #include <math.h>
-#include <gsl/gsl_math.h>
-#include <gsl/gsl_sf_gamma.h>
-#include <gsl/gsl_cdf.h>
-#include <gsl/gsl_integration.h>
-
-double ppp_n_int(double x, void * p);
-double ppp_nru_int(double x, void * p);
-double ppp_logn_int(double x, void * p);
-double fid_p_int(double x, void * p);
-double api_pvalue(void * p);
 
 using namespace std;
 
 #include "cdflib/cdflib.hpp"
+#include "pvalue/pvalue.h"
+
+const int nMethods = PV_POI_METHODS;
+const char * const methodLabel[nMethods] = {
+    "ignoring uncertainty on Poisson mean",
+    "prior-pred., Gaussian prior",
+    "prior-pred., gamma prior",
+    "prior-pred., lognormal prior",
+    "prior-pred., Gaussian prior on rel. unc.",
+    "fiducial",
+    "plug-in",
+    "adjusted plug-in"
+};
+const char * const methodTag[nMethods] = {
+    "none", "gauss", "gamma", "lognormal", "relunc", "fiducial", "plugin", "adjplugin"
+};
+
+// Options of the p-value methods, set with -a or -z, --adaptive, -l and
+// --cache. Batch rows are handed to the library lanes at a time. The
+// accuracy set by -z holds from minSigma up: gamma_inc is set once for all
+// rows, and a smaller significance would need a tighter setting for all.
+struct pvPoissonOptions poiOptions = {0, 0, 8, NULL};
+const double minSigma = 3.0;
+
+int  interactiveMode();
+int  batchMode(FILE * in, int nThreads);
+
+// Rows still to be evaluated by one worker thread. The owner takes rows
+// from the front; an idle worker steals the back half of the largest queue.
+struct rowQueue { mutex lock; size_t begin; size_t end; };
+
+void evalRows(const vector<pvPoissonConfig> & rows, vector<pvPoissonResult> & results, int nThreads);
+void rowWorker(int id, const vector<pvPoissonConfig> * rows, vector<pvPoissonResult> * results,
+               vector<rowQueue> * queues);
+
+int main(int argc, char * argv[])
+{
+    int ret;
+    bool batch = false;
+    int nThreads = thread::hardware_concurrency();
+    const char * fileName = NULL;
+    const char * cacheName = NULL;
+
+    for (int i=1; i<argc; i++) {
+        if ((strcmp(argv[i], "-a") == 0 || strcmp(argv[i], "--accuracy") == 0) && i+1 < argc) {
+            poiOptions.gammaAcc = gamma_inc_ind(atof(argv[++i]));
+        } else if ((strcmp(argv[i], "-z") == 0 || strcmp(argv[i], "--sigma-accuracy") == 0) && i+1 < argc) {
+            poiOptions.gammaAcc = gamma_inc_ind_nsigma(atof(argv[++i]), minSigma);
+        } else if (strcmp(argv[i], "--adaptive") == 0) {
+            poiOptions.adaptive = 1;
+        } else if (strcmp(argv[i], "-b") == 0 || strcmp(argv[i], "--batch") == 0) {
+            batch = true;
+        } else if (batch && (strcmp(argv[i], "-j") == 0 || strcmp(argv[i], "--threads") == 0) && i+1 < argc) {
+            nThreads = atoi(argv[++i]);
+        } else if (batch && (strcmp(argv[i], "-l") == 0 || strcmp(argv[i], "--lanes") == 0) && i+1 < argc) {
+            poiOptions.lanes = max(1, min(16, atoi(argv[++i])));
+        } else if (batch && strcmp(argv[i], "--cache") == 0 && i+1 < argc) {
+            cacheName = argv[++i];
+        } else if (batch && fileName == NULL) {
+            fileName = argv[i];
+        } else {
+            cerr << "Usage: poissonPvalues [-a relErr | -z relErr] [--adaptive] [-b|--batch [-j nThreads] [-l lanes] [--cache file] [file]]" << endl;
+            cerr << "  -a relErr  relative error of the incomplete gamma function" << endl;
+            cerr << "  -z relErr  relative error of the number of sigmas, for significances of " << minSigma
+                 << " sigma and above; below that the error can be larger" << endl;
+            return 1;
+        }
+    }
+    if (cacheName != NULL) {
+        poiOptions.cache = pvalue_cache_open(cacheName, 1, 0);
+        if (poiOptions.cache == NULL) {
+            cerr << "poissonPvalues: cannot open cache " << cacheName << ": "
+                 << (errno == EINVAL ? "not a cache file of this version" : strerror(errno)) << endl;
+            return 1;
+        }
+    }
+    poisson_pvalues_options(&poiOptions);
+
+    if (batch) {
+        if (nThreads < 1) {nThreads = 1;}
+        FILE * in = stdin;
+        if (fileName != NULL && strcmp(fileName, "-") != 0) {
+            in = fopen(fileName, "r");
+            if (in == NULL) {
+                cerr << "poissonPvalues: cannot open " << fileName << endl;
+                return 1;
+            }
+        }
+        ret = batchMode(in, nThreads);
+        if (in != stdin) {fclose(in);}
+        if (poiOptions.cache != NULL) {
+            struct pvCacheStats cs;
+            pvalue_cache_stats(poiOptions.cache, &cs);
+            cerr << "poissonPvalues: cache hits " << cs.hits << ", misses " << cs.misses
+                 << ", results stored " << cs.inserts;
+            if (!cs.writer) {cerr << " (read-only: another process is writing the cache)";}
+            if (cs.dropped > 0) {cerr << ", " << cs.dropped << " rows not stored (cache full)";}
+            cerr << endl;
+            pvalue_cache_close(poiOptions.cache);
+        }
+    } else {
+        ret = interactiveMode();
+    }
+    return ret;
+}
 
-struct poiParams { double nObs; double poiMean; double poiUnc; double gauPoiRatio; double coeffOfVar; bool excess;};
-
-int main()
+int interactiveMode()
 {
-    const double relError = 1.0e-08;
-    const int workSize = 1000;
-    gsl_integration_workspace * workPtr = gsl_integration_workspace_alloc(workSize);
-    const int work2Size = 1000;
-    gsl_integration_cquad_workspace * work2Ptr = gsl_integration_cquad_workspace_alloc(work2Size);
-    struct poiParams par;
-    int    status, XtoPQ=1, PQtoX=2, acc=0;
-    double bound, xMean=0.0, xStD=1.0, pAdjustment, n1Obs;
+    struct pvPoissonConfig cfg;
+    struct pvPoissonResult res;
     string bline(72, '-');
 
     cout << '\n' << bline << endl;
     cout << "Number of events observed: ";
-    cin  >> par.nObs;
+    cin  >> cfg.nObs;
     cout << "Estimated Poisson mean: ";
-    cin  >> par.poiMean;
+    cin  >> cfg.poiMean;
     cout << "Uncertainty on mean: ";
-    cin  >> par.poiUnc;
+    cin  >> cfg.poiUnc;
     cout << "P-value adjustment factor: ";
-    cin  >> pAdjustment;
+    cin  >> cfg.pAdjustment;
 
-    n1Obs = par.nObs + 1;
-    par.excess = (par.nObs >= par.poiMean);
-    par.gauPoiRatio = 1.0;
-    par.coeffOfVar = par.poiUnc/par.poiMean;
+    poisson_pvalues(&cfg, 1, &res);
 
-    cout << "\nPoisson mean: " << par.poiMean << " +/- " << par.poiUnc << ", observation: " << par.nObs << ", p-value adjustment: " << pAdjustment << endl;
-    if (par.excess) {
+    cout << "\nPoisson mean: " << cfg.poiMean << " +/- " << cfg.poiUnc << ", observation: " << cfg.nObs << ", p-value adjustment: " << cfg.pAdjustment << endl;
+    if (res.excess) {
         cout << "Computing the significance of an *excess*." << endl;
     } else {
         cout << "Computing the significance of a *deficit*." << endl;
@@ -56,316 +146,180 @@ int main()
     cout << "\nP-Value      Nsigmas" << endl;
     cout << "---------------------" << endl;
 
-// First ignore uncertainty on Poisson mean when computing p-value
-    double pVal0, qVal0, nSig0;
-    if (par.excess) {
-        if(par.nObs > 0) {
-            gamma_inc( &par.nObs, &par.poiMean, &pVal0, &qVal0, &acc );
-        } else {
-            pVal0  = 1;
-        }
-    } else {
-        gamma_inc( &n1Obs, &par.poiMean, &qVal0, &pVal0, &acc );
+    int nPrint = (cfg.poiUnc != 0) ? nMethods : 1;
+    for (int k=0; k<nPrint; k++) {
+        char pStr[32];
+        pvalue_format(res.method[k].lnPval, 6, pStr, sizeof(pStr));
+        cout << setw(11) << left << pStr << "  " << setw(8) << left << res.method[k].nSigma << "  (" << methodLabel[k] << ")";
+        if (res.method[k].relErr > PV_REL_ERROR) {cout << "; RP=" << res.method[k].relErr;}
+        cout << endl;
     }
-    pVal0 *= pAdjustment;
-    qVal0 = 1.0 - pVal0;
-    cdfnor( &PQtoX, &qVal0, &pVal0, &nSig0, &xMean, &xStD, &status, &bound );
-    cout << setw(11) << left << pVal0 << "  " << setw(8) << left << nSig0 << "  (ignoring uncertainty on Poisson mean)" << endl;
 
-    if (par.poiUnc != 0) {
-
-// Try a truncated Gaussian prior for the Poisson mean
-        double pVal1, qVal1, aErr1, rErr1, nSig1;
-        if (!par.excess || (par.nObs > 0)) {
-            gsl_function Fnor;
-            Fnor.function = &ppp_n_int;
-            Fnor.params   = &par;
-            gsl_integration_qags(&Fnor, 0.0, 1.0, 0.0, relError, workSize, workPtr, &pVal1, &aErr1);
-            rErr1 = aErr1/pVal1;
-            pVal1 *= pAdjustment;
-            qVal1 = 1.0 - pVal1;
-            cdfnor( &PQtoX, &qVal1, &pVal1, &nSig1, &xMean, &xStD, &status, &bound );
-        } else {
-            pVal1 = 1.0;
-            aErr1 = 0.0;
-            rErr1 = 0.0;
-            nSig1 = -INFINITY;
-        }
-        cout << setw(11) << left << pVal1 << "  " << setw(8) << left << nSig1 << "  (prior-pred., Gaussian prior)";
-        if (rErr1 > relError) {cout << "; RP=" << rErr1;}
-        cout << endl;
+    cout << bline << '\n' << endl;
+    return 0;
+}
 
-// Try a gamma prior for the Poisson mean
-        double alpha, beta, betac;
-        double pVal2, qVal2, nSig2;
-        if (!par.excess || (par.nObs > 0)) {
-            alpha = pow(par.poiMean/par.poiUnc, 2.0);
-            betac = par.poiMean / (par.poiMean + (par.poiUnc*par.poiUnc));
-            beta  = 1.0 - betac;
-            if (par.excess) {
-                cumbet( &beta, &betac, &par.nObs, &alpha, &pVal2, &qVal2 );
-            } else {
-                cumbet( &beta, &betac, &n1Obs, &alpha, &qVal2, &pVal2 );
+int batchMode(FILE * in, int nThreads)
+{
+// Reads one observation per line: nObs, poiMean, poiUnc[, pAdjustment],
+// separated by commas, tabs or blanks. Blank lines and lines starting with
+// '#' are skipped, as is a non-numeric first line (a column header).
+// Writes one row per observation, with the p-value and number of sigmas
+// of every method as columns, using the delimiter of the input. The last
+// column is the number of gamma_inc_inv calls saved by the adjusted
+// plug-in sum. Rows are read in chunks; each chunk is evaluated by
+// nThreads workers and written out in input order.
+// With --cache, rows whose results are in the cache file are not computed
+// again, and the cache counters are written to standard error at the end.
+    const size_t chunkSize = 65536;
+    vector<pvPoissonConfig> rows;
+    vector<pvPoissonResult> results;
+    char line[1024];
+    char delim = 0;
+    bool header = false;
+    bool eof = false;
+    bool firstLine = true;
+    int nBad = 0;
+    long lineNum = 0;
+
+    rows.reserve(chunkSize);
+
+    while (!eof) {
+        rows.clear();
+        while (rows.size() < chunkSize) {
+            if (fgets(line, sizeof(line), in) == NULL) {
+                eof = true;
+                break;
             }
-            pVal2 *= pAdjustment;
-            qVal2 = 1.0 - pVal2;
-            cdfnor( &PQtoX, &qVal2, &pVal2, &nSig2, &xMean, &xStD, &status, &bound );
-        } else {
-            pVal2 = 1.0;
-            nSig2 = -INFINITY;
-        }
-        cout << setw(11) << left << pVal2 << "  " << setw(8) << left << nSig2 << "  (prior-pred., gamma prior)" << endl;
-
-// Try a lognormal prior for the Poisson mean
-        double pVal3, qVal3, aErr3, rErr3, nSig3;
-        if (!par.excess || par.nObs > 0) {
-            gsl_function Flognor;
-            Flognor.function = &ppp_logn_int;
-            Flognor.params = &par;
-            gsl_integration_qags(&Flognor, 0.0, 1.0, 0.0, relError, workSize, workPtr, &pVal3, &aErr3);
-            rErr3 = aErr3/pVal3;
-            pVal3 *= pAdjustment;
-            qVal3 = 1.0 - pVal3;
-            cdfnor( &PQtoX, &qVal3, &pVal3, &nSig3, &xMean, &xStD, &status, &bound );
-        } else {
-            pVal3 = 1.0;
-            aErr3 = 0.0;
-            rErr3 = 0.0;
-            nSig3 = -INFINITY;
+            lineNum++;
+            char * c = line;
+            while (*c == ' ' || *c == '\t') {c++;}
+            if (*c == '\0' || *c == '\n' || *c == '\r' || *c == '#') {continue;}
+
+            double val[4] = {0.0, 0.0, 0.0, 1.0};
+            int nVal = 0;
+            char * end;
+            while (nVal < 4) {
+                double v = strtod(c, &end);
+                if (end == c) {break;}
+                val[nVal++] = v;
+                c = end;
+                while (*c == ' ' || *c == '\t' || *c == ',' || *c == ';') {
+                    if (delim == 0 && (*c == ',' || *c == '\t' || *c == ';')) {delim = *c;}
+                    c++;
+                }
+            }
+            if (nVal < 3) {
+                if (!firstLine) {
+                    cerr << "poissonPvalues: cannot parse line " << lineNum << endl;
+                    nBad++;
+                }
+                firstLine = false;
+                continue;
+            }
+            firstLine = false;
+            struct pvPoissonConfig row = {val[0], val[1], val[2], val[3]};
+            rows.push_back(row);
         }
-        cout << setw(11) << left << pVal3 << "  " << setw(8) << left << nSig3 << "  (prior-pred., lognormal prior)";
-        if (rErr3 > relError) {cout << "; RP=" << rErr3;}
-        cout << endl;
+        if (rows.empty()) {continue;}
+        if (delim == 0) {delim = ',';}
 
-// Try a truncated Gaussian prior with *relative uncertainty* for the Poisson mean
-        double pVal4, qVal4, aErr4, rErr4, nSig4;
-        unsigned long nEvals;
-        if (!par.excess || par.nObs > 0) {
-            gsl_function Fnor_relunc;
-            Fnor_relunc.function = &ppp_nru_int;
-            Fnor_relunc.params = &par;
-            gsl_integration_cquad (&Fnor_relunc, 0.0, 1.0, 0.0, relError, work2Ptr, &pVal4, &aErr4, &nEvals);
-            rErr4 = aErr4/pVal4;
-            pVal4 *= pAdjustment;
-            qVal4 = 1.0 - pVal4;
-            cdfnor( &PQtoX, &qVal4, &pVal4, &nSig4, &xMean, &xStD, &status, &bound );
-        } else {
-            pVal4 = 1.0;
-            aErr4 = 0.0;
-            rErr4 = 0.0;
-            nSig4 = -INFINITY;
-        }
-        cout << setw(11) << left << pVal4 << "  " << setw(8) << left << nSig4 << "  (prior-pred., Gaussian prior on rel. unc.)";
-        if (rErr4 > relError) {cout << "; RP=" << rErr4;}
-        cout << endl;
+        results.resize(rows.size());
+        evalRows(rows, results, nThreads);
 
-// Try a fiducial p-value
-        double pVal5, qVal5, aErr5, rErr5, nSig5;
-        if (par.nObs > 0) {
-            gsl_function Ffid;
-            Ffid.function = &fid_p_int;
-            Ffid.params = &par;
-            gsl_integration_qags(&Ffid, 0.0, 1.0, 0.0, relError, workSize, workPtr, &pVal5, &aErr5);
-            rErr5 = aErr5/pVal5;
-            if (!par.excess) {pVal5 = 1 - pVal5;}
-        } else {
-            double uLim5 = par.poiMean/par.poiUnc;
-            cdfnor( &XtoPQ, &qVal5, &pVal5, &uLim5, &xMean, &xStD, &status, &bound );
+        if (!header) {
+            printf("nObs%cpoiMean%cpoiUnc%cpAdjustment", delim, delim, delim);
+            for (int k=0; k<nMethods; k++) {
+                printf("%cp_%s%cz_%s", delim, methodTag[k], delim, methodTag[k]);
+            }
+            printf("%capi_saved\n", delim);
+            header = true;
         }
-        pVal5 *= pAdjustment;
-        qVal5 = 1.0 - pVal5;
-        cdfnor( &PQtoX, &qVal5, &pVal5, &nSig5, &xMean, &xStD, &status, &bound );
-        cout << setw(11) << left << pVal5 << "  " << setw(8) << left << nSig5 << "  (fiducial)";
-        if (rErr5 > relError) {cout << "; RP=" << rErr5;}
-        cout << endl;
-
-// Try a plug-in p-value
-        double pVal6, qVal6, nSig6;
-        double dnu2 = pow(par.poiUnc, 2);
-        double tmp = 0.5 * (par.poiMean - dnu2);
-        double nuEst = tmp + sqrt(pow(tmp,2) + par.nObs*dnu2);
-        if (par.excess) {
-            if(par.nObs > 0) {
-                gamma_inc( &par.nObs, &nuEst, &pVal6, &qVal6, &acc );
-            } else {
-                pVal6 = 1;
+        for (size_t i=0; i<rows.size(); i++) {
+            const struct pvPoissonConfig & row = rows[i];
+            printf("%.10g%c%.10g%c%.10g%c%.10g", row.nObs, delim, row.poiMean, delim, row.poiUnc, delim, row.pAdjustment);
+            for (int k=0; k<nMethods; k++) {
+                char pStr[32];
+                pvalue_format(results[i].method[k].lnPval, 10, pStr, sizeof(pStr));
+                printf("%c%s%c%.10g", delim, pStr, delim, results[i].method[k].nSigma);
             }
-        } else {
-            gamma_inc( &n1Obs, &nuEst, &qVal6, &pVal6, &acc );
+            printf("%c%ld\n", delim, results[i].apiSaved);
         }
-        pVal6 *= pAdjustment;
-        qVal6 = 1.0 - pVal6;
-        cdfnor( &PQtoX, &qVal6, &pVal6, &nSig6, &xMean, &xStD, &status, &bound );
-        cout << setw(11) << left << pVal6 << "  " << setw(8) << left << nSig6 << "  (plug-in)" << endl;
-
-// Try an adjusted plug-in p-value
-        double pVal7, qVal7, nSig7;
-        pVal7 = api_pvalue(&par);
-        pVal7 *= pAdjustment;
-        qVal7 = 1.0 - pVal7;
-        cdfnor( &PQtoX, &qVal7, &pVal7, &nSig7, &xMean, &xStD, &status, &bound );
-        cout << setw(11) << left << pVal7 << "  " << setw(8) << left << nSig7 << "  (adjusted plug-in)" << endl;
-
     }
 
-    cout << bline << '\n' << endl;
-    gsl_integration_workspace_free(workPtr);
-    gsl_integration_cquad_workspace_free(work2Ptr);
-    return 0;
+    fflush(stdout);
+    return (nBad > 0) ? 1 : 0;
 }
 
-double ppp_n_int(double x, void * p) {
-// Integrand of the prior-predictive p-value with truncated normal prior
-    struct poiParams * params = (struct poiParams *)p;
-    double nObs    = (params->nObs);
-    double poiMean = (params->poiMean);
-    double poiUnc  = (params->poiUnc);
-    bool   excess  = (params->excess);
-
-    int    XtoPQ=1, status;
-    double cval, y, tmp1, tmp2, tmp3, qval, bound, uLim, mean=0.0, sd=1.0;
-
-    cval = max(1.0, nObs);
-    y    = cval * (1.0-x)/x;
-    uLim = poiMean / poiUnc;
-    cdfnor( &XtoPQ, &tmp3, &qval, &uLim, &mean, &sd, &status, &bound );
-    uLim = (poiMean-y)/poiUnc;
-    cdfnor( &XtoPQ, &tmp2, &qval, &uLim, &mean, &sd, &status, &bound );
-    if (excess) {
-        tmp1 = (nObs-1)*log(y) - y - gsl_sf_lngamma(nObs);
-    } else {
-        tmp1 = nObs*log(y) - y - gsl_sf_lngamma(nObs+1);
-        tmp2 = tmp3 - tmp2;
+void evalRows(const vector<pvPoissonConfig> & rows, vector<pvPoissonResult> & results, int nThreads)
+{
+// Evaluates all rows with nThreads worker threads. Each worker starts
+// with an equal contiguous share of the rows and steals from the others
+// once its own share is done, since the cost of a row varies a lot.
+    size_t nRows = rows.size();
+    if (nThreads > (int) nRows) {nThreads = nRows;}
+
+    vector<rowQueue> queues(nThreads);
+    for (int t=0; t<nThreads; t++) {
+        queues[t].begin = (nRows * t) / nThreads;
+        queues[t].end   = (nRows * (t+1)) / nThreads;
     }
-
-    return (tmp2/tmp3)*exp(tmp1)*cval/pow(x,2);
-}
-
-double ppp_nru_int(double x, void * p) {
-// Integrand of the prior-predictive p-value with truncated normal prior
-// for the *relative uncertainty* on the Poisson mean. This version
-// should be integrated from 0 to 1.
-    struct poiParams * params = (struct poiParams *)p;
-    double nObs        = (params->nObs);
-    double poiMean     = (params->poiMean);
-    double gauPoiRatio = (params->gauPoiRatio);
-    double coeffOfVar  = (params->coeffOfVar);
-    bool   excess      = (params->excess);
-
-    double cval = max(1.0, nObs);
-    double y    = cval * (1.0-x)/x;
-
-    int    XtoPQ=1, status;
-    double tmp1, tmp2, tmp3, tmp4, qval, bound, ulim, mean, sd;
-    mean  = 0.0;
-    sd    = 1.0;
-    ulim  = 1.0/coeffOfVar;
-    cdfnor( &XtoPQ, &tmp3, &qval, &ulim, &mean, &sd, &status, &bound );
-    ulim  = (gauPoiRatio*y-poiMean)/(gauPoiRatio*y*coeffOfVar);
-    cdfnor( &XtoPQ, &tmp4, &qval, &ulim, &mean, &sd, &status, &bound );
-    if (excess) {
-        tmp1 = (nObs-1)*log(y) - y - gsl_sf_lngamma(nObs);
-        tmp2 = tmp3 - tmp4;
-    } else {
-        tmp1 = nObs*log(y) - y - gsl_sf_lngamma(nObs+1);
-        tmp2 = tmp4;
+    if (nThreads == 1) {
+        rowWorker(0, &rows, &results, &queues);
+        return;
     }
 
-    return (tmp2/tmp3)*exp(tmp1)*cval/pow(x,2);
-}
-
-double ppp_logn_int(double x, void * p) {
-// Integrand of the prior-predictive p-value with lognormal prior
-    struct poiParams * params = (struct poiParams *)p;
-    double nObs    = (params->nObs);
-    double poiMean = (params->poiMean);
-    double poiUnc  = (params->poiUnc);
-    bool excess    = (params->excess);
-
-    double relUnc2 = pow(poiUnc/poiMean, 2);
-    double nu0     = poiMean/sqrt(1+relUnc2);
-    double tau     = sqrt(log(1+relUnc2));
-    double cval    = max(1.0, nObs);
-    double y       = cval * (1.0-x)/x;
-    double tmp1, tmp2;
-    if (excess) {
-        tmp1       = (nObs-1)*log(y) - y - gsl_sf_lngamma(nObs);
-        tmp2       = gsl_cdf_ugaussian_P(-log(y/nu0)/tau);
-    } else {
-        tmp1       = nObs*log(y) - y - gsl_sf_lngamma(nObs+1);
-        tmp2       = gsl_cdf_ugaussian_P(log(y/nu0)/tau);
+    vector<thread> workers;
+    for (int t=0; t<nThreads; t++) {
+        workers.push_back(thread(rowWorker, t, &rows, &results, &queues));
     }
-
-    return tmp2*exp(tmp1)*cval/pow(x,2);
-}
-
-double fid_p_int(double x, void * p) {
-// Integrand of the fiducial p-value
-    struct poiParams * params = (struct poiParams *)p;
-    double nObs    = (params->nObs);
-    double poiMean = (params->poiMean);
-    double poiUnc  = (params->poiUnc);
-
-    double cval    = max(1.0, nObs);
-    double y       = cval * (1.0-x)/x;
-    double tmp1    = (nObs-1)*log(y) - y - gsl_sf_lngamma(nObs);
-    double tmp2    = gsl_cdf_ugaussian_P((poiMean-y)/poiUnc);
-
-    return tmp2*exp(tmp1)*cval/pow(x,2);
+    for (int t=0; t<nThreads; t++) {workers[t].join();}
 }
 
-double api_pvalue(void * p) {
-// Adjusted plug-in p-value
-    struct poiParams * params = (struct poiParams *)p;
-    double nObs    = (params->nObs);
-    double poiMean = (params->poiMean);
-    double poiUnc  = (params->poiUnc);
-    bool excess    = (params->excess);
-
-    const double epsi=1.0e-08;
-    int ierror, acc=0;
-    double pupi, qupi, xtld, tmp1, tmp2;
-    double dnu2  = pow(poiUnc, 2);
-    double tmp   = 0.5 * (poiMean - dnu2);
-    double nuEst = tmp + sqrt(pow(tmp,2) + nObs*dnu2);
-    double x0 = 0;
-    double sum = 0;
-    if (excess)
-    {
-        if (nObs > 0) {
-            gamma_inc( &nObs, &nuEst, &pupi, &qupi, &acc );
-            for (double nVal = 1, term = 1; (nVal <= 2*nuEst) || (term > epsi*sum); nVal++)
-            {
-                gamma_inc_inv( &nVal, &xtld, &x0, &pupi, &qupi, &ierror );
-                if (ierror < 0) {
-                    cout << "Error from gamma_inc_inv: " << ierror << endl;
+void rowWorker(int id, const vector<pvPoissonConfig> * rows, vector<pvPoissonResult> * results,
+               vector<rowQueue> * queues)
+{
+// Evaluates rows from the worker's own queue, lanes at a time, then
+// steals. A worker returns when no other queue has more than one row left.
+    rowQueue & own = (*queues)[id];
+    int nQueues = queues->size();
+    size_t lanes = poiOptions.lanes;
+
+    for (;;) {
+        size_t i, end;
+        {
+            lock_guard<mutex> guard(own.lock);
+            i   = own.begin;
+            end = own.end;
+            if (i < end) {own.begin = min(end, i + lanes);}
+        }
+        if (i >= end) {
+            int victim = -1;
+            size_t most = 1;
+            for (int t=0; t<nQueues; t++) {
+                rowQueue & q = (*queues)[t];
+                lock_guard<mutex> guard(q.lock);
+                size_t left = (q.end > q.begin) ? q.end - q.begin : 0;
+                if (t != id && left > most) {
+                    most = left;
+                    victim = t;
                 }
-                xtld = xtld + (1-nVal/xtld)*dnu2;
-                tmp1 = -nuEst + nVal*log(nuEst) - gsl_sf_lngamma(nVal+1);
-                tmp2 = gsl_cdf_ugaussian_P((xtld-nuEst)/poiUnc);
-                term = tmp2 * exp(tmp1);
-                sum += term;
             }
-        } else {
-            sum = 1;
-        }
-    } else {
-        double aVal=nObs+1;
-        gamma_inc( &aVal, &nuEst, &qupi, &pupi, &acc );
-        for (double nVal = 0, term = 1; (nVal <= 2*nuEst) || (term > epsi*sum); nVal++)
-        {
-            aVal = nVal + 1;
-            gamma_inc_inv ( &aVal, &xtld, &x0, &qupi, &pupi, &ierror );
-            if (ierror < 0) {
-                cout << "Error from gamma_inc_inv: " << ierror << endl;
+            if (victim < 0) {return;}
+            rowQueue & q = (*queues)[victim];
+            size_t stolenBegin, stolenEnd;
+            {
+                lock_guard<mutex> guard(q.lock);
+                if (q.end <= q.begin + 1) {continue;}
+                stolenEnd   = q.end;
+                stolenBegin = q.begin + (q.end - q.begin) / 2;
+                q.end = stolenBegin;
             }
-            xtld = xtld + (1-nVal/xtld)*dnu2;
-            tmp1 = -nuEst + nVal*log(nuEst) - gsl_sf_lngamma(aVal);
-            tmp2 = gsl_cdf_ugaussian_P((nuEst-xtld)/poiUnc);
-            term = tmp2 * exp(tmp1);
-            sum += term;
+            lock_guard<mutex> guard(own.lock);
+            own.begin = stolenBegin;
+            own.end   = stolenEnd;
+            continue;
         }
+        poisson_pvalues(&(*rows)[i], min(end - i, lanes), &(*results)[i]);
     }
-
-    return sum;
 }
@@ -0,0 +1,143 @@
+#include <math.h>
+#include <gsl/gsl_cdf.h>
+#include <gsl/gsl_math.h>
+
+using namespace std;
+
+#include "../cdflib/cdflib.hpp"
+#include "pvalue.h"
+
+static const double nDegF2 = PV_COMB_NDEGF2;
+
+static void kahanAdd(double * sum, double * comp, double x);
+static void setComb(struct pvResult * r, double pComb);
+
+void combine_pvalues(const double * p, size_t n, int methods, struct pvCombResult * res)
+{
+// Combinations of the n p-values p. Simes's method assumes they are sorted
+// in increasing order.
+    struct pvCombSums cs;
+    combine_init(&cs, methods);
+    for (size_t i=0; i<n; i++) {
+        combine_add(&cs, p[i]);
+    }
+    combine_sums(&cs, res);
+
+// Simes's method: the smallest of p(i)*n/i over all ranks i. The first
+// version of pValueCombination left out i = n, the largest p-value, and
+// gave 1 instead of 0.6 for the p-values 0.5 and 0.6.
+    if (methods & PV_SIMES) {
+        double pSimes = INFINITY;
+        for (size_t i=0; i<n; i++) {
+            double scaled = p[i]*(n/(i+1.0));
+            if (scaled < pSimes) {pSimes = scaled;}
+        }
+        setComb(&res->method[PV_COMB_SIMES], pSimes);
+    }
+}
+
+double wilkinson_pvalue(double pVal, double r, double n)
+{
+// Wilkinson's combination from pVal, the r-th smallest of n p-values
+    return gsl_cdf_beta_P(pVal, r, n-r+1);
+}
+
+static void kahanAdd(double * sum, double * comp, double x)
+{
+// Adds x to sum, carrying the rounding error in comp. A p-value of 0 or 1
+// makes some sums infinite; the compensation is dropped then.
+    double y = x - *comp;
+    double t = *sum + y;
+    *comp = isfinite(t) ? (t - *sum) - y : 0.0;
+    *sum = t;
+}
+
+void combine_init(struct pvCombSums * cs, int methods)
+{
+    cs->methods = methods;
+    cs->n = 0;
+    cs->sumLog   = cs->cLog   = 0;
+    cs->sumChi2  = cs->cChi2  = 0;
+    cs->sumZ     = cs->cZ     = 0;
+    cs->sumLogit = cs->cLogit = 0;
+    cs->sumP     = cs->cP     = 0;
+    cs->minP = INFINITY;
+}
+
+void combine_add(struct pvCombSums * cs, double p)
+{
+    int methods = cs->methods;
+    cs->n += 1;
+    if (methods & PV_FISHER)    {kahanAdd(&cs->sumLog, &cs->cLog, log(p));}
+    if (methods & PV_FISHER2)   {kahanAdd(&cs->sumChi2, &cs->cChi2, gsl_cdf_chisq_Qinv(p, nDegF2));}
+    if (methods & PV_STOUFFER)  {kahanAdd(&cs->sumZ, &cs->cZ, gsl_cdf_ugaussian_Qinv(p));}
+    if (methods & PV_LOGIT)     {kahanAdd(&cs->sumLogit, &cs->cLogit, -log(p/(1-p)));}
+    if (methods & PV_EDGINGTON) {kahanAdd(&cs->sumP, &cs->cP, p);}
+    if (p < cs->minP) {cs->minP = p;}
+}
+
+static void setComb(struct pvResult * r, double pComb)
+{
+    r->pVal   = pComb;
+    r->lnPval = log(pComb);
+    r->nSigma = gsl_cdf_ugaussian_Qinv(pComb);
+    r->relErr = 0.0;
+    r->nEvals = 0;
+}
+
+void combine_sums(const struct pvCombSums * cs, struct pvCombResult * res)
+{
+// Combinations of the sum-based methods selected in cs; the other methods
+// are set to NaN
+    int methods = cs->methods;
+    double numPvalues = cs->n;
+    struct pvResult * r = res->method;
+
+    res->n = numPvalues;
+    for (int k=0; k<PV_COMB_METHODS; k++) {
+        r[k].pVal = r[k].lnPval = r[k].nSigma = NAN;
+        r[k].relErr = 0.0;
+        r[k].nEvals = 0;
+    }
+
+// Fisher's method
+    if (methods & PV_FISHER) {
+        double tStat1 = -2 * cs->sumLog;
+        double nu = 2*numPvalues;
+        setComb(&r[PV_COMB_FISHER], gsl_cdf_chisq_Q(tStat1, nu));
+    }
+
+// Fisher's method with chisquare distributions with different numbers of degrees of freedom
+    if (methods & PV_FISHER2) {
+        setComb(&r[PV_COMB_FISHER2], gsl_cdf_chisq_Q(cs->sumChi2, nDegF2*numPvalues));
+    }
+
+// Tippett's method
+    if (methods & PV_TIPPETT) {
+        double aval = 1.0;
+        setComb(&r[PV_COMB_TIPPETT], gsl_cdf_beta_P(cs->minP, aval, numPvalues));
+    }
+
+// Stouffer's method
+    if (methods & PV_STOUFFER) {
+        double tStat4 = cs->sumZ / sqrt(numPvalues);
+        setComb(&r[PV_COMB_STOUFFER], gsl_cdf_ugaussian_Q(tStat4));
+    }
+
+// Logit combination
+    if (methods & PV_LOGIT) {
+        double nDegF5 = 5*numPvalues + 4;
+        double tStat5 = cs->sumLogit / (M_PI * sqrt( numPvalues * (nDegF5-2) / (3*nDegF5) ));
+        setComb(&r[PV_COMB_LOGIT], gsl_cdf_tdist_Q(tStat5, nDegF5));
+    }
+
+// Edgington's method: the sum of n uniform p-values has the Irwin-Hall
+// distribution, whose CDF cdflib evaluates without cancellation
+    if (methods & PV_EDGINGTON) {
+        double pValueSum = cs->sumP;
+        int nPvalues = (int) numPvalues;
+        double pComb7, qComb7;
+        irwin_hall_cdf(&pValueSum, &nPvalues, &pComb7, &qComb7);
+        setComb(&r[PV_COMB_EDGINGTON], pComb7);
+    }
+}
@@ -0,0 +1,38 @@
+#include <math.h>
+
+using namespace std;
+
+#include "../cdflib/cdf.hpp"
+#include "pvalue.h"
+
+void gaussian_pvalues(const struct pvGaussianConfig * cfg, size_t n, struct pvGaussianResult * res)
+{
+// P-values of n Gaussian observations, computed as logs so that
+// significances beyond the range of double p-values still come out right
+    for (size_t i=0; i<n; i++) {
+        double Obs     = cfg[i].obs;
+        double gauMean = cfg[i].gauMean;
+        double gauStD  = sqrt(cfg[i].gauVar);
+        double uncMean = cfg[i].uncMean;
+        bool   excess  = Obs >= gauMean;
+        struct pvResult * r = res[i].method;
+        res[i].excess = excess;
+
+// First ignore uncertainty on Gaussian mean when computing p-value
+        double zVal0 = (Obs-gauMean)/gauStD;
+        r[0].lnPval = (excess) ? cdf::normal_logsf(zVal0) : cdf::normal_logcdf(zVal0);
+
+// Try a Gaussian prior for the Gaussian mean
+        double combStD = sqrt( pow(uncMean,2) + pow(gauStD,2) );
+        double zVal1 = (Obs-gauMean)/combStD;
+        r[1].lnPval = (excess) ? cdf::normal_logsf(zVal1) : cdf::normal_logcdf(zVal1);
+
+        for (int k=0; k<PV_GAU_METHODS; k++) {
+            r[k].lnPval += log(cfg[i].pAdjustment);
+            r[k].pVal    = exp(r[k].lnPval);
+            r[k].nSigma  = pvalue_nsigma(r[k].lnPval);
+            r[k].relErr  = 0.0;
+            r[k].nEvals  = 0;
+        }
+    }
+}
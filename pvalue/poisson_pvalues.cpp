@@ -0,0 +1,1180 @@
+#include <iostream>
+#include <mutex>
+#include <atomic>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_sf_gamma.h>
+#include <gsl/gsl_integration.h>
+
+using namespace std;
+
+#include "../cdflib/cdf.hpp"
+#include "pvalue.h"
+#include "pvalue_cache.h"
+
+// Everything but the functions of pvalue.h is private to this file
+namespace {
+
+struct poiParams { double nObs; double poiMean; double poiUnc; double gauPoiRatio; double coeffOfVar; bool excess;};
+double api_pvalue(void * p);
+double api_lnpvalue_fast(void * p, long * nSaved, long * nTerms);
+
+// Constants of the prior-predictive and fiducial integrands that depend only
+// on the observation, computed once per p-value instead of once per
+// integrand evaluation
+struct poiIntParams {
+    struct poiParams * par;
+    double cval;        // max(1, nObs), scale of the change of variable y = cval*(1-x)/x
+    double nPow;        // power of y in the Poisson term: nObs-1 for an excess, nObs for a deficit
+    double lnNorm;      // log of the Poisson normalization: lngamma(nPow+1)
+    double lnGamObs;    // lngamma(nObs), for the fiducial integrand
+    double lnNormGau;   // log Phi(poiMean/poiUnc), normalization of the truncated Gaussian prior
+    double lnNormRelUnc;// log Phi(1/coeffOfVar), same for the prior on the relative uncertainty
+    double lnQnormGau;  // logs of 1-Phi at the same points, for differences of upper tails
+    double lnQnormRelUnc;
+    double nu0;         // median of the lognormal prior
+    double lnNu0;       // and its log
+    double tau;         // log-scale width of the lognormal prior
+};
+void poiIntSetup(struct poiParams * par, struct poiIntParams * ipar);
+
+// Integrand kernels of the prior-predictive and fiducial methods, one class
+// per prior, with the direction of the test (excess or deficit) as a
+// template parameter. The constructor takes the constants of one integral
+// from poiIntParams, so that evaluating the integrand is straight-line code
+// around one call of the log normal CDF. Each kernel gives the log of its
+// integrand as a density in t = log(y), y being the Poisson mean, in three
+// parts: base(), the log of everything but the prior factor; arg(), the
+// argument u of that factor; and tail(), the log of the factor from
+// log Phi(u) and log(1-Phi(u)). nPow and mean give the peaks of the Poisson
+// and prior factors, from which poiQuad starts its search for the peak.
+struct poiKernel {
+    double nPow;        // power of y in the Poisson factor
+    double lnNorm;      // log of the normalization of the integrand
+    double mean;        // Poisson mean
+    double base(double t, double y) const {return (nPow + 1.0)*t - y - lnNorm;}
+};
+
+// Truncated Gaussian prior on the Poisson mean. A deficit integrates the
+// upper tail of the prior beyond y, less the part beyond the truncation.
+template <bool excess>
+struct gaussKernel : poiKernel {
+    double unc, lnQnorm;
+    gaussKernel() {}
+    gaussKernel(const struct poiIntParams * ip) {
+        nPow    = ip->nPow;
+        lnNorm  = ip->lnNorm + ip->lnNormGau;
+        mean    = ip->par->poiMean;
+        unc     = ip->par->poiUnc;
+        lnQnorm = ip->lnQnormGau;
+    }
+    double arg(double, double y) const {return (mean - y)/unc;}
+    double tail(double lp, double lq) const {return excess ? lp : lq + log(-expm1(lnQnorm - lq));}
+};
+
+// Truncated Gaussian prior on the relative uncertainty of the Poisson mean
+template <bool excess>
+struct relUncKernel : poiKernel {
+    double ratio, coeffOfVar, lnQnorm;
+    relUncKernel() {}
+    relUncKernel(const struct poiIntParams * ip) {
+        nPow       = ip->nPow;
+        lnNorm     = ip->lnNorm + ip->lnNormRelUnc;
+        mean       = ip->par->poiMean;
+        ratio      = ip->par->gauPoiRatio;
+        coeffOfVar = ip->par->coeffOfVar;
+        lnQnorm    = ip->lnQnormRelUnc;
+    }
+    double arg(double, double y) const {return (ratio*y - mean)/(ratio*y*coeffOfVar);}
+    double tail(double lp, double lq) const {return excess ? lq + log(-expm1(lnQnorm - lq)) : lp;}
+};
+
+// Lognormal prior on the Poisson mean
+template <bool excess>
+struct lognKernel : poiKernel {
+    double lnNu0, tau;
+    lognKernel() {}
+    lognKernel(const struct poiIntParams * ip) {
+        nPow   = ip->nPow;
+        lnNorm = ip->lnNorm;
+        mean   = ip->par->poiMean;
+        lnNu0  = ip->lnNu0;
+        tau    = ip->tau;
+    }
+    double arg(double t, double) const {return excess ? (lnNu0 - t)/tau : (t - lnNu0)/tau;}
+    double tail(double lp, double) const {return lp;}
+};
+
+// Fiducial p-value. For a deficit the upper normal tail is integrated,
+// which gives the p-value itself instead of its complement.
+template <bool excess>
+struct fidKernel : poiKernel {
+    double unc;
+    fidKernel() {}
+    fidKernel(const struct poiIntParams * ip) {
+        nPow   = ip->par->nObs - 1.0;
+        lnNorm = ip->lnGamObs;
+        mean   = ip->par->poiMean;
+        unc    = ip->par->poiUnc;
+    }
+    double arg(double, double y) const {return (mean - y)/unc;}
+    double tail(double lp, double lq) const {return excess ? lp : lq;}
+};
+
+// Evaluation of a kernel at one point, at n points each with its own kernel
+// (the normal CDFs then go through cumnor_log_batch in SIMD lanes; n is at
+// most poiMaxVec), and on (0,1) for the GSL routines, with y = cval*(1-x)/x
+// and the integrand divided by its peak value exp(lnScale) at xPeak.
+const int poiMaxLanes = 16;
+const int poiNodeBlock = 4;
+const int poiMaxVec = poiMaxLanes*poiNodeBlock;
+template <class K> double lnDensity(const K & kern, double t);
+template <class K> void lnDensityVec(const double * t, const K * const * kern, int n, double * g);
+template <class K> struct poiGslParams { K kern; double cval; double lnScale; double xPeak; long nEvals; };
+template <class K> double lnUnitInt(double x, struct poiGslParams<K> * gp);
+template <class K> double unitInt(double x, void * p);
+template <class K> double lnIntScale(struct poiGslParams<K> * gp);
+
+// The dedicated quadrature rule in t for m <= poiMaxLanes observations, and
+// the same with the kernels made from their poiIntParams
+template <class K> void poiQuad(const K * kern, int m, double * lnInt, double * rErr, bool * ok, long * nEvals);
+typedef void poiQuadLanes(struct poiIntParams * const * ipar, int m, double * lnInt, double * rErr, bool * ok,
+                          long * nEvals);
+template <class K>
+void poiQuadKernels(struct poiIntParams * const * ipar, int m, double * lnInt, double * rErr, bool * ok,
+                    long * nEvals);
+
+// Table of log(n!) for integer n, shared by all threads and extended on
+// demand in blocks. A block never moves once allocated, so entries below
+// the published size are read without locking.
+const long lnFactBlockSize = 4096;
+const long lnFactMaxBlocks = 1024;
+struct lnFactTable {
+    atomic<long> size;
+    mutex lock;
+    double * block[lnFactMaxBlocks];
+};
+lnFactTable lnFactCache;
+double lnFactorial(double n);
+
+// Options of the call in progress, from poisson_pvalues_options
+struct poiOptions { int gammaAcc; bool adaptive; int lanes; struct pvCache * cache; };
+
+// Integration workspaces of a thread, allocated on its first p-value and
+// reused for every observation after that, and the options of its call
+struct poiWork {
+    struct poiOptions opt;
+    gsl_integration_workspace * workPtr;
+    size_t workSize;
+    gsl_integration_cquad_workspace * work2Ptr;
+    poiWork();
+    ~poiWork();
+};
+thread_local poiWork poiThreadWork;
+
+const int nMethods = PV_POI_METHODS;
+
+// Logs of the integrals of the prior-predictive and fiducial methods, their
+// relative errors and numbers of evaluations, done ahead for a block of
+// observations; lnI is NaN where an integral was not done or poiQuad failed
+// on it, and nEvals then counts the evaluations of the failed attempt
+struct poiIntegrals { double lnI[nMethods]; double rErr[nMethods]; long nEvals[nMethods]; };
+
+// poiQuad for the methods that are integrated numerically, for a deficit
+// and for an excess
+poiQuadLanes * const methodQuad[nMethods][2] = {
+    {NULL, NULL},
+    {poiQuadKernels< gaussKernel<false> >,  poiQuadKernels< gaussKernel<true> >},
+    {NULL, NULL},
+    {poiQuadKernels< lognKernel<false> >,   poiQuadKernels< lognKernel<true> >},
+    {poiQuadKernels< relUncKernel<false> >, poiQuadKernels< relUncKernel<true> >},
+    {poiQuadKernels< fidKernel<false> >,    poiQuadKernels< fidKernel<true> >},
+    {NULL, NULL},
+    {NULL, NULL}
+};
+
+const double relError = PV_REL_ERROR;
+
+// Options set by poisson_pvalues_options: the accuracy request (IND) of
+// gamma_inc, applied to the thread for the duration of each call;
+// integrate with the GSL adaptive routines instead of poiQuad, which they
+// otherwise only back up; the number of observations integrated together
+// by poiQuad (1 integrates each observation on its own); and the result
+// cache. Each call of poisson_pvalues works with a copy taken at its start.
+atomic<int> optGammaAcc(0);
+atomic<bool> optAdaptive(false);
+atomic<int> optLanes(8);
+atomic<struct pvCache *> optCache(NULL);
+
+void poiOptionsLoad(struct poiOptions * opt);
+void poiPvalues(struct poiParams * par, const struct poiIntParams * ipar, double pAdjustment, struct poiWork * work,
+                struct pvPoissonResult * res, const struct poiIntegrals * pre);
+void poiPvaluesBlock(struct poiParams * par, const double * pAdjustment, int m, struct poiWork * work,
+                     struct pvPoissonResult * res);
+void poiPvaluesCached(const struct pvPoissonConfig * cfg, size_t n, struct poiWork * work,
+                      struct pvPoissonResult * res);
+template <class K>
+double poiIntegrate(const struct poiIntegrals * pre, int k, bool cquad, const struct poiIntParams * ipar,
+                    struct poiWork * work, double * rErr, long * nEvals);
+
+}
+
+void poisson_pvalues_options(const struct pvPoissonOptions * opt)
+{
+    optGammaAcc = opt->gammaAcc;
+    optAdaptive = (opt->adaptive != 0);
+    optLanes    = max(1, min(poiMaxLanes, opt->lanes));
+    optCache    = opt->cache;
+}
+
+void poisson_pvalues(const struct pvPoissonConfig * cfg, size_t n, struct pvPoissonResult * res)
+{
+// P-values of n observations, lanes at a time. The accuracy of gamma_inc
+// is set for the thread and put back at the end.
+    struct poiParams par[poiMaxLanes];
+    double pAdjustment[poiMaxLanes];
+    struct poiWork * work = &poiThreadWork;
+    int accSaved = gamma_inc_accuracy();
+
+    poiOptionsLoad(&work->opt);
+    gamma_inc_set_accuracy(work->opt.gammaAcc);
+    if (work->opt.cache != NULL) {
+        poiPvaluesCached(cfg, n, work, res);
+    } else {
+        int lanes = work->opt.lanes;
+        for (size_t i=0; i<n; i+=lanes) {
+            int m = min(n - i, (size_t) lanes);
+            for (int j=0; j<m; j++) {
+                par[j].nObs    = cfg[i+j].nObs;
+                par[j].poiMean = cfg[i+j].poiMean;
+                par[j].poiUnc  = cfg[i+j].poiUnc;
+                pAdjustment[j] = cfg[i+j].pAdjustment;
+            }
+            poiPvaluesBlock(par, pAdjustment, m, work, &res[i]);
+        }
+    }
+    gamma_inc_set_accuracy(accSaved);
+}
+
+double poisson_api_lnpvalue(double nObs, double poiMean, double poiUnc, int direct)
+{
+// Log of the adjusted plug-in p-value of one observation, by the sum of
+// poisson_pvalues or, if direct, by api_pvalue
+    struct poiParams par;
+    long nSaved, nTerms;
+    double lnPval;
+    int accSaved = gamma_inc_accuracy();
+
+    par.nObs    = nObs;
+    par.poiMean = poiMean;
+    par.poiUnc  = poiUnc;
+    par.excess  = (nObs >= poiMean);
+    gamma_inc_set_accuracy(optGammaAcc);
+    if (direct) {
+        lnPval = log(api_pvalue(&par));
+    } else {
+        lnPval = api_lnpvalue_fast(&par, &nSaved, &nTerms);
+    }
+    gamma_inc_set_accuracy(accSaved);
+    return lnPval;
+}
+
+namespace {
+
+void poiOptionsLoad(struct poiOptions * opt)
+{
+    opt->gammaAcc = optGammaAcc;
+    opt->adaptive = optAdaptive;
+    opt->lanes    = optLanes;
+    opt->cache    = optCache;
+}
+
+void poiPvaluesCached(const struct pvPoissonConfig * cfg, size_t n, struct poiWork * work,
+                      struct pvPoissonResult * res)
+{
+// poisson_pvalues through the result cache. Observations found in the
+// cache are copied from it; the others are computed lanes at a time
+// without adjustment and stored. The cache is keyed on the options that
+// change the results: the accuracy of gamma_inc, adaptive, and the SIMD
+// level of cumnor_log_batch, whose vector code can differ from the scalar
+// one in the last bits. The number of lanes only groups the observations,
+// and gives the same bits. The adjustment factors are applied at the end,
+// which gives the same bits as computing them with the factors.
+    struct poiParams par[poiMaxLanes];
+    struct pvPoissonResult blockRes[poiMaxLanes];
+    double noAdjustment[poiMaxLanes];
+    size_t idx[poiMaxLanes];
+    struct pvCache * cache = work->opt.cache;
+    int    lanes = work->opt.lanes;
+    int    opts = work->opt.gammaAcc | (work->opt.adaptive ? 1 << 8 : 0) | simd_level() << 9;
+    int    m = 0;
+
+    for (int j=0; j<lanes; j++) {noAdjustment[j] = 1.0;}
+    for (size_t i=0; i<=n; i++) {
+        if (i < n && !pvalue_cache_get(cache, &cfg[i], opts, &res[i])) {
+            par[m].nObs    = cfg[i].nObs;
+            par[m].poiMean = cfg[i].poiMean;
+            par[m].poiUnc  = cfg[i].poiUnc;
+            idx[m++] = i;
+        }
+        if (m == lanes || (i == n && m > 0)) {
+            poiPvaluesBlock(par, noAdjustment, m, work, blockRes);
+            for (int j=0; j<m; j++) {
+                pvalue_cache_put(cache, &cfg[idx[j]], opts, &blockRes[j]);
+                res[idx[j]] = blockRes[j];
+            }
+            m = 0;
+        }
+    }
+
+    for (size_t i=0; i<n; i++) {
+        double lnAdjust = log(cfg[i].pAdjustment);
+        int nDone = (cfg[i].poiUnc != 0) ? nMethods : 1;
+        for (int k=0; k<nDone; k++) {
+            struct pvResult * r = &res[i].method[k];
+            r->lnPval += lnAdjust;
+            r->pVal    = exp(r->lnPval);
+            r->nSigma  = pvalue_nsigma(r->lnPval);
+        }
+    }
+}
+
+poiWork::poiWork() {
+    workSize = 1000;
+    workPtr  = gsl_integration_workspace_alloc(workSize);
+    const int work2Size = 1000;
+    work2Ptr = gsl_integration_cquad_workspace_alloc(work2Size);
+}
+
+poiWork::~poiWork() {
+    gsl_integration_workspace_free(workPtr);
+    gsl_integration_cquad_workspace_free(work2Ptr);
+}
+
+void poiPvaluesBlock(struct poiParams * par, const double * pAdjustment, int m, struct poiWork * work,
+                     struct pvPoissonResult * res)
+{
+// Computes the p-values of m <= poiMaxLanes observations. For each method
+// that needs a numerical integral, poiQuad first integrates all the
+// observations together, evaluating each node of its rule for all of them
+// in one call of the integrand; poiPvalues then does the rest, including
+// the integrals on which poiQuad failed.
+    struct poiIntParams ipar[poiMaxLanes], * ip[poiMaxLanes];
+    struct poiIntegrals pre[poiMaxLanes];
+    double lnI[poiMaxLanes], rErr[poiMaxLanes];
+    long   nEvals[poiMaxLanes];
+    bool   ok[poiMaxLanes];
+    int    lane[poiMaxLanes];
+
+    for (int j=0; j<m; j++) {
+        poiIntSetup(&par[j], &ipar[j]);
+        for (int k=0; k<nMethods; k++) {
+            pre[j].lnI[k]    = NAN;
+            pre[j].rErr[k]   = 0.0;
+            pre[j].nEvals[k] = 0;
+        }
+    }
+
+// The same conditions as in poiPvalues. Excesses and deficits have
+// different kernels, and are integrated separately.
+    for (int k=0; k<nMethods && !work->opt.adaptive && m > 1; k++) {
+        if (methodQuad[k][0] == NULL) {continue;}
+        for (int excess=0; excess<2; excess++) {
+            int n = 0;
+            for (int j=0; j<m; j++) {
+                bool need = (k == PV_POI_FIDUCIAL) ? (par[j].nObs > 0) : (!par[j].excess || par[j].nObs > 0);
+                if (par[j].poiUnc != 0 && par[j].excess == (excess == 1) && need) {
+                    ip[n] = &ipar[j];
+                    lane[n++] = j;
+                }
+            }
+            if (n == 0) {continue;}
+            methodQuad[k][excess](ip, n, lnI, rErr, ok, nEvals);
+            for (int i=0; i<n; i++) {
+                pre[lane[i]].nEvals[k] = nEvals[i];
+                if (ok[i]) {
+                    pre[lane[i]].lnI[k]  = lnI[i];
+                    pre[lane[i]].rErr[k] = rErr[i];
+                }
+            }
+        }
+    }
+
+    for (int j=0; j<m; j++) {
+        poiPvalues(&par[j], &ipar[j], pAdjustment[j], work, &res[j], &pre[j]);
+    }
+}
+
+void poiPvalues(struct poiParams * par, const struct poiIntParams * ipar, double pAdjustment, struct poiWork * work,
+                struct pvPoissonResult * res, const struct poiIntegrals * pre)
+{
+// Computes the p-value and number of sigmas of every method for one
+// observation. When the uncertainty on the Poisson mean is zero, only the
+// first method is evaluated and the others are set to NaN.
+// The p-values are computed as logs, so that significances far beyond
+// the range of double p-values still come out right; the integrands are
+// divided by their peak value before integration. Integrals already in
+// pre, if not NULL, are not done again.
+    int    acc=gamma_inc_accuracy(), ierr;
+    double n1Obs, lnAdjust;
+
+    n1Obs = par->nObs + 1;
+    lnAdjust = log(pAdjustment);
+
+    struct pvResult * r = res->method;
+    res->excess   = par->excess;
+    res->apiSaved = 0;
+    for (int k=0; k<nMethods; k++) {
+        r[k].pVal   = NAN;
+        r[k].lnPval = NAN;
+        r[k].nSigma = NAN;
+        r[k].relErr = 0.0;
+        r[k].nEvals = 0;
+    }
+
+// First ignore uncertainty on Poisson mean when computing p-value
+    double lpVal0, lqVal0;
+    if (par->excess) {
+        if(par->nObs > 0) {
+            gamma_inc_log( &par->nObs, &par->poiMean, &lpVal0, &lqVal0, &acc );
+        } else {
+            lpVal0 = 0.0;
+        }
+    } else {
+        gamma_inc_log( &n1Obs, &par->poiMean, &lqVal0, &lpVal0, &acc );
+    }
+    r[0].lnPval = lpVal0 + lnAdjust;
+
+    if (par->poiUnc != 0) {
+
+// Try a truncated Gaussian prior for the Poisson mean
+    if (!par->excess || (par->nObs > 0)) {
+        r[1].lnPval = (par->excess
+            ? poiIntegrate< gaussKernel<true> >(pre, 1, false, ipar, work, &r[1].relErr, &r[1].nEvals)
+            : poiIntegrate< gaussKernel<false> >(pre, 1, false, ipar, work, &r[1].relErr, &r[1].nEvals)) + lnAdjust;
+    } else {
+        r[1].lnPval = lnAdjust;
+    }
+
+// Try a gamma prior for the Poisson mean
+    double alpha, beta, betac;
+    double lpVal2, lqVal2;
+    if (!par->excess || (par->nObs > 0)) {
+        alpha = pow(par->poiMean/par->poiUnc, 2.0);
+        betac = par->poiMean / (par->poiMean + (par->poiUnc*par->poiUnc));
+        beta  = 1.0 - betac;
+        if (par->excess) {
+            beta_inc_log( &par->nObs, &alpha, &beta, &betac, &lpVal2, &lqVal2, &ierr );
+        } else {
+            beta_inc_log( &n1Obs, &alpha, &beta, &betac, &lqVal2, &lpVal2, &ierr );
+        }
+        r[2].lnPval = lpVal2 + lnAdjust;
+    } else {
+        r[2].lnPval = lnAdjust;
+    }
+
+// Try a lognormal prior for the Poisson mean
+    if (!par->excess || par->nObs > 0) {
+        r[3].lnPval = (par->excess
+            ? poiIntegrate< lognKernel<true> >(pre, 3, false, ipar, work, &r[3].relErr, &r[3].nEvals)
+            : poiIntegrate< lognKernel<false> >(pre, 3, false, ipar, work, &r[3].relErr, &r[3].nEvals)) + lnAdjust;
+    } else {
+        r[3].lnPval = lnAdjust;
+    }
+
+// Try a truncated Gaussian prior with *relative uncertainty* for the Poisson mean
+    if (!par->excess || par->nObs > 0) {
+        r[4].lnPval = (par->excess
+            ? poiIntegrate< relUncKernel<true> >(pre, 4, true, ipar, work, &r[4].relErr, &r[4].nEvals)
+            : poiIntegrate< relUncKernel<false> >(pre, 4, true, ipar, work, &r[4].relErr, &r[4].nEvals)) + lnAdjust;
+    } else {
+        r[4].lnPval = lnAdjust;
+    }
+
+// Try a fiducial p-value
+    double lpVal5;
+    if (par->nObs > 0) {
+        lpVal5 = par->excess
+            ? poiIntegrate< fidKernel<true> >(pre, 5, false, ipar, work, &r[5].relErr, &r[5].nEvals)
+            : poiIntegrate< fidKernel<false> >(pre, 5, false, ipar, work, &r[5].relErr, &r[5].nEvals);
+    } else {
+        lpVal5 = cdf::normal_logsf(par->poiMean/par->poiUnc);
+    }
+    r[5].lnPval = lpVal5 + lnAdjust;
+
+// Try a plug-in p-value
+    double lpVal6, lqVal6;
+    double dnu2 = pow(par->poiUnc, 2);
+    double tmp = 0.5 * (par->poiMean - dnu2);
+    double nuEst = tmp + sqrt(pow(tmp,2) + par->nObs*dnu2);
+    if (par->excess) {
+        if(par->nObs > 0) {
+            gamma_inc_log( &par->nObs, &nuEst, &lpVal6, &lqVal6, &acc );
+        } else {
+            lpVal6 = 0.0;
+        }
+    } else {
+        gamma_inc_log( &n1Obs, &nuEst, &lqVal6, &lpVal6, &acc );
+    }
+    r[6].lnPval = lpVal6 + lnAdjust;
+
+// Try an adjusted plug-in p-value
+    r[7].lnPval = api_lnpvalue_fast(par, &res->apiSaved, &r[7].nEvals) + lnAdjust;
+    }
+
+    int nDone = (par->poiUnc != 0) ? nMethods : 1;
+    for (int k=0; k<nDone; k++) {
+        r[k].pVal   = exp(r[k].lnPval);
+        r[k].nSigma = pvalue_nsigma(r[k].lnPval);
+    }
+}
+
+template <class K>
+double poiIntegrate(const struct poiIntegrals * pre, int k, bool cquad, const struct poiIntParams * ipar,
+                    struct poiWork * work, double * rErr, long * nEvals)
+{
+// Log of the integral of a prior-predictive or fiducial integrand with
+// kernel K: the one for method k in pre if it is there, otherwise by
+// poiQuad. If that fails, or with --adaptive, the integrand mapped onto
+// (0,1) is divided by its peak and integrated by QAGP with the peak as a
+// breakpoint, or by CQUAD on either side of the peak. nEvals counts the
+// integrand evaluations of all the attempts.
+    double lnI, val, aErr;
+    long   nQuad;
+    bool   ok;
+    *nEvals = (pre != NULL) ? pre->nEvals[k] : 0;
+    if (pre != NULL && !isnan(pre->lnI[k])) {
+        *rErr = pre->rErr[k];
+        return pre->lnI[k];
+    }
+    struct poiGslParams<K> gp;
+    gp.kern = K(ipar);
+    if (!work->opt.adaptive) {
+        poiQuad(&gp.kern, 1, &lnI, rErr, &ok, &nQuad);
+        *nEvals += nQuad;
+        if (ok) {return lnI;}
+    }
+
+    gsl_function F;
+    F.function = &unitInt<K>;
+    F.params   = &gp;
+    gp.cval    = ipar->cval;
+    gp.nEvals  = 0;
+    gp.lnScale = lnIntScale(&gp);
+    if (cquad) {
+        double val2, aErr2;
+        size_t nCquad;
+        gsl_integration_cquad(&F, 0.0, gp.xPeak, 0.0, relError, work->work2Ptr, &val, &aErr, &nCquad);
+        gsl_integration_cquad(&F, gp.xPeak, 1.0, 0.0, relError, work->work2Ptr, &val2, &aErr2, &nCquad);
+        val  += val2;
+        aErr += aErr2;
+    } else {
+        double pts[3] = {0.0, gp.xPeak, 1.0};
+        gsl_integration_qagp(&F, pts, 3, 0.0, relError, work->workSize, work->workPtr, &val, &aErr);
+    }
+    *rErr = aErr/val;
+    *nEvals += gp.nEvals;
+    return log(val) + gp.lnScale;
+}
+
+template <class K>
+void poiQuadKernels(struct poiIntParams * const * ipar, int m, double * lnInt, double * rErr, bool * ok,
+                    long * nEvals)
+{
+// poiQuad for the observations ipar, with kernels K made from them
+    K kern[poiMaxLanes];
+    for (int j=0; j<m; j++) {kern[j] = K(ipar[j]);}
+    poiQuad(kern, m, lnInt, rErr, ok, nEvals);
+}
+
+template <class K>
+void poiQuad(const K * kern, int m, double * lnInt, double * rErr, bool * ok, long * nEvals)
+{
+// Logs of the integrals over y in (0,inf) of the integrands kern for m <=
+// poiMaxLanes observations, by the trapezoidal rule in t = log(y). Each
+// integrand is a gamma density times a prior factor, so in t it is a
+// single smooth peak whose tails fall off at least exponentially; for such
+// a function the error of the trapezoidal rule falls off exponentially in
+// 1/h, and about squares when h is halved.
+// The peak of each integrand and its width sigma = (-g'')^(-1/2) are found
+// by Newton's method on finite differences. Around it, the nodes are
+// t = tPeak + sigma*stretch*sinh(u/stretch) for u = k*h, with h = 1/2: the
+// spacing is h*sigma near the peak, and exponentially more in the tails,
+// which for a wide prior reach out to hundreds of sigma. They are added
+// outwards until the integrand drops below relError/100 of its peak. The
+// rule on the even nodes alone, of step 2h, gives the error check: while
+// the relative difference of the two sums exceeds relError, h is halved by
+// adding the midpoints. The result is then good to about the square of that
+// difference, but the difference itself is returned as the error, since a
+// prior much narrower than the gamma density (a near step in the prior
+// CDF) can keep the rule from its asymptotic regime for a few halvings.
+// The observations go through all of this in step, like the lanes of a
+// vector: every node u, and every Newton step, is evaluated for all the
+// observations that still need it in one call of lnDensityVec. ok[j] is false,
+// so that the caller can fall back on adaptive quadrature, if the peak of
+// observation j is not found or its rule does not settle; nEvals[j] is the
+// number of points at which its integrand was evaluated.
+    const int    maxNewton = 40, maxSide = 64, maxLevels = 4, block = poiNodeBlock;
+    const double stretch = 3.0, cut = 1.0e-2*relError;
+    double tt[poiMaxVec] = {0}, gg[poiMaxVec];
+    const K * kp[poiMaxVec] = {NULL};
+    double t[poiMaxLanes], tPeak[poiMaxLanes], gPeak[poiMaxLanes], step[poiMaxLanes], sigma[poiMaxLanes];
+    double h[poiMaxLanes], sumAll[poiMaxLanes], sumEven[poiMaxLanes], sumMid[poiMaxLanes], diff[poiMaxLanes];
+    int    kLo[poiMaxLanes], kHi[poiMaxLanes], state[poiMaxLanes];
+    bool   run[poiMaxLanes];
+    int    n;
+
+    if (m <= 0) {return;}
+
+// Newton's method for the peak of g(t), from the peak of the gamma factor
+// or the prior mean, whichever is higher. A step that does not climb is
+// halved. state is 0 while the peak is searched, 1 once it is found and
+// -1 on failure; tPeak and gPeak hold the highest point so far.
+    for (int j=0; j<m; j++) {
+        tt[2*j]   = log(kern[j].nPow + 1.0);
+        tt[2*j+1] = log(kern[j].mean);
+        kp[2*j] = kp[2*j+1] = &kern[j];
+        nEvals[j] = 2;
+    }
+    lnDensityVec(tt, kp, 2*m, gg);
+    for (int j=0; j<m; j++) {
+        t[j]     = (gg[2*j+1] > gg[2*j]) ? tt[2*j+1] : tt[2*j];
+        tPeak[j] = t[j];
+        gPeak[j] = -INFINITY;
+        step[j]  = 0.0;
+        sigma[j] = 1.0;
+        state[j] = 0;
+    }
+    for (int it=0; it<maxNewton; it++) {
+        n = 0;
+        for (int j=0; j<m; j++) {
+            if (state[j] != 0) {continue;}
+            double d = 1.0e-2*sigma[j];
+            tt[n] = t[j]-d; tt[n+1] = t[j]; tt[n+2] = t[j]+d;
+            kp[n] = kp[n+1] = kp[n+2] = &kern[j];
+            n += 3;
+            nEvals[j] += 3;
+        }
+        if (n == 0) {break;}
+        lnDensityVec(tt, kp, n, gg);
+        n = 0;
+        for (int j=0; j<m; j++) {
+            if (state[j] != 0) {continue;}
+            const double * g = gg + n;
+            double d = 1.0e-2*sigma[j];
+            n += 3;
+            if (!(g[1] >= gPeak[j])) {
+                step[j] *= 0.5;
+                t[j] = tPeak[j] + step[j];
+                continue;
+            }
+            double d1 = (g[2]-g[0])/(2.0*d);
+            double d2 = (g[2]-2.0*g[1]+g[0])/(d*d);
+            if (!isfinite(d1) || !isfinite(d2)) {
+                state[j] = -1;
+                continue;
+            }
+            tPeak[j] = t[j];
+            gPeak[j] = g[1];
+            if (d2 < 0) {
+                sigma[j] = 1.0/sqrt(-d2);
+                step[j]  = -d1/d2;
+            } else {
+                step[j]  = (d1 > 0) ? 1.0 : -1.0;
+            }
+            step[j] = max(-2.0, min(2.0, step[j]));
+            if (d2 < 0 && fabs(step[j]) < 1.0e-3*sigma[j]) {
+                state[j] = 1;
+                continue;
+            }
+            t[j] += step[j];
+        }
+    }
+
+// Trapezoidal rule of step h = 1/2 in u, outwards from the peak on either
+// side, block nodes at a time. sumAll holds the sum over all nodes of
+// exp(g-gPeak) dt/du, in units of sigma, and sumEven that over the even
+// ones; run marks the observations still marching outwards.
+    for (int j=0; j<m; j++) {
+        if (state[j] == 0) {state[j] = -1;}
+        h[j] = 0.5;
+        sumAll[j] = sumEven[j] = 1.0;
+        kLo[j] = kHi[j] = 0;
+    }
+    for (int side=-1; side<=1; side+=2) {
+        for (int j=0; j<m; j++) {run[j] = (state[j] == 1);}
+        for (int k=0; ; k+=block) {
+            n = 0;
+            for (int j=0; j<m; j++) {
+                if (run[j] && k >= maxSide) {run[j] = false; state[j] = -1;}
+                if (!run[j]) {continue;}
+                for (int i=0; i<block; i++) {
+                    tt[n] = tPeak[j] + sigma[j]*stretch*sinh(side*(k+i+1)*0.5/stretch);
+                    kp[n++] = &kern[j];
+                }
+                nEvals[j] += block;
+            }
+            if (n == 0) {break;}
+            lnDensityVec(tt, kp, n, gg);
+            n = 0;
+            for (int j=0; j<m; j++) {
+                if (!run[j]) {continue;}
+                double e = 0.0, ePrev = 0.0;
+                for (int i=0; i<block; i++, n++) {
+                    if (isnan(gg[n]) || gg[n] > gPeak[j] + 30.0) {state[j] = -1;}
+                    ePrev = e;
+                    e = exp(gg[n] - gPeak[j]) * cosh((k+i+1)*0.5/stretch);
+                    sumAll[j] += e;
+                    if ((k+i+1) % 2 == 0) {sumEven[j] += e;}
+                }
+                if (state[j] < 0) {
+                    run[j] = false;
+                } else if (e < cut && ePrev < cut) {
+                    run[j] = false;
+                    if (side < 0) {kLo[j] = -(k+block);} else {kHi[j] = k+block;}
+                }
+            }
+        }
+    }
+
+// Halve the step until the two rules agree. The observations still being
+// refined all have the same step, so they share the midpoints u.
+    for (int j=0; j<m; j++) {
+        diff[j] = (state[j] == 1) ? fabs(sumAll[j] - 2.0*sumEven[j])/sumAll[j] : 0.0;
+    }
+    for (int level=0; ; level++) {
+        int kMin = 0, kMax = 0;
+        bool any = false;
+        for (int j=0; j<m; j++) {
+            run[j] = (state[j] == 1 && diff[j] > relError);
+            if (run[j] && level == maxLevels) {run[j] = false; state[j] = -1;}
+            if (!run[j]) {continue;}
+            any  = true;
+            kMin = min(kMin, kLo[j]);
+            kMax = max(kMax, kHi[j]);
+            sumMid[j] = 0.0;
+        }
+        if (!any) {break;}
+        double hl = ldexp(0.5, -level);
+        for (int k=kMin; k<kMax; k+=block) {
+            n = 0;
+            for (int j=0; j<m; j++) {
+                if (!run[j]) {continue;}
+                for (int i=max(k, kLo[j]); i<min(k+block, kHi[j]); i++) {
+                    tt[n] = tPeak[j] + sigma[j]*stretch*sinh((i+0.5)*hl/stretch);
+                    kp[n++] = &kern[j];
+                    nEvals[j]++;
+                }
+            }
+            if (n == 0) {continue;}
+            lnDensityVec(tt, kp, n, gg);
+            n = 0;
+            for (int j=0; j<m; j++) {
+                if (!run[j]) {continue;}
+                for (int i=max(k, kLo[j]); i<min(k+block, kHi[j]); i++, n++) {
+                    if (isnan(gg[n]) || gg[n] > gPeak[j] + 30.0) {state[j] = -1;}
+                    sumMid[j] += exp(gg[n] - gPeak[j]) * cosh((i+0.5)*hl/stretch);
+                }
+            }
+        }
+        for (int j=0; j<m; j++) {
+            if (!run[j]) {continue;}
+            diff[j]    = fabs(sumMid[j] - sumAll[j])/(sumAll[j] + sumMid[j]);
+            sumAll[j] += sumMid[j];
+            h[j]      *= 0.5;
+            kLo[j]    *= 2;
+            kHi[j]    *= 2;
+        }
+    }
+
+    for (int j=0; j<m; j++) {
+        ok[j]    = (state[j] == 1);
+        lnInt[j] = gPeak[j] + log(h[j]*sigma[j]*sumAll[j]);
+        rErr[j]  = diff[j];
+    }
+}
+
+void poiIntSetup(struct poiParams * par, struct poiIntParams * ipar) {
+// Completes par with the direction of the test and the relative
+// uncertainty, and sets up the integrand constants
+    par->excess = (par->nObs >= par->poiMean);
+    par->gauPoiRatio = 1.0;
+    par->coeffOfVar = par->poiUnc/par->poiMean;
+
+    double uLim;
+    double nObs    = par->nObs;
+    double poiMean = par->poiMean;
+    double poiUnc  = par->poiUnc;
+
+    ipar->par  = par;
+    ipar->cval = max(1.0, nObs);
+    if (par->excess) {
+        ipar->nPow   = nObs-1;
+        ipar->lnNorm = (nObs > 0) ? lnFactorial(nObs-1) : 0.0;
+    } else {
+        ipar->nPow   = nObs;
+        ipar->lnNorm = lnFactorial(nObs);
+    }
+    ipar->lnGamObs = (nObs > 0) ? lnFactorial(nObs-1) : 0.0;
+
+    if (poiUnc == 0) {return;}
+    uLim = poiMean / poiUnc;
+    ipar->lnNormGau  = cdf::normal_logcdf(uLim);
+    ipar->lnQnormGau = cdf::normal_logsf(uLim);
+    uLim = 1.0/par->coeffOfVar;
+    ipar->lnNormRelUnc  = cdf::normal_logcdf(uLim);
+    ipar->lnQnormRelUnc = cdf::normal_logsf(uLim);
+    double relUnc2 = pow(poiUnc/poiMean, 2);
+    ipar->nu0 = poiMean/sqrt(1+relUnc2);
+    ipar->lnNu0 = log(ipar->nu0);
+    ipar->tau = sqrt(log(1+relUnc2));
+}
+
+double lnFactorial(double n) {
+// log(n!), from the shared table for integer n and from lngamma otherwise
+    long k = (long) n;
+    if (n < 0 || n != (double) k || k >= lnFactBlockSize*lnFactMaxBlocks) {
+        return gsl_sf_lngamma(n+1);
+    }
+    if (k >= lnFactCache.size.load(memory_order_acquire)) {
+        lock_guard<mutex> guard(lnFactCache.lock);
+        long size = lnFactCache.size.load(memory_order_relaxed);
+        while (size <= k) {
+            double * block = new double[lnFactBlockSize];
+            for (long i=0; i<lnFactBlockSize; i++) {
+                block[i] = gsl_sf_lngamma(size+i+1);
+            }
+            lnFactCache.block[size/lnFactBlockSize] = block;
+            size += lnFactBlockSize;
+            lnFactCache.size.store(size, memory_order_release);
+        }
+    }
+    return lnFactCache.block[k/lnFactBlockSize][k%lnFactBlockSize];
+}
+
+template <class K>
+double lnDensity(const K & kern, double t) {
+// Log of the integrand of kernel K as a density in t = log(y)
+    double y = exp(t);
+    double u = kern.arg(t, y), lp, lq;
+    cumnor_log(&u, &lp, &lq);
+    return kern.base(t, y) + kern.tail(lp, lq);
+}
+
+template <class K>
+void lnDensityVec(const double * t, const K * const * kern, int n, double * g) {
+// The same at n points with their own kernels
+    double u[poiMaxVec] = {0}, lp[poiMaxVec], lq[poiMaxVec];
+    if (n <= 0) {return;}
+    for (int i=0; i<n; i++) {
+        double y = exp(t[i]);
+        u[i] = kern[i]->arg(t[i], y);
+        g[i] = kern[i]->base(t[i], y);
+    }
+    cumnor_log_batch(u, n, lp, lq);
+    for (int i=0; i<n; i++) {g[i] += kern[i]->tail(lp[i], lq[i]);}
+}
+
+template <class K>
+double lnUnitInt(double x, struct poiGslParams<K> * gp) {
+// The same on (0,1), with y = cval*(1-x)/x, so that dy = cval/x^2 dx and
+// dt = dy/y; counted in gp->nEvals
+    double y = gp->cval * (1.0-x)/x;
+    gp->nEvals++;
+    return lnDensity(gp->kern, log(y)) - log(y) + log(gp->cval) - 2.0*log(x);
+}
+
+template <class K>
+double unitInt(double x, void * p) {
+// The integrand on (0,1) for GSL, divided by its peak value
+    struct poiGslParams<K> * gp = (struct poiGslParams<K> *)p;
+    return exp(lnUnitInt(x, gp) - gp->lnScale);
+}
+
+template <class K>
+double lnIntScale(struct poiGslParams<K> * gp) {
+// Log of the peak value of an integrand on (0,1), located on a coarse grid
+// and refined by golden-section search. Dividing the integrand by this
+// value keeps it within range of a double however small the p-value is,
+// and the peak, which can be much narrower than the grid spacing, is
+// stored in gp->xPeak as a breakpoint for the integration. Returns 0
+// (and a peak at 0.5) when the integrand is nowhere finite.
+    const int    nGrid = 32;
+    const double gold  = 0.5*(sqrt(5.0)-1.0);
+    double fBest = -INFINITY;
+    int    iBest = -1;
+    for (int i=0; i<nGrid; i++) {
+        double f = lnUnitInt((i+0.5)/nGrid, gp);
+        if (f > fBest) {fBest = f; iBest = i;}
+    }
+    gp->xPeak = 0.5;
+    if (iBest < 0 || !isfinite(fBest)) {return 0.0;}
+
+    double a = max(iBest-0.5, 0.0)/nGrid;
+    double b = min(iBest+1.5, (double) nGrid)/nGrid;
+    double c = b - gold*(b-a), d = a + gold*(b-a);
+    double fc = lnUnitInt(c, gp), fd = lnUnitInt(d, gp);
+    for (int it=0; it<40; it++) {
+        if (fc > fd) {
+            b = d; d = c; fd = fc;
+            c = b - gold*(b-a); fc = lnUnitInt(c, gp);
+        } else {
+            a = c; c = d; fc = fd;
+            d = a + gold*(b-a); fd = lnUnitInt(d, gp);
+        }
+    }
+    gp->xPeak = (iBest+0.5)/nGrid;
+    if (fc > fBest) {fBest = fc; gp->xPeak = c;}
+    if (fd > fBest) {fBest = fd; gp->xPeak = d;}
+    return fBest;
+}
+
+double apiPolish(double a, double x, double p, double q) {
+// One Halley step on P(a,x) = p, or on Q(a,x) = q when q is the smaller,
+// from a solution x of gamma_inc_inv. Its solutions can be off by a few
+// units in the tenth digit, which is as much as a sum of thousands of
+// terms can turn into a relative error of 1e-9 on the p-value.
+    int acc = gamma_inc_accuracy();
+    double pa, qa;
+    gamma_inc( &a, &x, &pa, &qa, &acc );
+    double f = (p <= q) ? pa - p : q - qa;
+    double r = f*exp(x - (a-1.0)*log(x) + lnFactorial(a-1.0));
+    double s = r/(1.0 - 0.5*r*((a-1.0)/x - 1.0));
+    return isfinite(s) ? x - s : x;
+}
+
+double api_pvalue(void * p) {
+// Adjusted plug-in p-value
+    struct poiParams * params = (struct poiParams *)p;
+    double nObs    = (params->nObs);
+    double poiMean = (params->poiMean);
+    double poiUnc  = (params->poiUnc);
+    bool excess    = (params->excess);
+
+    const double epsi=1.0e-08;
+    int ierror, acc=gamma_inc_accuracy();
+    double pupi, qupi, xtld, tmp1, tmp2;
+    double dnu2  = pow(poiUnc, 2);
+    double tmp   = 0.5 * (poiMean - dnu2);
+    double nuEst = tmp + sqrt(pow(tmp,2) + nObs*dnu2);
+    double x0 = 0;
+    double sum = 0;
+    if (excess)
+    {
+        if (nObs > 0) {
+            gamma_inc( &nObs, &nuEst, &pupi, &qupi, &acc );
+            for (double nVal = 1, term = 1; (nVal <= 2*nuEst) || (term > epsi*sum); nVal++)
+            {
+                gamma_inc_inv( &nVal, &xtld, &x0, &pupi, &qupi, &ierror );
+                if (ierror < 0) {
+                    cerr << "Error from gamma_inc_inv: " << ierror << endl;
+                } else {
+                    xtld = apiPolish(nVal, xtld, pupi, qupi);
+                }
+                xtld = xtld + (1-nVal/xtld)*dnu2;
+                tmp1 = -nuEst + nVal*log(nuEst) - lnFactorial(nVal);
+                tmp2 = cdf::normal_cdf((xtld-nuEst)/poiUnc);
+                term = tmp2 * exp(tmp1);
+                sum += term;
+            }
+        } else {
+            sum = 1;
+        }
+    } else {
+        double aVal=nObs+1;
+        gamma_inc( &aVal, &nuEst, &qupi, &pupi, &acc );
+        for (double nVal = 0, term = 1; (nVal <= 2*nuEst) || (term > epsi*sum); nVal++)
+        {
+            aVal = nVal + 1;
+            gamma_inc_inv ( &aVal, &xtld, &x0, &qupi, &pupi, &ierror );
+            if (ierror < 0) {
+                cerr << "Error from gamma_inc_inv: " << ierror << endl;
+            } else {
+                xtld = apiPolish(aVal, xtld, qupi, pupi);
+            }
+            xtld = xtld + (1-nVal/xtld)*dnu2;
+            tmp1 = -nuEst + nVal*log(nuEst) - lnFactorial(nVal);
+            tmp2 = cdf::normal_cdf((nuEst-xtld)/poiUnc);
+            term = tmp2 * exp(tmp1);
+            sum += term;
+        }
+    }
+
+    return sum;
+}
+
+double lnAddExp(double a, double b) {
+// log(exp(a) + exp(b)) without overflow or underflow
+    if (a < b) {swap(a, b);}
+    if (b == -INFINITY) {return a;}
+    return a + log1p(exp(b - a));
+}
+
+// Constants of the adjusted plug-in sum of one observation. Every term
+// solves P(a,x) = pTarget for x, with a = nVal for an excess and nVal+1
+// for a deficit; qTarget = 1-pTarget. When either of them is below
+// apiTinyTail, their logs are used instead.
+struct apiParams {
+    bool   excess;
+    double nuEst, poiUnc, dnu2;
+    double pTarget, qTarget;
+    double lnpTarget, lnqTarget;
+};
+const double apiTinyTail = 1.0e-250;
+
+double apiInverseLog(double a, double lnp, double lnq) {
+// Solution x of log P(a,x) = lnp, or of log Q(a,x) = lnq when that tail is
+// the smaller, by Newton's method on the log of the small tail. Where the
+// lower tail is small, P(a,x) is about x^a/a!, and the step is taken in
+// log(x), in which log P is nearly linear; where the upper tail is small,
+// log Q is convex in x, and Newton's method climbs to the root from x = a.
+    const int maxIter = 100;
+    int acc = gamma_inc_accuracy();
+    double x, lP, lQ, step;
+    if (lnp <= lnq) {
+        double y = (lnp + lnFactorial(a))/a;
+        for (int it=0; it<maxIter; it++) {
+            x = exp(y);
+            gamma_inc_log( &a, &x, &lP, &lQ, &acc );
+            step = (lP - lnp)/exp(a*y - x - lnFactorial(a-1.0) - lP);
+            if (!isfinite(step)) {break;}
+            y -= step;
+            if (fabs(step) < 1.0e-15*max(1.0, fabs(y))) {break;}
+        }
+        return exp(y);
+    }
+    x = a;
+    for (int it=0; it<maxIter; it++) {
+        gamma_inc_log( &a, &x, &lP, &lQ, &acc );
+        step = (lQ - lnq)/exp((a-1.0)*log(x) - x - lnFactorial(a-1.0) - lQ);
+        if (!isfinite(step)) {break;}
+        x += step;
+        if (fabs(step) < 1.0e-15*x) {break;}
+    }
+    return x;
+}
+
+double api_term(const struct apiParams * ap, double nVal, double x0, double * xRaw, double * lnWeight) {
+// Log of term nVal of the adjusted plug-in sum, with the inverse incomplete
+// gamma started from x0 (cold start if x0 <= 0). Returns the log of the
+// term, the unadjusted inverse in xRaw and the log of the Poisson weight
+// in lnWeight.
+    int ierror = 0;
+    double aVal = ap->excess ? nVal : nVal+1;
+    double xtld, u, lp, lq;
+
+    if (ap->pTarget < apiTinyTail || ap->qTarget < apiTinyTail) {
+        *xRaw = apiInverseLog(aVal, ap->lnpTarget, ap->lnqTarget);
+    } else {
+        double pt = ap->pTarget, qt = ap->qTarget;
+        gamma_inc_inv( &aVal, xRaw, &x0, &pt, &qt, &ierror );
+        if (ierror >= 0) {
+            *xRaw = apiPolish(aVal, *xRaw, ap->pTarget, ap->qTarget);
+        }
+    }
+    if (ierror < 0 && x0 > 0) {
+        return api_term(ap, nVal, 0.0, xRaw, lnWeight);
+    }
+    if (ierror < 0) {
+        cerr << "Error from gamma_inc_inv: " << ierror << endl;
+    }
+    xtld = *xRaw + (1-nVal/ *xRaw)*ap->dnu2;
+    u = (xtld-ap->nuEst)/ap->poiUnc;
+    cumnor_log(&u, &lp, &lq);
+    *lnWeight = -ap->nuEst + nVal*log(ap->nuEst) - lnFactorial(nVal);
+    return *lnWeight + (ap->excess ? lp : lq);
+}
+
+double api_lnpvalue_fast(void * p, long * nSaved, long * nTerms) {
+// Log of the adjusted plug-in p-value, as api_pvalue but summed in logs,
+// so that it does not underflow far in the tail, and outwards from the
+// mode of the Poisson weights. Each inverse incomplete gamma is started
+// from the solution for the neighbouring term, which moves by about one
+// per step; when the tail probability that the inverses solve for is
+// below apiTinyTail, they are found from its log instead. A side of the
+// sum is stopped once a geometric bound on its remaining Poisson weight
+// (the other factor of a term is at most one) drops below tailEps*sum; the
+// upper side also stops where api_pvalue does. These tests are made on
+// differences of logs, since far in the tail the log of the sum can be so
+// large (1e21 and more) that adding log(tailEps) to it leaves it
+// unchanged. Both sums polish each inverse with a Halley step, and the
+// result agrees with api_pvalue to about 4e-13 relative.
+// nSaved is set to the number of gamma_inc_inv calls avoided, and nTerms
+// to the number made (0 when api_pvalue does the sum).
+    struct poiParams * params = (struct poiParams *)p;
+    double nObs    = (params->nObs);
+    double poiMean = (params->poiMean);
+    double poiUnc  = (params->poiUnc);
+    bool excess    = (params->excess);
+
+    const double lnEpsi = log(1.0e-08), lnTailEps = log(1.0e-13);
+    int acc=gamma_inc_accuracy();
+    double xRaw, xMode, lnWeight, lnwPrev, lnTerm, r;
+    double dnu2  = pow(poiUnc, 2);
+    double tmp   = 0.5 * (poiMean - dnu2);
+    double nuEst = tmp + sqrt(pow(tmp,2) + nObs*dnu2);
+    double aVal  = excess ? nObs : nObs+1;
+
+    *nSaved = 0;
+    *nTerms = 0;
+    if (excess && nObs <= 0) {return 0.0;}
+    if (!(nuEst > 0)) {return log(api_pvalue(p));}
+    struct apiParams ap;
+    ap.excess = excess;
+    ap.nuEst  = nuEst;
+    ap.poiUnc = poiUnc;
+    ap.dnu2   = dnu2;
+    gamma_inc( &aVal, &nuEst, &ap.pTarget, &ap.qTarget, &acc );
+    ap.lnpTarget = log(ap.pTarget);
+    ap.lnqTarget = log(ap.qTarget);
+    if (ap.pTarget < apiTinyTail || ap.qTarget < apiTinyTail) {
+        gamma_inc_log( &aVal, &nuEst, &ap.lnpTarget, &ap.lnqTarget, &acc );
+    }
+
+    double nMin  = excess ? 1 : 0;
+    double nMode = max(nMin, floor(nuEst));
+    long   nCalls = 1;
+    double lnSum = api_term(&ap, nMode, 0.0, &xMode, &lnWeight);
+    double lnwMode = lnWeight, lntMode = lnSum;
+
+// Downward from the mode: weight(n-1)/weight(n) = n/nuEst, decreasing
+    xRaw = xMode;
+    for (double nVal = nMode-1; nVal >= nMin; nVal--) {
+        lnSum = lnAddExp(lnSum, api_term(&ap, nVal, xRaw-1, &xRaw, &lnWeight));
+        nCalls++;
+        r = nVal/nuEst;
+        if (r < 1 && lnWeight - lnSum + log(r/(1-r)) <= lnTailEps) {break;}
+    }
+
+// Upward from the mode: weight(n)/weight(n-1) = nuEst/n, decreasing. Far
+// in the tail the inverses of the first terms underflow to 0, and these
+// terms are -infinity; the sum goes on until it has a finite term.
+    xRaw    = xMode;
+    lnwPrev = lnwMode;
+    lnTerm  = lntMode;
+    double nVal = nMode+1;
+    bool tailStop = false;
+    for (; ; nVal++) {
+        if (nVal > 2*nuEst && lnSum > -INFINITY && lnTerm - lnSum <= lnEpsi) {break;}
+        r = nuEst/(nVal+1);
+        if (r < 1 && lnwPrev - lnSum + log((nuEst/nVal)/(1-r)) <= lnTailEps) {
+            tailStop = true;
+            break;
+        }
+        lnTerm = api_term(&ap, nVal, xRaw+1, &xRaw, &lnWeight);
+        nCalls++;
+        lnSum = lnAddExp(lnSum, lnTerm);
+        lnwPrev = lnWeight;
+    }
+
+// Last term of api_pvalue's sum: it runs at least to 2*nuEst, and beyond
+// only while its last term exceeds epsi*sum.
+    double nLast = max(nVal-1, max(nMin, floor(2*nuEst)));
+    if (tailStop && nVal > 2*nuEst) {nLast = nVal;}
+    *nSaved = (long)(nLast - nMin + 1) - nCalls;
+    *nTerms = nCalls;
+
+    return lnSum;
+}
+
+}
@@ -0,0 +1,147 @@
+#ifndef PVALUE_H
+#define PVALUE_H
+
+// libpvalue: the p-value methods of poissonPvalues, gaussianPvalues and
+// pValueCombination as functions, for C and C++ callers. Every function
+// takes n queries and fills n results in buffers owned by the caller, and
+// does not allocate per call; a calling thread only allocates its
+// integration workspaces on its first Poisson query. The functions may be
+// called from several threads at once.
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Relative accuracy requested from the numerical integrals
+#define PV_REL_ERROR 1.0e-08
+
+// Result of one method for one query. The p-value is also given as a log,
+// which stays finite far beyond the range of double p-values. relErr is
+// the estimated relative error of a numerical integral, and nEvals the
+// number of evaluations of its integrand (of terms for the adjusted
+// plug-in sum); both are 0 for methods in closed form. Methods that were
+// not evaluated are NaN.
+struct pvResult { double pVal; double lnPval; double nSigma; double relErr; long nEvals; };
+
+// Number of standard normal sigmas corresponding to the log of a one-sided
+// p-value; p >= 1 maps to -infinity and p = 0 to +infinity
+double pvalue_nsigma(double lnPval);
+
+// Writes into buf (of len characters) the p-value of log lnPval with the
+// given number of significant digits, with the exponent written out below
+// the range of doubles, e.g. 1.18e-1779
+void pvalue_format(double lnPval, int digits, char * buf, size_t len);
+
+// Poisson observation nObs with mean poiMean +/- poiUnc. When poiUnc is 0
+// only PV_POI_NONE is evaluated.
+enum {
+    PV_POI_NONE,        // ignoring uncertainty on Poisson mean
+    PV_POI_GAUSS,       // prior-predictive, Gaussian prior
+    PV_POI_GAMMA,       // prior-predictive, gamma prior
+    PV_POI_LOGNORMAL,   // prior-predictive, lognormal prior
+    PV_POI_RELUNC,      // prior-predictive, Gaussian prior on relative uncertainty
+    PV_POI_FIDUCIAL,    // fiducial
+    PV_POI_PLUGIN,      // plug-in
+    PV_POI_ADJPLUGIN,   // adjusted plug-in
+    PV_POI_METHODS
+};
+struct pvPoissonConfig { double nObs; double poiMean; double poiUnc; double pAdjustment; };
+struct pvPoissonResult {
+    struct pvResult method[PV_POI_METHODS];
+    int  excess;        // 1 for the significance of an excess, 0 for a deficit
+    long apiSaved;      // gamma_inc_inv calls saved by the adjusted plug-in sum
+};
+
+// Options of the Poisson methods, shared by all threads; set them before
+// computing p-values. gammaAcc is the accuracy request (IND) of gamma_inc,
+// adaptive integrates with the GSL adaptive routines only, lanes is the
+// number of observations integrated together (1 to 16), and cache, if not
+// NULL, is a result cache opened by pvalue_cache_open.
+struct pvCache;
+struct pvPoissonOptions { int gammaAcc; int adaptive; int lanes; struct pvCache * cache; };
+void poisson_pvalues_options(const struct pvPoissonOptions * opt);
+void poisson_pvalues(const struct pvPoissonConfig * cfg, size_t n, struct pvPoissonResult * res);
+
+// Log of the adjusted plug-in p-value of one observation, without
+// adjustment: the sum of poisson_pvalues, outwards from the mode of the
+// Poisson weights with warm-started inverses, or, if direct, the sum term
+// by term from the first, as in the original program
+double poisson_api_lnpvalue(double nObs, double poiMean, double poiUnc, int direct);
+
+// Persistent cache of Poisson results, in a file mapped into memory. It
+// holds the result of each method, without the adjustment factor, keyed on
+// the exact bits of nObs, poiMean and poiUnc, on gammaAcc and adaptive, and
+// on the SIMD level of the processor (simd_level of cdflib), which can
+// change the last bits of the integrals; lanes does not change them.
+// Any number of processes can read a cache file while one of them, the
+// holder of its lock, adds to it; a writable cache opened while another
+// process holds the lock is read-only. One handle can be shared by all the
+// threads of a process. The table does not grow: results that do not fit
+// are dropped, until pvalue_cache_compact rewrites the file with the most
+// recently used observations or with more slots. pvalue_cache_open and
+// pvalue_cache_compact set errno when they fail; compact does not create a
+// missing file.
+struct pvCacheStats {
+    long hits, misses;          // observations found or not through this handle
+    long inserts;               // results stored
+    long dropped;               // observations not stored because the table was full
+    long totalHits, totalMisses, totalInserts;  // of the writers that closed the file
+    long slots, entries;
+    int  writer;                // 1 if this handle stores results
+};
+struct pvCache * pvalue_cache_open(const char * path, int writable, size_t nSlots);
+void pvalue_cache_close(struct pvCache * cache);
+void pvalue_cache_stats(const struct pvCache * cache, struct pvCacheStats * stats);
+long pvalue_cache_compact(const char * path, size_t keep, size_t nSlots);
+
+// Gaussian observation obs, of variance gauVar, with mean gauMean +/- uncMean
+enum {
+    PV_GAU_NONE,        // ignoring uncertainty on Gaussian mean
+    PV_GAU_GAUSS,       // prior-predictive, Gaussian prior
+    PV_GAU_METHODS
+};
+struct pvGaussianConfig { double obs; double gauMean; double gauVar; double uncMean; double pAdjustment; };
+struct pvGaussianResult { struct pvResult method[PV_GAU_METHODS]; int excess; };
+void gaussian_pvalues(const struct pvGaussianConfig * cfg, size_t n, struct pvGaussianResult * res);
+
+// Combinations of independent p-values, selected by the flags in methods.
+// Simes and Wilkinson need the p-values in increasing order, which
+// combine_pvalues does not sort them into; Wilkinson gives one combination
+// per rank r, by wilkinson_pvalue.
+enum {
+    PV_FISHER = 1, PV_FISHER2 = 2, PV_TIPPETT = 4, PV_STOUFFER = 8, PV_LOGIT = 16,
+    PV_SIMES = 32, PV_EDGINGTON = 64, PV_WILKINSON = 128
+};
+enum {
+    PV_COMB_FISHER, PV_COMB_FISHER2, PV_COMB_TIPPETT, PV_COMB_STOUFFER, PV_COMB_LOGIT,
+    PV_COMB_SIMES, PV_COMB_EDGINGTON, PV_COMB_METHODS
+};
+#define PV_COMB_NDEGF2 100
+struct pvCombResult { struct pvResult method[PV_COMB_METHODS]; double n; };
+void combine_pvalues(const double * p, size_t n, int methods, struct pvCombResult * res);
+double wilkinson_pvalue(double pVal, double r, double n);
+
+// Running sums of the combination methods that need only one pass over the
+// p-values, for inputs that do not fit in memory. Sums are compensated
+// (Kahan), so that they stay accurate over very long inputs.
+struct pvCombSums {
+    int    methods;             // methods to accumulate
+    double n;
+    double sumLog,   cLog;      // Fisher: sum of log(p)
+    double sumChi2,  cChi2;     // Fisher with PV_COMB_NDEGF2 degrees of freedom per p-value
+    double sumZ,     cZ;        // Stouffer: sum of Qinv(p)
+    double sumLogit, cLogit;    // logit: sum of log(p/(1-p))
+    double sumP,     cP;        // Edgington: sum of p
+    double minP;                // Tippett: smallest p
+};
+void combine_init(struct pvCombSums * cs, int methods);
+void combine_add(struct pvCombSums * cs, double p);
+void combine_sums(const struct pvCombSums * cs, struct pvCombResult * res);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
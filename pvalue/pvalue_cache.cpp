@@ -0,0 +1,406 @@
+#include <string>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <algorithm>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <stdio.h>
+#include <math.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/file.h>
+
+using namespace std;
+
+#include "pvalue.h"
+#include "pvalue_cache.h"
+
+namespace {
+
+// A cache file is a header followed by a power of two of slots, each
+// holding the result of one method for one (nObs, poiMean, poiUnc) and one
+// set of options, found by linear probing from the hash of its key. Only
+// the process holding the lock on the file writes it, and a slot is filled
+// once and never moved or cleared: its tag is stored last, so a reader in
+// any process that sees a nonzero tag sees the whole slot. Entries are
+// evicted by rewriting the file (pvalue_cache_compact).
+const char cacheMagic[8] = {'P', 'V', 'C', 'A', 'C', 'H', 'E', '1'};
+const uint32_t cacheVersion = 3;     // 2: adjusted plug-in summed in logs, 3: SIMD level in opts
+const size_t cacheMinSlots = 1024;
+const size_t cacheDefaultSlots = 1 << 20;
+
+struct cacheHeader {
+    char     magic[8];
+    uint32_t version;
+    uint32_t slotSize;
+    uint64_t nSlots;
+    uint64_t nUsed;
+    uint64_t lastUse;           // last use stamp given out
+    uint64_t hits;              // totals of the writers that closed the file
+    uint64_t misses;
+    uint64_t inserts;
+    uint64_t reserved[8];
+};
+struct cacheSlot {
+    uint64_t tag;               // hash of the key with the low bit set, 0 while empty
+    uint64_t key[3];            // bits of nObs, poiMean and poiUnc
+    uint32_t method;
+    uint32_t opts;              // options the result depends on
+    double   lnPval;            // log p-value, without the adjustment factor
+    double   relErr;
+    int64_t  nEvals;
+    int64_t  apiSaved;          // adjusted plug-in only
+    uint64_t lastUse;           // stamp of the last insert or hit by a writer
+};
+
+}
+
+struct pvCache {
+    int    fd;
+    bool   writer;
+    size_t mapSize;
+    struct cacheHeader * hdr;
+    struct cacheSlot * slot;
+    uint64_t mask;
+    mutex  insertLock;
+    atomic<long> hits, misses, inserts, dropped;
+};
+
+namespace {
+struct pvCache * cacheMap(int fd, bool writable, size_t nSlots);
+void cacheFail(int fd, int err);
+size_t cacheRoundSlots(size_t nSlots);
+uint64_t cacheHash(const uint64_t * key, uint32_t method, uint32_t opts);
+long cacheFind(const struct pvCache * c, const uint64_t * key, uint32_t method, uint32_t opts, uint64_t tag);
+bool cacheInsert(struct pvCache * c, const struct cacheSlot * s);
+}
+
+struct pvCache * pvalue_cache_open(const char * path, int writable, size_t nSlots)
+{
+// Maps the cache file path. A writable cache is created with nSlots slots
+// (rounded up to a power of two) if the file does not exist, and takes an
+// exclusive lock on it; when another process holds the lock it is opened
+// read-only instead. Returns NULL, with errno set, if the file cannot be
+// opened or mapped, or is not a cache file (EINVAL).
+    int fd = writable ? open(path, O_RDWR | O_CREAT, 0644) : open(path, O_RDONLY);
+    if (fd < 0) {return NULL;}
+    return cacheMap(fd, writable != 0, nSlots);
+}
+
+void pvalue_cache_close(struct pvCache * c)
+{
+// Adds the counters of a writer to the totals in the file, then unmaps it
+// and releases the lock
+    if (c == NULL) {return;}
+    if (c->writer) {
+        c->hdr->hits    += c->hits;
+        c->hdr->misses  += c->misses;
+        c->hdr->inserts += c->inserts;
+    }
+    munmap(c->hdr, c->mapSize);
+    close(c->fd);
+    delete c;
+}
+
+void pvalue_cache_stats(const struct pvCache * c, struct pvCacheStats * stats)
+{
+    stats->hits    = c->hits;
+    stats->misses  = c->misses;
+    stats->inserts = c->inserts;
+    stats->dropped = c->dropped;
+    stats->totalHits    = __atomic_load_n(&c->hdr->hits, __ATOMIC_RELAXED);
+    stats->totalMisses  = __atomic_load_n(&c->hdr->misses, __ATOMIC_RELAXED);
+    stats->totalInserts = __atomic_load_n(&c->hdr->inserts, __ATOMIC_RELAXED);
+    stats->slots   = c->mask + 1;
+    stats->entries = __atomic_load_n(&c->hdr->nUsed, __ATOMIC_RELAXED);
+    stats->writer  = c->writer ? 1 : 0;
+}
+
+long pvalue_cache_compact(const char * path, size_t keep, size_t nSlots)
+{
+// Rewrites the cache file path with its keep most recently used
+// observations, all of them when keep is 0, in a table of nSlots slots, or
+// twice the number of slots kept when nSlots is 0 or too small for them.
+// An observation, the results of all methods for one key and one set of
+// options, is kept or dropped whole, and its last use is that of its most
+// recently used slot. The new file replaces the old one by a rename, so
+// processes that have the old one mapped keep reading it. Returns the
+// number of observations kept, or -1 with errno set if the file cannot be
+// rewritten: ENOENT if it does not exist, which does not create it, and
+// EWOULDBLOCK if another process is writing it.
+    int fd = open(path, O_RDWR);
+    if (fd < 0) {return -1;}
+    struct pvCache * old = cacheMap(fd, true, 0);
+    if (old == NULL) {return -1;}
+    if (!old->writer) {
+        pvalue_cache_close(old);
+        errno = EWOULDBLOCK;
+        return -1;
+    }
+
+    vector<const struct cacheSlot *> used;
+    for (uint64_t i=0; i<=old->mask; i++) {
+        if (old->slot[i].tag != 0) {used.push_back(&old->slot[i]);}
+    }
+    auto sameObs = [](const struct cacheSlot * a, const struct cacheSlot * b) {
+        return memcmp(a->key, b->key, sizeof(a->key)) == 0 && a->opts == b->opts;
+    };
+    sort(used.begin(), used.end(), [](const struct cacheSlot * a, const struct cacheSlot * b) {
+        int d = memcmp(a->key, b->key, sizeof(a->key));
+        return (d != 0) ? (d < 0) : (a->opts < b->opts);
+    });
+
+// One group of consecutive slots per observation, ranked by last use
+    struct obsGroup {size_t first, last; uint64_t lastUse;};
+    vector<obsGroup> obs;
+    for (size_t i=0; i<used.size(); i++) {
+        if (obs.empty() || !sameObs(used[obs.back().first], used[i])) {
+            obs.push_back({i, i+1, used[i]->lastUse});
+        } else {
+            obs.back().last = i+1;
+            obs.back().lastUse = max(obs.back().lastUse, used[i]->lastUse);
+        }
+    }
+    if (keep > 0 && obs.size() > keep) {
+        nth_element(obs.begin(), obs.begin() + keep, obs.end(),
+                    [](const obsGroup & a, const obsGroup & b) {return a.lastUse > b.lastUse;});
+        obs.resize(keep);
+        vector<const struct cacheSlot *> kept;
+        for (size_t j=0; j<obs.size(); j++) {
+            kept.insert(kept.end(), used.begin() + obs[j].first, used.begin() + obs[j].last);
+        }
+        used.swap(kept);
+    }
+    if (nSlots < 2*used.size()) {nSlots = 2*used.size();}
+
+    string tmpPath = string(path) + ".tmp";
+    unlink(tmpPath.c_str());
+    struct pvCache * fresh = pvalue_cache_open(tmpPath.c_str(), 1, nSlots);
+    if (fresh == NULL || !fresh->writer) {
+        int err = (fresh == NULL) ? errno : EWOULDBLOCK;
+        pvalue_cache_close(fresh);
+        pvalue_cache_close(old);
+        errno = err;
+        return -1;
+    }
+    for (size_t i=0; i<used.size(); i++) {
+        cacheInsert(fresh, used[i]);
+    }
+    fresh->hdr->lastUse = old->hdr->lastUse;
+    fresh->hdr->hits    = old->hdr->hits;
+    fresh->hdr->misses  = old->hdr->misses;
+    fresh->hdr->inserts = old->hdr->inserts;
+    fresh->inserts = 0;
+    pvalue_cache_close(fresh);
+
+// The lock on the old file is held until the new one is in place, so that
+// no writer appends to a file that is about to be replaced
+    long nKept = obs.size();
+    int err = 0;
+    if (rename(tmpPath.c_str(), path) != 0) {
+        err = errno;
+        unlink(tmpPath.c_str());
+        nKept = -1;
+    }
+    pvalue_cache_close(old);
+    if (nKept < 0) {errno = err;}
+    return nKept;
+}
+
+bool pvalue_cache_get(struct pvCache * c, const struct pvPoissonConfig * cfg, int opts, struct pvPoissonResult * res)
+{
+// Looks up every method of one observation, and fills res with the
+// results without adjustment when all of them are found
+    uint64_t key[3];
+    long     idx[PV_POI_METHODS];
+    memcpy(&key[0], &cfg->nObs, sizeof(double));
+    memcpy(&key[1], &cfg->poiMean, sizeof(double));
+    memcpy(&key[2], &cfg->poiUnc, sizeof(double));
+    int nDone = (cfg->poiUnc != 0) ? PV_POI_METHODS : 1;
+
+    for (int k=0; k<nDone; k++) {
+        idx[k] = cacheFind(c, key, k, opts, cacheHash(key, k, opts));
+        if (idx[k] < 0) {
+            c->misses++;
+            return false;
+        }
+    }
+
+    uint64_t stamp = c->writer ? __atomic_add_fetch(&c->hdr->lastUse, 1, __ATOMIC_RELAXED) : 0;
+    struct pvResult * r = res->method;
+    res->excess   = (cfg->nObs >= cfg->poiMean);
+    res->apiSaved = 0;
+    for (int k=0; k<PV_POI_METHODS; k++) {
+        if (k < nDone) {
+            struct cacheSlot * s = &c->slot[idx[k]];
+            r[k].lnPval = s->lnPval;
+            r[k].relErr = s->relErr;
+            r[k].nEvals = s->nEvals;
+            if (k == PV_POI_ADJPLUGIN) {res->apiSaved = s->apiSaved;}
+            if (c->writer) {__atomic_store_n(&s->lastUse, stamp, __ATOMIC_RELAXED);}
+        } else {
+            r[k].lnPval = NAN;
+            r[k].relErr = 0.0;
+            r[k].nEvals = 0;
+        }
+        r[k].pVal   = exp(r[k].lnPval);
+        r[k].nSigma = pvalue_nsigma(r[k].lnPval);
+    }
+    c->hits++;
+    return true;
+}
+
+void pvalue_cache_put(struct pvCache * c, const struct pvPoissonConfig * cfg, int opts,
+                      const struct pvPoissonResult * res)
+{
+// Stores the results without adjustment of every method of one
+// observation; a read-only cache ignores them
+    if (!c->writer) {return;}
+    struct cacheSlot s;
+    memset(&s, 0, sizeof(s));
+    memcpy(&s.key[0], &cfg->nObs, sizeof(double));
+    memcpy(&s.key[1], &cfg->poiMean, sizeof(double));
+    memcpy(&s.key[2], &cfg->poiUnc, sizeof(double));
+    s.opts    = opts;
+    s.lastUse = __atomic_add_fetch(&c->hdr->lastUse, 1, __ATOMIC_RELAXED);
+    int nDone = (cfg->poiUnc != 0) ? PV_POI_METHODS : 1;
+
+    lock_guard<mutex> guard(c->insertLock);
+    for (int k=0; k<nDone; k++) {
+        s.method   = k;
+        s.tag      = cacheHash(s.key, k, opts);
+        s.lnPval   = res->method[k].lnPval;
+        s.relErr   = res->method[k].relErr;
+        s.nEvals   = res->method[k].nEvals;
+        s.apiSaved = (k == PV_POI_ADJPLUGIN) ? res->apiSaved : 0;
+        if (!cacheInsert(c, &s)) {
+            c->dropped++;
+            return;
+        }
+    }
+}
+
+namespace {
+
+struct pvCache * cacheMap(int fd, bool writable, size_t nSlots)
+{
+// pvalue_cache_open of the open file fd, which is closed on failure
+    bool writer = writable && flock(fd, LOCK_EX | LOCK_NB) == 0;
+
+    struct stat st;
+    struct cacheHeader hdr;
+    if (fstat(fd, &st) != 0) {
+        cacheFail(fd, errno);
+        return NULL;
+    }
+    if (st.st_size == 0 && writer) {
+        memset(&hdr, 0, sizeof(hdr));
+        memcpy(hdr.magic, cacheMagic, sizeof(hdr.magic));
+        hdr.version  = cacheVersion;
+        hdr.slotSize = sizeof(struct cacheSlot);
+        hdr.nSlots   = cacheRoundSlots(nSlots == 0 ? cacheDefaultSlots : nSlots);
+        if (ftruncate(fd, sizeof(hdr) + hdr.nSlots*sizeof(struct cacheSlot)) != 0
+            || pwrite(fd, &hdr, sizeof(hdr), 0) != (ssize_t) sizeof(hdr)) {
+            cacheFail(fd, errno);
+            return NULL;
+        }
+    } else if (pread(fd, &hdr, sizeof(hdr), 0) != (ssize_t) sizeof(hdr)
+               || memcmp(hdr.magic, cacheMagic, sizeof(hdr.magic)) != 0
+               || hdr.version != cacheVersion || hdr.slotSize != sizeof(struct cacheSlot)
+               || hdr.nSlots == 0 || (hdr.nSlots & (hdr.nSlots - 1)) != 0
+               || (uint64_t) st.st_size < sizeof(hdr) + hdr.nSlots*sizeof(struct cacheSlot)) {
+        cacheFail(fd, EINVAL);
+        return NULL;
+    }
+
+    size_t mapSize = sizeof(hdr) + hdr.nSlots*sizeof(struct cacheSlot);
+    void * map = mmap(NULL, mapSize, writer ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+    if (map == MAP_FAILED) {
+        cacheFail(fd, errno);
+        return NULL;
+    }
+
+    struct pvCache * c = new pvCache;
+    c->fd      = fd;
+    c->writer  = writer;
+    c->mapSize = mapSize;
+    c->hdr     = (struct cacheHeader *) map;
+    c->slot    = (struct cacheSlot *) ((char *) map + sizeof(struct cacheHeader));
+    c->mask    = hdr.nSlots - 1;
+    c->hits = c->misses = c->inserts = c->dropped = 0;
+    return c;
+}
+
+
+void cacheFail(int fd, int err)
+{
+// Closes fd and leaves errno at err
+    close(fd);
+    errno = err;
+}
+
+bool cacheInsert(struct pvCache * c, const struct cacheSlot * s)
+{
+// Stores slot s unless its key is already there. The table is kept at
+// most three quarters full, so that probe sequences stay short; false is
+// returned when it is full.
+    uint64_t nSlots = c->mask + 1;
+    for (uint64_t i = s->tag & c->mask; ; i = (i + 1) & c->mask) {
+        struct cacheSlot * d = &c->slot[i];
+        if (d->tag == s->tag && memcmp(d->key, s->key, sizeof(d->key)) == 0
+            && d->method == s->method && d->opts == s->opts) {
+            return true;
+        }
+        if (d->tag == 0) {
+            if (c->hdr->nUsed >= nSlots - nSlots/4) {return false;}
+            memcpy((char *) d + sizeof(d->tag), (const char *) s + sizeof(s->tag), sizeof(*s) - sizeof(s->tag));
+            __atomic_store_n(&d->tag, s->tag, __ATOMIC_RELEASE);
+            __atomic_add_fetch(&c->hdr->nUsed, 1, __ATOMIC_RELAXED);
+            c->inserts++;
+            return true;
+        }
+    }
+}
+
+long cacheFind(const struct pvCache * c, const uint64_t * key, uint32_t method, uint32_t opts, uint64_t tag)
+{
+// Index of the slot of the key, or -1 when it is not in the table
+    for (uint64_t i = tag & c->mask, n = 0; n <= c->mask; i = (i + 1) & c->mask, n++) {
+        const struct cacheSlot * s = &c->slot[i];
+        uint64_t t = __atomic_load_n(&s->tag, __ATOMIC_ACQUIRE);
+        if (t == 0) {return -1;}
+        if (t == tag && memcmp(s->key, key, sizeof(s->key)) == 0 && s->method == method && s->opts == opts) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+uint64_t cacheHash(const uint64_t * key, uint32_t method, uint32_t opts)
+{
+// Mixes the key words, then applies the splitmix64 finalizer; the low bit
+// is set so that a filled slot never has a zero tag
+    uint64_t h = ((uint64_t) opts << 32) | method;
+    for (int i=0; i<3; i++) {
+        h ^= key[i] + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+    }
+    h ^= h >> 30;
+    h *= 0xbf58476d1ce4e5b9ULL;
+    h ^= h >> 27;
+    h *= 0x94d049bb133111ebULL;
+    h ^= h >> 31;
+    return h | 1;
+}
+
+size_t cacheRoundSlots(size_t nSlots)
+{
+    size_t n = cacheMinSlots;
+    while (n < nSlots) {n *= 2;}
+    return n;
+}
+
+}
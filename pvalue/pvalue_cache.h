@@ -0,0 +1,16 @@
+#ifndef PVALUE_CACHE_H
+#define PVALUE_CACHE_H
+
+// Lookups and inserts of the result cache, used by poisson_pvalues. opts
+// are the options the results depend on. A lookup fills res with the
+// results without adjustment of every method of the observation, and
+// fails unless all of them are found; an insert stores them, unless the
+// cache is read-only.
+
+#include "pvalue.h"
+
+bool pvalue_cache_get(struct pvCache * c, const struct pvPoissonConfig * cfg, int opts, struct pvPoissonResult * res);
+void pvalue_cache_put(struct pvCache * c, const struct pvPoissonConfig * cfg, int opts,
+                      const struct pvPoissonResult * res);
+
+#endif
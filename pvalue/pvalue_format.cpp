@@ -0,0 +1,28 @@
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+
+#include "pvalue.h"
+
+void pvalue_format(double lnPval, int digits, char * buf, size_t len) {
+// Prints a p-value from its log with the given number of significant
+// digits, in %g format, with the exponent written out when the p-value is
+// below the smallest double. Far out, the log carries fewer digits of the
+// mantissa than requested, down to none beyond about 1e16, where the
+// mantissa is printed as 1; rounding errors are kept from pushing it out
+// of [1, 10), so that the exponent stays right.
+    double pVal = exp(lnPval);
+    if (pVal >= DBL_MIN || !isfinite(lnPval)) {
+        snprintf(buf, len, "%.*g", digits, pVal);
+        return;
+    }
+    double e = floor(lnPval / M_LN10);
+    double m = exp(lnPval - e * M_LN10);
+    m = fmin(fmax(m, 1.0), 10.0);
+    if (fabs(lnPval)*DBL_EPSILON >= M_LN10) {m = 1.0;}
+    if (m >= 10.0 - 5.0*pow(10.0, -digits)) {
+        m /= 10.0;
+        e += 1.0;
+    }
+    snprintf(buf, len, "%.*ge%+.0f", digits, m, e);
+}
@@ -0,0 +1,13 @@
+#include <math.h>
+
+#include "../cdflib/cdf.hpp"
+#include "pvalue.h"
+
+double pvalue_nsigma(double lnPval) {
+// Number of standard normal sigmas corresponding to the log of a one-sided
+// p-value; p >= 1 maps to -infinity and p = 0 to +infinity
+    if (isnan(lnPval)) {return NAN;}
+    if (lnPval >= 0.0) {return -INFINITY;}
+    if (lnPval == -INFINITY) {return INFINITY;}
+    return cdf::normal_isf_log(lnPval);
+}
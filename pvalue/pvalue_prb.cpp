@@ -0,0 +1,330 @@
+#include <iostream>
+#include <string>
+#include <string.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <math.h>
+#include <unistd.h>
+#include "pvalue.h"
+
+using namespace std;
+
+// Tests of libpvalue. Each test prints what it compares and returns the
+// number of failed checks; the program exits with the total.
+
+int testApiSum();
+int testSimes();
+int testFormat();
+int testQuad();
+int testCache();
+
+int main()
+{
+    int nFail = 0;
+
+    cout << "PVALUE_PRB: tests of libpvalue" << endl;
+    nFail += testApiSum();
+    nFail += testSimes();
+    nFail += testFormat();
+    nFail += testQuad();
+    nFail += testCache();
+
+    cout << "\n" << (nFail == 0 ? "All tests passed." : "Some tests FAILED.") << endl;
+    return (nFail == 0) ? 0 : 1;
+}
+
+int testApiSum()
+{
+// The adjusted plug-in sum of poisson_pvalues against the term-by-term sum
+// of the original program, for excesses and deficits from a few events to
+// tens of thousands, with uncertainties from small to larger than the mean.
+// Observations far in the tail are left out: there the first terms of the
+// direct sum underflow, and it stops at 2*nuEst with a p-value of 0.
+    const double nObs[]    = {1, 3, 7, 12, 25, 60, 150, 400, 1500, 27445};
+    const double relUnc[]  = {0.01, 0.1, 0.3, 0.6, 1.2};
+    const double shift[]   = {-3.0, -1.0, 0.0, 1.0, 3.0};
+    const double tol = 1.0e-10;
+    double errMax = 0.0, worst[3] = {0, 0, 0};
+    int nFail = 0, nSkip = 0;
+
+    cout << "\nTEST API_SUM: warm-started against direct adjusted plug-in sum" << endl;
+    for (double n : nObs) {
+        for (double ru : relUnc) {
+            for (double s : shift) {
+                double poiMean = max(0.5, n + s*sqrt(n));
+                double poiUnc  = ru*poiMean;
+                double lnFast  = poisson_api_lnpvalue(n, poiMean, poiUnc, 0);
+                double lnSlow  = poisson_api_lnpvalue(n, poiMean, poiUnc, 1);
+                if (lnSlow == -INFINITY) {
+                    nSkip++;
+                    continue;
+                }
+                double err = fabs(expm1(lnFast - lnSlow));
+                if (!(err <= tol)) {
+                    cout << "  FAILED: nObs=" << n << " poiMean=" << poiMean << " poiUnc=" << poiUnc
+                         << " ln p = " << lnFast << " instead of " << lnSlow << endl;
+                    nFail++;
+                }
+                if (err > errMax) {
+                    errMax = err;
+                    worst[0] = n; worst[1] = poiMean; worst[2] = poiUnc;
+                }
+            }
+        }
+    }
+    double lnFast = poisson_api_lnpvalue(27445, 27313, 15531, 0);
+    double lnSlow = poisson_api_lnpvalue(27445, 27313, 15531, 1);
+    if (!(fabs(expm1(lnFast - lnSlow)) <= tol)) {
+        cout << "  FAILED: nObs=27445 poiMean=27313 poiUnc=15531" << endl;
+        nFail++;
+    }
+    cout << "  Largest relative difference " << errMax << " (nObs=" << worst[0] << ", poiMean="
+         << worst[1] << ", poiUnc=" << worst[2] << "), tolerance " << tol << endl;
+    cout << "  Observations left out, where the direct sum underflows: " << nSkip << endl;
+    return nFail;
+}
+
+int testSimes()
+{
+// Simes's combination of sorted p-values, min over i of p(i)*n/i, on sets
+// where the smallest, a middle and the largest p-value decide it
+    const double p1[] = {0.5, 0.6};
+    const double p2[] = {0.01, 0.04, 0.9};
+    const double p3[] = {0.1, 0.12, 0.5, 0.55};
+    const double * sets[] = {p1, p2, p3};
+    const size_t   sizes[] = {2, 3, 4};
+    const double   expect[] = {0.6, 0.03, 0.24};
+    int nFail = 0;
+
+    cout << "\nTEST SIMES: combine_pvalues against known Simes p-values" << endl;
+    for (int k=0; k<3; k++) {
+        struct pvCombResult res;
+        combine_pvalues(sets[k], sizes[k], PV_SIMES, &res);
+        double pSimes = res.method[PV_COMB_SIMES].pVal;
+        bool ok = fabs(pSimes - expect[k]) <= 1.0e-15;
+        cout << "  " << sizes[k] << " p-values: " << pSimes << ", expected " << expect[k]
+             << (ok ? "" : "  FAILED") << endl;
+        if (!ok) {nFail++;}
+    }
+    return nFail;
+}
+
+int testFormat()
+{
+// pvalue_format within the range of doubles, below it, where the rounded
+// mantissa reaches 10, and so far out that the log has no digits left for
+// the mantissa
+    const double lnP[]   = {log(0.25), log(1.18) - 1779*M_LN10, log(9.99999999) - 400*M_LN10,
+                            log(9.99999999) - 400*M_LN10, -1.0e21};
+    const int    digits[] = {10, 3, 10, 6, 6};
+    const char * expect[] = {"0.25", "1.18e-1779", "9.99999999e-400", "1e-399", "1e-434294481903251816448"};
+    int nFail = 0;
+
+    cout << "\nTEST FORMAT: p-values printed from their logs" << endl;
+    for (int k=0; k<5; k++) {
+        char buf[64];
+        pvalue_format(lnP[k], digits[k], buf, sizeof(buf));
+        bool ok = strcmp(buf, expect[k]) == 0;
+        cout << "  " << buf << ", expected " << expect[k] << (ok ? "" : "  FAILED") << endl;
+        if (!ok) {nFail++;}
+    }
+    return nFail;
+}
+
+int testQuad()
+{
+// The prior-predictive and fiducial integrals of the built-in rule against
+// the GSL adaptive routines, one observation at a time and in blocks of
+// lanes, for excesses and deficits and narrow to wide priors. The gamma
+// prior is in closed form and is left out.
+    const double nObs[]   = {0, 1, 4, 10, 30, 100, 1000};
+    const double ratio[]  = {0.3, 0.8, 1.0, 1.5, 4.0};
+    const double relUnc[] = {0.02, 0.1, 0.3, 0.7};
+    const int    nCfg = 7*5*4;
+    const double tol = 1.0e-6;
+    struct pvPoissonConfig cfg[nCfg];
+    struct pvPoissonResult quad[nCfg], gsl[nCfg];
+    struct pvPoissonOptions opt = {0, 0, 1, NULL};
+    const int    methods[] = {PV_POI_GAUSS, PV_POI_LOGNORMAL, PV_POI_RELUNC, PV_POI_FIDUCIAL};
+    double errMax[PV_POI_METHODS] = {0};
+    int nFail = 0, m = 0;
+
+    for (double n : nObs) {
+        for (double r : ratio) {
+            for (double ru : relUnc) {
+                double poiMean = max(0.5, n/r);
+                cfg[m].nObs        = n;
+                cfg[m].poiMean     = poiMean;
+                cfg[m].poiUnc      = ru*poiMean;
+                cfg[m].pAdjustment = 1.0;
+                m++;
+            }
+        }
+    }
+
+    cout << "\nTEST QUAD: built-in quadrature against GSL adaptive routines" << endl;
+    opt.adaptive = 1;
+    poisson_pvalues_options(&opt);
+    poisson_pvalues(cfg, nCfg, gsl);
+    for (int lanes : {1, 8}) {
+        opt.adaptive = 0;
+        opt.lanes = lanes;
+        poisson_pvalues_options(&opt);
+        poisson_pvalues(cfg, nCfg, quad);
+        for (int i=0; i<nCfg; i++) {
+            for (int k : methods) {
+                double err = fabs(expm1(quad[i].method[k].lnPval - gsl[i].method[k].lnPval));
+                if (quad[i].method[k].lnPval == gsl[i].method[k].lnPval) {err = 0.0;}
+                if (!(err <= tol)) {
+                    cout << "  FAILED: lanes=" << lanes << " nObs=" << cfg[i].nObs << " poiMean=" << cfg[i].poiMean
+                         << " poiUnc=" << cfg[i].poiUnc << " method " << k << ": ln p = "
+                         << quad[i].method[k].lnPval << " instead of " << gsl[i].method[k].lnPval << endl;
+                    nFail++;
+                }
+                errMax[k] = max(errMax[k], err);
+            }
+        }
+    }
+    opt.adaptive = 0;
+    opt.lanes = 8;
+    poisson_pvalues_options(&opt);
+
+    cout << "  " << nCfg << " observations, largest relative differences (tolerance " << tol << "):" << endl;
+    cout << "    Gaussian " << errMax[PV_POI_GAUSS] << ", lognormal "
+         << errMax[PV_POI_LOGNORMAL] << ", rel. unc. " << errMax[PV_POI_RELUNC] << ", fiducial "
+         << errMax[PV_POI_FIDUCIAL] << endl;
+    return nFail;
+}
+
+int testCache()
+{
+// The result cache: results stored by a writer and found again, with the
+// same bits as without the cache for any adjustment; a second handle on
+// the file that is read-only while the first one holds the lock; a
+// compaction that keeps the most recently used observations with all
+// their methods; and a missing file, which compact does not create, and
+// a file that is not a cache.
+    const int nCfg = 6;
+    struct pvPoissonConfig cfg[nCfg] = {
+        {3, 1.2, 0.3, 1.0}, {12, 14, 0, 1.0}, {25, 11, 2.5, 1.0},
+        {7, 9, 4.5, 1.0},   {150, 120, 0, 1.0}, {60, 44, 8, 1.0}};
+    struct pvPoissonResult plain[nCfg], cached[nCfg];
+    struct pvPoissonOptions opt = {0, 0, 8, NULL};
+    struct pvCacheStats cs;
+    int nFail = 0;
+
+    char dir[] = "/tmp/pvalue_prbXXXXXX";
+    if (mkdtemp(dir) == NULL) {
+        cout << "\nTEST CACHE: cannot make a temporary directory  FAILED" << endl;
+        return 1;
+    }
+    string path = string(dir) + "/results.cache", other = string(dir) + "/other.cache";
+    auto check = [&nFail](bool ok, const char * what) {
+        cout << "  " << what << (ok ? "" : "  FAILED") << endl;
+        if (!ok) {nFail++;}
+    };
+    auto sameBits = [](const struct pvPoissonResult * a, const struct pvPoissonResult * b, int n) {
+        for (int i=0; i<n; i++) {
+            for (int k=0; k<PV_POI_METHODS; k++) {
+                double x = a[i].method[k].lnPval, y = b[i].method[k].lnPval;
+                if (memcmp(&x, &y, sizeof(double)) != 0) {return false;}
+            }
+        }
+        return true;
+    };
+    int nSlotsOf[nCfg];
+    for (int i=0; i<nCfg; i++) {nSlotsOf[i] = (cfg[i].poiUnc != 0) ? PV_POI_METHODS : 1;}
+
+    cout << "\nTEST CACHE: persistent result cache" << endl;
+    errno = 0;
+    check(pvalue_cache_compact(path.c_str(), 0, 0) == -1 && errno == ENOENT
+          && access(path.c_str(), F_OK) != 0, "compact of a missing file fails with ENOENT and creates nothing");
+    errno = 0;
+    check(pvalue_cache_open(path.c_str(), 0, 0) == NULL && errno == ENOENT,
+          "read-only open of a missing file fails with ENOENT");
+
+    poisson_pvalues_options(&opt);
+    poisson_pvalues(cfg, nCfg, plain);
+
+    struct pvCache * cache = pvalue_cache_open(path.c_str(), 1, 1024);
+    check(cache != NULL, "writable open creates the file");
+    if (cache == NULL) {
+        rmdir(dir);
+        return nFail;
+    }
+    opt.cache = cache;
+    poisson_pvalues_options(&opt);
+    poisson_pvalues(cfg, nCfg, cached);
+    pvalue_cache_stats(cache, &cs);
+    int nSlots = 0;
+    for (int i=0; i<nCfg; i++) {nSlots += nSlotsOf[i];}
+    check(cs.writer == 1 && cs.misses == nCfg && cs.hits == 0 && cs.inserts == nSlots && cs.entries == nSlots,
+          "first pass misses every observation and stores every method");
+    check(sameBits(plain, cached, nCfg), "stored results have the bits of the uncached ones");
+
+    for (int i=0; i<nCfg; i++) {cfg[i].pAdjustment = 1.0 + i;}
+    opt.cache = NULL;
+    poisson_pvalues_options(&opt);
+    poisson_pvalues(cfg, nCfg, plain);
+    opt.cache = cache;
+    poisson_pvalues_options(&opt);
+    poisson_pvalues(cfg, nCfg, cached);
+    pvalue_cache_stats(cache, &cs);
+    check(cs.hits == nCfg && cs.inserts == nSlots, "second pass finds every observation");
+    check(sameBits(plain, cached, nCfg), "found results, adjusted, have the bits of the uncached ones");
+
+// A second handle cannot take the lock held by the first one
+    struct pvCache * reader = pvalue_cache_open(path.c_str(), 1, 0);
+    check(reader != NULL, "second writable open succeeds");
+    if (reader != NULL) {
+        struct pvPoissonConfig extra = {40, 30, 3, 1.0};
+        struct pvPoissonResult extraRes;
+        opt.cache = reader;
+        poisson_pvalues_options(&opt);
+        poisson_pvalues(cfg, nCfg, cached);
+        poisson_pvalues(&extra, 1, &extraRes);
+        pvalue_cache_stats(reader, &cs);
+        check(cs.writer == 0 && cs.hits == nCfg && cs.misses == 1 && cs.inserts == 0 && cs.entries == nSlots,
+              "it is read-only: it finds the stored results and stores none");
+        pvalue_cache_close(reader);
+    }
+
+// Observations 1 and 2 are used last, and are the ones kept
+    opt.cache = cache;
+    poisson_pvalues_options(&opt);
+    poisson_pvalues(&cfg[1], 2, cached);
+    pvalue_cache_close(cache);
+    opt.cache = NULL;
+    poisson_pvalues_options(&opt);
+
+    check(pvalue_cache_compact(path.c_str(), 2, 0) == 2, "compact keeps the 2 observations asked for");
+    cache = pvalue_cache_open(path.c_str(), 0, 0);
+    check(cache != NULL, "read-only open of the compacted file");
+    if (cache != NULL) {
+        pvalue_cache_stats(cache, &cs);
+        check(cs.writer == 0 && cs.entries == nSlotsOf[1] + nSlotsOf[2],
+              "they are kept with the results of all their methods");
+        opt.cache = cache;
+        poisson_pvalues_options(&opt);
+        poisson_pvalues(cfg, nCfg, cached);
+        pvalue_cache_stats(cache, &cs);
+        check(cs.hits == 2 && cs.misses == nCfg - 2, "only they are found");
+        pvalue_cache_close(cache);
+        opt.cache = NULL;
+        poisson_pvalues_options(&opt);
+    }
+
+    FILE * f = fopen(other.c_str(), "w");
+    if (f != NULL) {
+        fputs("nObs, poiMean, poiUnc\n", f);
+        fclose(f);
+    }
+    errno = 0;
+    check(pvalue_cache_open(other.c_str(), 1, 0) == NULL && errno == EINVAL,
+          "open of a file that is not a cache fails with EINVAL");
+
+    unlink(path.c_str());
+    unlink(other.c_str());
+    rmdir(dir);
+    return nFail;
+}
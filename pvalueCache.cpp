@@ -0,0 +1,73 @@
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+
+using namespace std;
+
+#include "pvalue/pvalue.h"
+
+const char * cacheError(int err);
+
+// Inspects or compacts a result cache of poissonPvalues (--cache). Without
+// options, prints the size and counters of the cache; --compact rewrites
+// it, keeping the -k most recently used observations, with the results of
+// all their methods (all by default), in a table of -s slots (twice the
+// number of results kept by default).
+int main(int argc, char * argv[])
+{
+    bool compact = false;
+    size_t keep = 0;
+    size_t nSlots = 0;
+    const char * fileName = NULL;
+
+    for (int i=1; i<argc; i++) {
+        if (strcmp(argv[i], "-c") == 0 || strcmp(argv[i], "--compact") == 0) {
+            compact = true;
+        } else if (compact && (strcmp(argv[i], "-k") == 0 || strcmp(argv[i], "--keep") == 0) && i+1 < argc) {
+            keep = strtoul(argv[++i], NULL, 10);
+        } else if (compact && (strcmp(argv[i], "-s") == 0 || strcmp(argv[i], "--slots") == 0) && i+1 < argc) {
+            nSlots = strtoul(argv[++i], NULL, 10);
+        } else if (fileName == NULL) {
+            fileName = argv[i];
+        } else {
+            fileName = NULL;
+            break;
+        }
+    }
+    if (fileName == NULL) {
+        cerr << "Usage: pvalueCache [-c|--compact [-k keep] [-s slots]] file" << endl;
+        return 1;
+    }
+
+    if (compact) {
+        long nKept = pvalue_cache_compact(fileName, keep, nSlots);
+        if (nKept < 0) {
+            cerr << "pvalueCache: cannot compact " << fileName << ": " << cacheError(errno) << endl;
+            return 1;
+        }
+        cout << "Kept " << nKept << " observations" << endl;
+    }
+
+    struct pvCache * cache = pvalue_cache_open(fileName, 0, 0);
+    if (cache == NULL) {
+        cerr << "pvalueCache: cannot open " << fileName << ": " << cacheError(errno) << endl;
+        return 1;
+    }
+    struct pvCacheStats cs;
+    pvalue_cache_stats(cache, &cs);
+    cout << "Entries: " << cs.entries << " of " << cs.slots << " slots ("
+         << (100.0*cs.entries)/cs.slots << "% full, 75% at most)" << endl;
+    cout << "Hits: " << cs.totalHits << ", misses: " << cs.totalMisses
+         << ", results stored: " << cs.totalInserts << endl;
+    pvalue_cache_close(cache);
+    return 0;
+}
+
+const char * cacheError(int err)
+{
+// The reason for a failure of pvalue_cache_open or pvalue_cache_compact
+    if (err == EINVAL) {return "not a cache file of this version";}
+    if (err == EWOULDBLOCK) {return "being written by another process";}
+    return strerror(err);
+}